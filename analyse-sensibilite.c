@@ -0,0 +1,359 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "tache.h"
+#include "analyse.h"
+#include "lot-taches.h"
+#include "pool-travail.h"
+#include "sensibilite.h"
+
+// Nombre de jeux lus d'un coup et répartis entre les ouvriers
+#define JEUX_PAR_BLOC 1024
+
+// Algorithmes analysés (OPA et FIFO n'ont pas de test monotone en C)
+static const TypeOrdonnanceur algorithmes_sensibilite[] = { HPF, RM, DM, EDF };
+static const char *noms_algorithmes[] = { "hpf", "rm", "dm", "edf" };
+#define NB_ALGORITHMES_SENSIBILITE 4
+
+// Résultat d'une recherche : facteur critique (recherche 0) ou marge d'une tâche
+typedef struct {
+    double facteur;
+    temps_t marge;
+} ResultatRecherche;
+
+// Tampon propre à un ouvrier : jeu mis à l'échelle ou modifié pendant une recherche
+typedef struct {
+    ParametresTache *travail;
+    int capacite;
+} ContexteOuvrier;
+
+// Description du travail d'un bloc, partagée en lecture seule par les ouvriers
+// Chaque couple (jeu, algorithme) donne n + 1 recherches indépendantes : le
+// facteur critique puis la marge de chacune des n tâches.
+typedef struct {
+    const BlocLot *bloc;
+    int algorithmes[NB_ALGORITHMES_SENSIBILITE]; // Indices dans algorithmes_sensibilite
+    int nb_algorithmes;
+    long *premiere_recherche;  // Première recherche de chaque jeu (nb_jeux + 1 entrées)
+    ContexteOuvrier *ouvriers;
+    ResultatRecherche *resultats;
+} TravailSensibilite;
+
+// Fonction pour trouver le jeu contenant la recherche k (dichotomie sur les débuts)
+static int jeu_de_recherche(const TravailSensibilite *travail, long k) {
+    int bas = 0;
+    int haut = travail->bloc->nb_jeux - 1;
+    
+    while (bas < haut) {
+        int milieu = (bas + haut + 1) / 2;
+        if (travail->premiere_recherche[milieu] <= k) {
+            bas = milieu;
+        } else {
+            haut = milieu - 1;
+        }
+    }
+    return bas;
+}
+
+// Fonction exécutée par les ouvriers : effectuer les recherches [debut, fin) d'un bloc
+// Les recherches d'un jeu sont rangées par algorithme, puis facteur avant marges.
+static void effectuer_recherches(void *contexte, int ouvrier, long debut, long fin) {
+    TravailSensibilite *travail = contexte;
+    ParametresTache *tampon = travail->ouvriers[ouvrier].travail;
+    int jeu = jeu_de_recherche(travail, debut);
+    
+    for (long k = debut; k < fin; k++) {
+        while (k >= travail->premiere_recherche[jeu + 1]) {
+            jeu++;
+        }
+        const ParametresTache *parametres = travail->bloc->parametres + travail->bloc->debut[jeu];
+        int n = (int)(travail->bloc->debut[jeu + 1] - travail->bloc->debut[jeu]);
+        long position = k - travail->premiere_recherche[jeu];
+        TypeOrdonnanceur algorithme = algorithmes_sensibilite[travail->algorithmes[position / (n + 1)]];
+        int recherche = (int)(position % (n + 1));
+        ResultatRecherche *resultat = &travail->resultats[k];
+        
+        // Jeux invalides : aucune recherche, la ligne CSV l'indique
+        if (n == 0 || !lot_parametres_valides(parametres, n)) {
+            continue;
+        }
+        if (recherche == 0) {
+            resultat->facteur = facteur_critique(algorithme, parametres, n, tampon);
+        } else {
+            resultat->marge = marge_tache(algorithme, parametres, n, recherche - 1, tampon);
+        }
+    }
+}
+
+// Fonction pour écrire les lignes CSV d'un jeu (résumé et, si demandé, détail par tâche)
+static void ecrire_jeu(const TravailSensibilite *travail, int jeu, FILE *sortie, FILE *detail) {
+    const BlocLot *bloc = travail->bloc;
+    const ParametresTache *parametres = bloc->parametres + bloc->debut[jeu];
+    int n = (int)(bloc->debut[jeu + 1] - bloc->debut[jeu]);
+    long numero = bloc->premier_numero + jeu;
+    bool valide = n > 0 && lot_parametres_valides(parametres, n);
+    double utilisation = valide ? facteur_utilisation(parametres, n) : 0.0;
+    
+    for (int a = 0; a < travail->nb_algorithmes; a++) {
+        const char *nom = noms_algorithmes[travail->algorithmes[a]];
+        const ResultatRecherche *resultats = &travail->resultats[travail->premiere_recherche[jeu] + a * (n + 1)];
+        
+        if (!valide) {
+            fprintf(sortie, "%ld,%d,%s,invalide,-,-,-,-,-\n", numero, n, nom);
+            continue;
+        }
+        
+        // Une marge impossible est la plus petite de toutes
+        int tache_min = 1;
+        for (int i = 2; i <= n; i++) {
+            if (resultats[i].marge < resultats[tache_min].marge) {
+                tache_min = i;
+            }
+        }
+        double facteur = resultats[0].facteur;
+        fprintf(sortie, "%ld,%d,%s,%s,%.4f,%.4f,%.4f,", numero, n, nom,
+                facteur >= 1.0 ? "faisable" : "non_faisable", utilisation, facteur, utilisation * facteur);
+        if (resultats[tache_min].marge != MARGE_IMPOSSIBLE) {
+            fprintf(sortie, "%lld,%d\n", resultats[tache_min].marge, tache_min);
+        } else {
+            fprintf(sortie, "-,%d\n", tache_min);
+        }
+        
+        for (int i = 1; detail != NULL && i <= n; i++) {
+            const ParametresTache *tache = &parametres[i - 1];
+            fprintf(detail, "%ld,%d,%s,%d,%lld,%lld,%lld,", numero, n, nom, i, tache->duree_execution,
+                    tache->echeance, tache->periode);
+            if (resultats[i].marge != MARGE_IMPOSSIBLE) {
+                fprintf(detail, "%lld,%.4f\n", resultats[i].marge,
+                        (double)(tache->duree_execution + resultats[i].marge) / tache->duree_execution);
+            } else {
+                fprintf(detail, "-,-\n");
+            }
+        }
+    }
+}
+
+// Fonction pour préparer les recherches d'un bloc : débuts par jeu, résultats
+// et tampons des ouvriers assez grands pour le plus grand jeu (false si mémoire)
+static bool preparer_bloc(TravailSensibilite *travail, const BlocLot *bloc, long **premiere_recherche,
+                          ResultatRecherche **resultats, long *capacite, int nb_ouvriers) {
+    long *debuts = realloc(*premiere_recherche, (bloc->nb_jeux + 1) * sizeof(long));
+    int n_max = 0;
+    
+    if (debuts == NULL) {
+        return false;
+    }
+    *premiere_recherche = debuts;
+    debuts[0] = 0;
+    for (int j = 0; j < bloc->nb_jeux; j++) {
+        int n = (int)(bloc->debut[j + 1] - bloc->debut[j]);
+        debuts[j + 1] = debuts[j] + (long)(n + 1) * travail->nb_algorithmes;
+        if (n > n_max) {
+            n_max = n;
+        }
+    }
+    
+    if (debuts[bloc->nb_jeux] > *capacite) {
+        ResultatRecherche *agrandi = realloc(*resultats, debuts[bloc->nb_jeux] * sizeof(ResultatRecherche));
+        if (agrandi == NULL) {
+            return false;
+        }
+        *resultats = agrandi;
+        *capacite = debuts[bloc->nb_jeux];
+    }
+    for (int o = 0; o < nb_ouvriers; o++) {
+        ContexteOuvrier *ouvrier = &travail->ouvriers[o];
+        if (n_max > ouvrier->capacite) {
+            ParametresTache *agrandi = realloc(ouvrier->travail, n_max * sizeof(ParametresTache));
+            if (agrandi == NULL) {
+                return false;
+            }
+            ouvrier->travail = agrandi;
+            ouvrier->capacite = n_max;
+        }
+    }
+    return true;
+}
+
+// Fonction pour analyser la sensibilité de tous les jeux d'un fichier de lot
+// Comme en mode lot de faisabilite-ordonnanceur, un bloc est traité sur le pool
+// pendant que le suivant est lu, et les lignes sont écrites dans l'ordre du fichier.
+static int executer_sensibilite(const char *chemin, const bool algorithmes[NB_ALGORITHMES_SENSIBILITE],
+                                int nb_threads, FILE *sortie, FILE *detail) {
+    LecteurLot lecteur;
+    BlocLot blocs[2] = { { 0 }, { 0 } };
+    long *premieres[2] = { NULL, NULL };
+    ResultatRecherche *resultats[2] = { NULL, NULL };
+    long capacites[2] = { 0, 0 };
+    TravailSensibilite travail = { 0 };
+    int code = 0;
+    
+    for (int a = 0; a < NB_ALGORITHMES_SENSIBILITE; a++) {
+        if (algorithmes[a]) {
+            travail.algorithmes[travail.nb_algorithmes++] = a;
+        }
+    }
+    
+    if (!lot_ouvrir(&lecteur, chemin)) {
+        return 1;
+    }
+    PoolTravail *pool = pool_creer(nb_threads);
+    travail.ouvriers = pool != NULL ? calloc(pool_nb_ouvriers(pool), sizeof(ContexteOuvrier)) : NULL;
+    if (pool == NULL || travail.ouvriers == NULL) {
+        fprintf(stderr, "Lot: impossible de demarrer les threads\n");
+        code = 1;
+    }
+    
+    fprintf(sortie, "jeu,taches,algorithme,faisable,utilisation,facteur_critique,utilisation_limite,"
+                    "marge_min,tache_marge_min\n");
+    if (detail != NULL) {
+        fprintf(detail, "jeu,taches,algorithme,tache,C,D,T,marge,facteur_tache\n");
+    }
+    int courant = 0;
+    int nb_jeux = code == 0 ? lot_lire_bloc(&lecteur, &blocs[courant], JEUX_PAR_BLOC) : 0;
+    
+    while (nb_jeux > 0) {
+        BlocLot *bloc = &blocs[courant];
+        
+        travail.bloc = bloc;
+        if (!preparer_bloc(&travail, bloc, &premieres[courant], &resultats[courant], &capacites[courant],
+                           pool_nb_ouvriers(pool))) {
+            fprintf(stderr, "Lot: memoire insuffisante\n");
+            code = 1;
+            break;
+        }
+        travail.premiere_recherche = premieres[courant];
+        travail.resultats = resultats[courant];
+        pool_lancer(pool, travail.premiere_recherche[nb_jeux], 4, effectuer_recherches, &travail);
+        
+        // Lecture du bloc suivant pendant les recherches du bloc courant
+        int suivant = lot_lire_bloc(&lecteur, &blocs[1 - courant], JEUX_PAR_BLOC);
+        pool_attendre(pool);
+        
+        for (int j = 0; j < nb_jeux; j++) {
+            ecrire_jeu(&travail, j, sortie, detail);
+        }
+        
+        courant = 1 - courant;
+        nb_jeux = suivant;
+    }
+    if (lecteur.erreur) {
+        code = 1;
+    }
+    
+    if (travail.ouvriers != NULL) {
+        for (int i = 0; i < pool_nb_ouvriers(pool); i++) {
+            free(travail.ouvriers[i].travail);
+        }
+        free(travail.ouvriers);
+    }
+    pool_detruire(pool);
+    for (int b = 0; b < 2; b++) {
+        free(premieres[b]);
+        free(resultats[b]);
+        lot_liberer_bloc(&blocs[b]);
+    }
+    lot_fermer(&lecteur);
+    return code;
+}
+
+// Fonction pour afficher l'aide de la ligne de commande
+static void afficher_usage(const char *programme) {
+    printf("Usage: %s --lot FICHIER [options]\n\n", programme);
+    printf("Analyse de sensibilite : facteur critique des durees d'execution, utilisation\n");
+    printf("limite et marge de chaque tache, par dichotomie sur les tests exacts (RTA, QPA).\n\n");
+    printf("  --lot FICHIER            jeux de taches (texte ou binaire)\n");
+    printf("  --algo hpf|rm|dm|edf|tous\n");
+    printf("                           algorithme analyse (defaut: tous)\n");
+    printf("  --sortie FICHIER         resume CSV par jeu et algorithme (defaut: sortie standard)\n");
+    printf("  --par-tache FICHIER      detail CSV des marges par tache\n");
+    printf("  --threads N              nombre de threads (defaut: nombre de coeurs)\n");
+}
+
+// Fonction pour ouvrir un fichier de sortie (sortie standard si chemin est NULL)
+static FILE *ouvrir_sortie(const char *chemin) {
+    FILE *fichier = chemin != NULL ? fopen(chemin, "w") : stdout;
+    
+    if (fichier == NULL) {
+        perror(chemin);
+    }
+    return fichier;
+}
+
+// Fonction pour fermer un fichier de sortie (false en cas d'erreur d'écriture)
+static bool fermer_sortie(FILE *fichier, const char *chemin) {
+    if (fichier != stdout && fclose(fichier) != 0) {
+        perror(chemin);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *chemin = NULL;
+    const char *chemin_sortie = NULL;
+    const char *chemin_detail = NULL;
+    bool algorithmes[NB_ALGORITHMES_SENSIBILITE] = { true, true, true, true };
+    int nb_threads = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(argv[0]);
+            return 0;
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            return 1;
+        } else if (strcmp(argv[i], "--lot") == 0) {
+            chemin = valeur;
+        } else if (strcmp(argv[i], "--sortie") == 0) {
+            chemin_sortie = valeur;
+        } else if (strcmp(argv[i], "--par-tache") == 0) {
+            chemin_detail = valeur;
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            nb_threads = atoi(valeur);
+        } else if (strcmp(argv[i], "--algo") == 0) {
+            bool tous = strcmp(valeur, "tous") == 0;
+            bool reconnu = tous;
+            for (int a = 0; a < NB_ALGORITHMES_SENSIBILITE; a++) {
+                algorithmes[a] = tous || strcmp(valeur, noms_algorithmes[a]) == 0;
+                reconnu = reconnu || algorithmes[a];
+            }
+            if (!reconnu) {
+                fprintf(stderr, "Algorithme inconnu: %s\n", valeur);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    
+    if (chemin == NULL) {
+        fprintf(stderr, "Option --lot obligatoire\n");
+        afficher_usage(argv[0]);
+        return 1;
+    }
+    FILE *sortie = ouvrir_sortie(chemin_sortie);
+    if (sortie == NULL) {
+        return 1;
+    }
+    FILE *detail = NULL;
+    if (chemin_detail != NULL && (detail = ouvrir_sortie(chemin_detail)) == NULL) {
+        fermer_sortie(sortie, chemin_sortie);
+        return 1;
+    }
+    
+    int code = executer_sensibilite(chemin, algorithmes, nb_threads, sortie, detail);
+    if (!fermer_sortie(sortie, chemin_sortie)) {
+        code = 1;
+    }
+    if (detail != NULL && !fermer_sortie(detail, chemin_detail)) {
+        code = 1;
+    }
+    return code;
+}
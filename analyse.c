@@ -0,0 +1,534 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "analyse.h"
+
+// Tâche associée à sa clé de tri (attribution des priorités)
+typedef struct {
+    long long cle;
+    int indice;
+} CleTri;
+
+// Fonction de comparaison pour qsort : clé croissante, puis indice croissant
+static int comparer_cles(const void *a, const void *b) {
+    const CleTri *x = a;
+    const CleTri *y = b;
+    
+    if (x->cle != y->cle) {
+        return x->cle < y->cle ? -1 : 1;
+    }
+    return x->indice < y->indice ? -1 : x->indice > y->indice;
+}
+
+// Fonction pour trier les indices des tâches par période ou par échéance croissante
+// (NULL si la mémoire manque)
+static CleTri *trier_taches(const ParametresTache *taches, int nb_taches, bool par_periode) {
+    CleTri *ordre = malloc((nb_taches > 0 ? nb_taches : 1) * sizeof(CleTri));
+    
+    if (ordre == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        ordre[i].cle = par_periode ? taches[i].periode : taches[i].echeance;
+        ordre[i].indice = i;
+    }
+    qsort(ordre, nb_taches, sizeof(CleTri), comparer_cles);
+    return ordre;
+}
+
+// Fonction pour attribuer les priorités uniques n..1 par clé croissante, en O(n log n)
+// À clé égale, la tâche de plus petit indice est la plus prioritaire (même
+// départage que la simulation). Sans mémoire, le rang est compté en O(n²).
+static void attribuer_par_rang(ParametresTache *taches, int nb_taches, bool par_periode) {
+    CleTri *ordre = trier_taches(taches, nb_taches, par_periode);
+    
+    if (ordre != NULL) {
+        for (int k = 0; k < nb_taches; k++) {
+            taches[ordre[k].indice].priorite = nb_taches - k;
+        }
+        free(ordre);
+        return;
+    }
+    
+    for (int i = 0; i < nb_taches; i++) {
+        temps_t cle_i = par_periode ? taches[i].periode : taches[i].echeance;
+        int rang = 0;
+        for (int j = 0; j < nb_taches; j++) {
+            temps_t cle_j = par_periode ? taches[j].periode : taches[j].echeance;
+            if (cle_j < cle_i || (cle_j == cle_i && j < i)) {
+                rang++;
+            }
+        }
+        taches[i].priorite = nb_taches - rang;
+    }
+}
+
+// Fonction pour calculer les priorités selon Rate Monotonic (plus courte période = plus haute priorité)
+void calculer_priorites_rm(ParametresTache *taches, int nb_taches) {
+    attribuer_par_rang(taches, nb_taches, true);
+}
+
+// Fonction pour calculer les priorités selon Deadline Monotonic (plus courte échéance = plus haute priorité)
+void calculer_priorites_dm(ParametresTache *taches, int nb_taches) {
+    attribuer_par_rang(taches, nb_taches, false);
+}
+
+// Fonction pour savoir si la tâche j passe avant la tâche i
+// (à priorité égale, le plus petit indice l'emporte comme dans la simulation)
+static inline bool est_prioritaire(const ParametresTache *taches, int j, int i) {
+    return taches[j].priorite > taches[i].priorite ||
+           (taches[j].priorite == taches[i].priorite && j < i);
+}
+
+// Fonction pour calculer le pire temps de réponse d'une tâche (priorités fixes)
+// Récurrence w = (q+1)C + Σ⌈w/Tj⌉Cj sur les instances q de la période d'activité
+// de niveau i, ce qui couvre aussi les échéances supérieures à la période.
+// Le calcul s'arrête dès que l'échéance est dépassée : la valeur renvoyée est
+// alors un minorant du temps de réponse, strictement supérieur à D (-1 si
+// l'utilisation de niveau i dépasse 1).
+long long temps_reponse_tache(const ParametresTache *taches, int nb_taches, int i) {
+    return temps_reponse_tache_blocage(taches, nb_taches, i, 0);
+}
+
+// Fonction pour calculer le pire temps de réponse d'une tâche qui peut être
+// bloquée par des tâches moins prioritaires (ressources partagées) :
+// w = B + (q+1)C + Σ⌈w/Tj⌉Cj, le blocage B étant subi une fois par période d'activité
+// Renvoie -1 (non borné) si la période d'activité de niveau i ne se termine
+// pas : utilisation de niveau i supérieure à 1, ou égale à 1 avec un blocage.
+long long temps_reponse_tache_blocage(const ParametresTache *taches, int nb_taches, int i, long long blocage) {
+    const ParametresTache *tache = &taches[i];
+    double utilisation = 0.0;
+    long long pire = 0;
+    long long w = blocage;
+    
+    for (int j = 0; j < nb_taches; j++) {
+        if (j == i || est_prioritaire(taches, j, i)) {
+            utilisation += (double)taches[j].duree_execution / taches[j].periode;
+        }
+    }
+    if (utilisation > 1.0 + 1e-12 || (blocage > 0 && utilisation > 1.0 - 1e-12)) {
+        return -1;
+    }
+    
+    for (long long q = 0; ; q++) {
+        // Point fixe pour l'instance q, en repartant du point fixe précédent
+        w += tache->duree_execution;
+        for (;;) {
+            long long total = blocage + (q + 1) * tache->duree_execution;
+            for (int j = 0; j < nb_taches; j++) {
+                if (j != i && est_prioritaire(taches, j, i)) {
+                    total += ((w + taches[j].periode - 1) / taches[j].periode) * taches[j].duree_execution;
+                }
+            }
+            if (total - q * tache->periode > tache->echeance) {
+                return total - q * tache->periode;
+            }
+            if (total == w) {
+                break;
+            }
+            w = total;
+        }
+        
+        if (w - q * tache->periode > pire) {
+            pire = w - q * tache->periode;
+        }
+        
+        // La période d'activité de niveau i se termine avant l'activation suivante
+        if (w <= (q + 1) * tache->periode) {
+            return pire;
+        }
+    }
+}
+
+// Fonction pour l'analyse des temps de réponse (RTA) de toutes les tâches
+// Renvoie vrai si chaque pire temps de réponse respecte l'échéance relative.
+// Si temps_reponse vaut NULL, seul le verdict est calculé (arrêt au premier échec).
+bool analyser_temps_reponse(const ParametresTache *taches, int nb_taches, long long *temps_reponse) {
+    return analyser_temps_reponse_blocage(taches, nb_taches, NULL, temps_reponse);
+}
+
+// Fonction pour l'analyse des temps de réponse avec un terme de blocage par
+// tâche (blocages NULL : tâches indépendantes). Un blocage négatif n'est pas
+// borné : la tâche est non faisable et son temps de réponse vaut -1.
+bool analyser_temps_reponse_blocage(const ParametresTache *taches, int nb_taches, const long long *blocages,
+                                    long long *temps_reponse) {
+    bool faisable = true;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        long long blocage = blocages != NULL ? blocages[i] : 0;
+        long long r = blocage < 0 ? -1 : temps_reponse_tache_blocage(taches, nb_taches, i, blocage);
+        if (temps_reponse != NULL) {
+            temps_reponse[i] = r;
+        }
+        if (r < 0 || r > taches[i].echeance) {
+            faisable = false;
+            if (temps_reponse == NULL) {
+                break;
+            }
+        }
+    }
+    
+    return faisable;
+}
+
+// Fonction pour calculer le pire temps de réponse de la tâche i lorsque toutes
+// les tâches de la liste interferentes (i exceptée) sont plus prioritaires
+// Même récurrence que temps_reponse_tache : seul l'ensemble compte, pas l'ordre.
+static long long temps_reponse_ensemble(const ParametresTache *taches, int i,
+                                        const int *interferentes, int nb_interferentes) {
+    const ParametresTache *tache = &taches[i];
+    long long pire = 0;
+    long long w = 0;
+    
+    for (long long q = 0; ; q++) {
+        w += tache->duree_execution;
+        for (;;) {
+            long long total = (q + 1) * tache->duree_execution;
+            for (int k = 0; k < nb_interferentes; k++) {
+                const ParametresTache *autre = &taches[interferentes[k]];
+                if (interferentes[k] != i) {
+                    total += ((w + autre->periode - 1) / autre->periode) * autre->duree_execution;
+                }
+            }
+            if (total - q * tache->periode > tache->echeance) {
+                return total - q * tache->periode;
+            }
+            if (total == w) {
+                break;
+            }
+            w = total;
+        }
+        
+        if (w - q * tache->periode > pire) {
+            pire = w - q * tache->periode;
+        }
+        if (w <= (q + 1) * tache->periode) {
+            return pire;
+        }
+    }
+}
+
+// Fonction pour attribuer les priorités par l'algorithme optimal d'Audsley (OPA)
+// Du niveau le plus bas au plus haut, on place une tâche non placée qui respecte
+// son échéance lorsque toutes les autres non placées sont plus prioritaires.
+// La RTA ne dépendant que de l'ensemble des tâches plus prioritaires, un ordre
+// faisable est trouvé dès qu'il en existe un. Les candidates sont essayées par
+// échéance décroissante (la première convient presque toujours) et deux tests
+// en O(1) précèdent la RTA : ΣC > D rejette (la première instance attend toutes
+// les autres), la borne de Bini et Baruah accepte.
+// Renvoie false, priorités inchangées, si aucun ordre n'est faisable (ou si la
+// mémoire manque) ; sinon les priorités vont de n (plus haute) à 1.
+bool calculer_priorites_audsley(ParametresTache *taches, int nb_taches) {
+    CleTri *ordre = trier_taches(taches, nb_taches, false);
+    int *restantes = malloc((nb_taches > 0 ? nb_taches : 1) * sizeof(int));
+    int *niveaux = malloc((nb_taches > 0 ? nb_taches : 1) * sizeof(int));
+    bool reussi = ordre != NULL && restantes != NULL && niveaux != NULL;
+    double somme_u = 0.0;     // Σ Cj/Tj des tâches non placées
+    double somme_s = 0.0;     // Σ Cj (1 - Cj/Tj) des tâches non placées
+    long long somme_c = 0;    // Σ Cj des tâches non placées
+    int nb_restantes = nb_taches;
+    
+    // Tâches non placées, par échéance décroissante
+    for (int k = 0; reussi && k < nb_taches; k++) {
+        const ParametresTache *tache = &taches[ordre[nb_taches - 1 - k].indice];
+        double u = (double)tache->duree_execution / tache->periode;
+        restantes[k] = ordre[nb_taches - 1 - k].indice;
+        somme_u += u;
+        somme_s += tache->duree_execution * (1.0 - u);
+        somme_c += tache->duree_execution;
+    }
+    
+    for (int niveau = 1; reussi && niveau <= nb_taches; niveau++) {
+        int choisie = -1;
+        
+        for (int k = 0; k < nb_restantes && choisie == -1; k++) {
+            const ParametresTache *tache = &taches[restantes[k]];
+            double u = (double)tache->duree_execution / tache->periode;
+            double u_autres = somme_u - u;
+            
+            if (somme_c > tache->echeance) {
+                continue;
+            }
+            // Borne du temps de réponse de la première instance ; si elle précède
+            // aussi la période, la période d'activité de niveau i s'arrête là
+            if (u_autres < 1.0 - 1e-9) {
+                double borne = (somme_s - tache->duree_execution * (1.0 - u) + tache->duree_execution) /
+                               (1.0 - u_autres);
+                double limite = tache->echeance < tache->periode ? tache->echeance : tache->periode;
+                if (borne * (1.0 + 1e-9) <= limite) {
+                    choisie = k;
+                    break;
+                }
+            }
+            if (temps_reponse_ensemble(taches, restantes[k], restantes, nb_restantes) <= tache->echeance) {
+                choisie = k;
+            }
+        }
+        
+        if (choisie == -1) {
+            reussi = false;
+            break;
+        }
+        const ParametresTache *tache = &taches[restantes[choisie]];
+        double u = (double)tache->duree_execution / tache->periode;
+        niveaux[restantes[choisie]] = niveau;
+        somme_u -= u;
+        somme_s -= tache->duree_execution * (1.0 - u);
+        somme_c -= tache->duree_execution;
+        nb_restantes--;
+        memmove(&restantes[choisie], &restantes[choisie + 1], (nb_restantes - choisie) * sizeof(int));
+    }
+    
+    if (reussi) {
+        for (int i = 0; i < nb_taches; i++) {
+            taches[i].priorite = niveaux[i];
+        }
+    }
+    free(ordre);
+    free(restantes);
+    free(niveaux);
+    return reussi;
+}
+
+// Fonction pour calculer le facteur d'utilisation U = Σ Ci/Ti
+double facteur_utilisation(const ParametresTache *taches, int nb_taches) {
+    double utilisation = 0.0;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        utilisation += (double)taches[i].duree_execution / taches[i].periode;
+    }
+    return utilisation;
+}
+
+// Fonction pour calculer la demande processeur h(t) des instances ayant
+// activation et échéance dans [0, t] (fonction de demande du scénario synchrone)
+long long demande_processeur(const ParametresTache *taches, int nb_taches, long long t) {
+    long long demande = 0;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (t >= taches[i].echeance) {
+            demande += ((t - taches[i].echeance) / taches[i].periode + 1) * taches[i].duree_execution;
+        }
+    }
+    
+    return demande;
+}
+
+// Fonction pour trouver la plus grande échéance absolue strictement inférieure à t
+// (0 si aucune échéance ne précède t)
+static long long echeance_precedente(const ParametresTache *taches, int nb_taches, long long t) {
+    long long precedente = 0;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].echeance < t) {
+            long long d = ((t - taches[i].echeance - 1) / taches[i].periode) * taches[i].periode + 
+                          taches[i].echeance;
+            if (d > precedente) {
+                precedente = d;
+            }
+        }
+    }
+    
+    return precedente;
+}
+
+// Fonction pour trouver la plus petite échéance absolue strictement supérieure à t
+static long long echeance_suivante(const ParametresTache *taches, int nb_taches, long long t) {
+    long long suivante = LLONG_MAX;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        long long d = taches[i].echeance;
+        if (d <= t) {
+            d += ((t - taches[i].echeance) / taches[i].periode + 1) * taches[i].periode;
+        }
+        if (d < suivante) {
+            suivante = d;
+        }
+    }
+    
+    return suivante;
+}
+
+// Fonction pour calculer la longueur de la première période d'activité synchrone
+// (point fixe de w = Σ⌈w/Ti⌉Ci, qui existe lorsque U <= 1) ; -1 si elle dépasse borne
+long long periode_activite_synchrone(const ParametresTache *taches, int nb_taches, long long borne) {
+    long long w = 0;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        w += taches[i].duree_execution;
+    }
+    
+    for (;;) {
+        long long total = 0;
+        for (int i = 0; i < nb_taches; i++) {
+            total += ((w + taches[i].periode - 1) / taches[i].periode) * taches[i].duree_execution;
+        }
+        if (total == w) {
+            return w;
+        }
+        if (total > borne) {
+            return -1;
+        }
+        w = total;
+    }
+}
+
+// Fonction pour le test exact d'ordonnançabilité EDF (Quick Processor-demand Analysis)
+// Seules les échéances de la première période d'activité synchrone sont examinées,
+// en remontant depuis la dernière d'entre elles. En cas d'échec, intervalle_violation
+// reçoit la plus petite longueur t telle que h(t) > t (s'il n'est pas NULL).
+bool analyser_qpa(const ParametresTache *taches, int nb_taches, long long *intervalle_violation) {
+    double utilisation = facteur_utilisation(taches, nb_taches);
+    long long echeance_min = LLONG_MAX;
+    
+    if (intervalle_violation != NULL) {
+        *intervalle_violation = 0;
+    }
+    if (nb_taches == 0) {
+        return true;
+    }
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].echeance < echeance_min) {
+            echeance_min = taches[i].echeance;
+        }
+    }
+    
+    bool faisable = true;
+    
+    if (utilisation > 1.0 + 1e-12) {
+        // La demande finit toujours par dépasser le temps disponible
+        faisable = false;
+    } else {
+        // Borne de l'intervalle à examiner : période d'activité synchrone,
+        // ou borne de Baruah (La) lorsqu'elle est plus petite
+        long long borne = periode_activite_synchrone(taches, nb_taches, LLONG_MAX);
+        if (utilisation < 1.0 - 1e-12) {
+            double somme = 0.0;
+            long long echeance_max = 0;
+            for (int i = 0; i < nb_taches; i++) {
+                somme += (double)(taches[i].periode - taches[i].echeance) * taches[i].duree_execution / 
+                         taches[i].periode;
+                if (taches[i].echeance > echeance_max) {
+                    echeance_max = taches[i].echeance;
+                }
+            }
+            double la = somme / (1.0 - utilisation);
+            long long borne_la = la > (double)echeance_max ? (long long)la + 1 : echeance_max + 1;
+            if (borne_la < borne) {
+                borne = borne_la;
+            }
+        }
+        
+        long long t = echeance_precedente(taches, nb_taches, borne);
+        long long h = demande_processeur(taches, nb_taches, t);
+        while (h <= t && h > echeance_min) {
+            t = h < t ? h : echeance_precedente(taches, nb_taches, t);
+            h = demande_processeur(taches, nb_taches, t);
+        }
+        faisable = h <= echeance_min;
+    }
+    
+    if (!faisable && intervalle_violation != NULL) {
+        // Recherche de la première échéance en défaut, en avançant depuis 0
+        long long d = echeance_suivante(taches, nb_taches, 0);
+        while (demande_processeur(taches, nb_taches, d) <= d) {
+            d = echeance_suivante(taches, nb_taches, d);
+        }
+        *intervalle_violation = d;
+    }
+    
+    return faisable;
+}
+
+// Fonction pour le test EDF avec un terme de blocage : h(t) + B(t) <= t pour
+// toute longueur t (ressources partagées, préemption limitée). B(t) doit être
+// nul à partir de la plus grande échéance relative Dmax : QPA conclut pour ces
+// longueurs, les échéances absolues inférieures à Dmax sont examinées une à
+// une. En cas d'échec, intervalle_violation reçoit la plus petite longueur en
+// défaut (s'il n'est pas NULL).
+bool analyser_qpa_blocage(const ParametresTache *taches, int nb_taches, FonctionBlocage blocage,
+                          const void *contexte, long long *intervalle_violation) {
+    long long violation = 0;
+    long long premiere = LLONG_MAX;
+    long long echeance_max = 0;
+    bool faisable = analyser_qpa(taches, nb_taches, &violation);
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].echeance > echeance_max) {
+            echeance_max = taches[i].echeance;
+        }
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        for (long long d = taches[i].echeance; d < echeance_max && d < premiere; d += taches[i].periode) {
+            if (demande_processeur(taches, nb_taches, d) + blocage(contexte, taches, nb_taches, d) > d) {
+                premiere = d;
+            }
+        }
+    }
+    
+    if (premiere != LLONG_MAX) {
+        violation = faisable || premiere < violation ? premiere : violation;
+        faisable = false;
+    }
+    if (intervalle_violation != NULL) {
+        *intervalle_violation = violation;
+    }
+    return faisable;
+}
+
+// Fonction pour calculer le PGCD de deux entiers positifs
+static long long pgcd(long long a, long long b) {
+    while (b != 0) {
+        long long r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+// Fonction pour calculer l'hyperpériode (PPCM des périodes)
+// Renvoie false si le PPCM dépasse la capacité d'un entier 64 bits.
+bool hyperperiode(const ParametresTache *taches, int nb_taches, long long *resultat) {
+    long long h = 1;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        long long t = taches[i].periode;
+        long long facteur = t / pgcd(h, t);
+        if (h > LLONG_MAX / facteur) {
+            return false;
+        }
+        h *= facteur;
+    }
+    *resultat = h;
+    return true;
+}
+
+// Fonction pour calculer l'horizon de simulation suffisant pour conclure
+// Activations synchrones et D <= T : l'ordonnancement se répète à chaque
+// hyperpériode H, [0, H] suffit. Sinon des instances peuvent déborder d'une
+// hyperpériode sur la suivante : il faut simuler [0, Omax + 2H] (Leung et
+// Merrill), Omax étant le plus grand décalage d'activation. Renvoie -1 en cas
+// de dépassement.
+long long horizon_simulation(const ParametresTache *taches, int nb_taches) {
+    long long h;
+    long long decalage_max = 0;
+    bool echeances_contraintes = true;
+    
+    if (!hyperperiode(taches, nb_taches, &h)) {
+        return -1;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].echeance > taches[i].periode) {
+            echeances_contraintes = false;
+        }
+        if (taches[i].decalage > decalage_max) {
+            decalage_max = taches[i].decalage;
+        }
+    }
+    if (echeances_contraintes && decalage_max == 0) {
+        return h;
+    }
+    return h > (LLONG_MAX - decalage_max) / 2 ? -1 : decalage_max + 2 * h;
+}
@@ -0,0 +1,35 @@
+#ifndef ANALYSE_H
+#define ANALYSE_H
+
+#include <stdbool.h>
+#include "tache.h"
+
+// Attribution des priorités (plus grand = plus prioritaire)
+void calculer_priorites_rm(ParametresTache *taches, int nb_taches);
+void calculer_priorites_dm(ParametresTache *taches, int nb_taches);
+bool calculer_priorites_audsley(ParametresTache *taches, int nb_taches);
+
+// Analyse des temps de réponse pour les ordonnanceurs à priorités fixes (HPF, RM, DM)
+long long temps_reponse_tache(const ParametresTache *taches, int nb_taches, int i);
+bool analyser_temps_reponse(const ParametresTache *taches, int nb_taches, long long *temps_reponse);
+long long temps_reponse_tache_blocage(const ParametresTache *taches, int nb_taches, int i, long long blocage);
+bool analyser_temps_reponse_blocage(const ParametresTache *taches, int nb_taches, const long long *blocages,
+                                    long long *temps_reponse);
+
+// Analyse de la demande processeur pour EDF
+double facteur_utilisation(const ParametresTache *taches, int nb_taches);
+long long demande_processeur(const ParametresTache *taches, int nb_taches, long long t);
+long long periode_activite_synchrone(const ParametresTache *taches, int nb_taches, long long borne);
+bool analyser_qpa(const ParametresTache *taches, int nb_taches, long long *intervalle_violation);
+
+// Terme de blocage B(t) d'un test EDF, nul à partir de la plus grande échéance relative
+typedef long long (*FonctionBlocage)(const void *contexte, const ParametresTache *taches, int nb_taches,
+                                     long long t);
+bool analyser_qpa_blocage(const ParametresTache *taches, int nb_taches, FonctionBlocage blocage,
+                          const void *contexte, long long *intervalle_violation);
+
+// Hyperpériode et horizon de simulation
+bool hyperperiode(const ParametresTache *taches, int nb_taches, long long *resultat);
+long long horizon_simulation(const ParametresTache *taches, int nb_taches);
+
+#endif
@@ -0,0 +1,273 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "tache.h"
+#include "analyse.h"
+#include "generateur-taches.h"
+#include "lot-taches.h"
+
+// Algorithmes évalués par le banc d'essai
+typedef enum {
+    BANC_HPF,
+    BANC_RM,
+    BANC_DM,
+    BANC_OPA,
+    BANC_EDF,
+    NB_ALGORITHMES_BANC
+} AlgorithmeBanc;
+
+static const char *noms_algorithmes[NB_ALGORITHMES_BANC] = { "hpf", "rm", "dm", "opa", "edf" };
+
+// Configuration du balayage
+typedef struct {
+    uint64_t graine;
+    int jeux_par_point;
+    int *nb_taches;           // Liste des nombres de tâches balayés
+    int nb_valeurs_taches;
+    double utilisation_min;
+    double utilisation_max;
+    double pas_utilisation;
+    temps_t periode_min;
+    temps_t periode_max;
+    double ratio_echeance_min;
+    double ratio_echeance_max;
+    const char *chemin_export; // Jeux générés au format lot binaire (optionnel)
+} ConfigurationBanc;
+
+// Fonction pour lire l'horloge monotone en secondes
+static double maintenant(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Fonction pour décider un jeu avec l'algorithme demandé
+// (copie de travail nécessaire car RM et DM écrivent les priorités)
+static bool jeu_accepte(AlgorithmeBanc algorithme, const ParametresTache *jeu, 
+                        ParametresTache *copie, int nb_taches) {
+    switch (algorithme) {
+        case BANC_HPF:
+            return analyser_temps_reponse(jeu, nb_taches, NULL);
+        case BANC_RM:
+            memcpy(copie, jeu, nb_taches * sizeof(ParametresTache));
+            calculer_priorites_rm(copie, nb_taches);
+            return analyser_temps_reponse(copie, nb_taches, NULL);
+        case BANC_DM:
+            memcpy(copie, jeu, nb_taches * sizeof(ParametresTache));
+            calculer_priorites_dm(copie, nb_taches);
+            return analyser_temps_reponse(copie, nb_taches, NULL);
+        case BANC_OPA:
+            // Audsley ne réussit que s'il trouve un ordre faisable (au sens de la RTA)
+            memcpy(copie, jeu, nb_taches * sizeof(ParametresTache));
+            return calculer_priorites_audsley(copie, nb_taches);
+        default:
+            return analyser_qpa(jeu, nb_taches, NULL);
+    }
+}
+
+// Fonction pour lire une liste d'entiers séparés par des virgules
+static int lire_liste(const char *texte, int **valeurs) {
+    int nb = 0;
+    const char *p = texte;
+    
+    *valeurs = malloc((strlen(texte) / 2 + 1) * sizeof(int));
+    while (*p != '\0') {
+        char *fin;
+        long v = strtol(p, &fin, 10);
+        if (fin == p || v <= 0) {
+            return -1;
+        }
+        (*valeurs)[nb++] = (int)v;
+        p = *fin == ',' ? fin + 1 : fin;
+        if (*fin != ',' && *fin != '\0') {
+            return -1;
+        }
+    }
+    return nb;
+}
+
+// Fonction pour lire un couple "min:max" de réels
+static bool lire_intervalle(const char *texte, double *min, double *max) {
+    return sscanf(texte, "%lf:%lf", min, max) == 2 && *min <= *max;
+}
+
+// Fonction pour afficher l'aide de la ligne de commande
+static void afficher_usage(const char *programme) {
+    printf("Usage: %s [options]\n\n", programme);
+    printf("Balayage utilisation x nombre de taches sur des jeux generes par UUniFast-discard,\n");
+    printf("taux d'acceptation HPF/RM/DM (RTA), OPA (Audsley) et EDF (QPA), puis debit des analyses.\n\n");
+    printf("  --graine N               graine du generateur (defaut: 1)\n");
+    printf("  --jeux N                 jeux par point (defaut: 1000)\n");
+    printf("  --taches LISTE           nombres de taches, ex. 4,8,16 (defaut: 4,8,16,32)\n");
+    printf("  --utilisation MIN:MAX:PAS (defaut: 0.5:1.0:0.05)\n");
+    printf("  --periodes MIN:MAX       periodes log-uniformes (defaut: 10:100000)\n");
+    printf("  --echeances MIN:MAX      rapport D/T uniforme (defaut: 1:1)\n");
+    printf("  --exporter FICHIER       ecrire aussi les jeux generes au format lot binaire\n");
+}
+
+// Fonction pour analyser la ligne de commande
+static bool lire_configuration(int argc, char **argv, ConfigurationBanc *configuration) {
+    static int taches_defaut[] = { 4, 8, 16, 32 };
+    
+    *configuration = (ConfigurationBanc){
+        .graine = 1, .jeux_par_point = 1000,
+        .nb_taches = taches_defaut, .nb_valeurs_taches = 4,
+        .utilisation_min = 0.5, .utilisation_max = 1.0, .pas_utilisation = 0.05,
+        .periode_min = 10, .periode_max = 100000,
+        .ratio_echeance_min = 1.0, .ratio_echeance_max = 1.0,
+        .chemin_export = NULL
+    };
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(argv[0]);
+            exit(0);
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            return false;
+        } else if (strcmp(argv[i], "--graine") == 0) {
+            configuration->graine = strtoull(valeur, NULL, 10);
+        } else if (strcmp(argv[i], "--jeux") == 0) {
+            configuration->jeux_par_point = atoi(valeur);
+        } else if (strcmp(argv[i], "--taches") == 0) {
+            configuration->nb_valeurs_taches = lire_liste(valeur, &configuration->nb_taches);
+        } else if (strcmp(argv[i], "--utilisation") == 0) {
+            if (sscanf(valeur, "%lf:%lf:%lf", &configuration->utilisation_min,
+                       &configuration->utilisation_max, &configuration->pas_utilisation) != 3 ||
+                configuration->pas_utilisation <= 0.0) {
+                fprintf(stderr, "Utilisation invalide: %s\n", valeur);
+                return false;
+            }
+        } else if (strcmp(argv[i], "--periodes") == 0) {
+            if (sscanf(valeur, "%lld:%lld", &configuration->periode_min, &configuration->periode_max) != 2 ||
+                configuration->periode_min <= 0 || configuration->periode_min > configuration->periode_max ||
+                configuration->periode_max > TEMPS_PARAMETRE_MAX) {
+                fprintf(stderr, "Periodes invalides: %s\n", valeur);
+                return false;
+            }
+        } else if (strcmp(argv[i], "--echeances") == 0) {
+            if (!lire_intervalle(valeur, &configuration->ratio_echeance_min, &configuration->ratio_echeance_max) ||
+                configuration->ratio_echeance_min <= 0.0) {
+                fprintf(stderr, "Rapport D/T invalide: %s\n", valeur);
+                return false;
+            }
+        } else if (strcmp(argv[i], "--exporter") == 0) {
+            configuration->chemin_export = valeur;
+        } else {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            afficher_usage(argv[0]);
+            return false;
+        }
+        i++;
+    }
+    
+    if (configuration->jeux_par_point <= 0 || configuration->nb_valeurs_taches <= 0) {
+        fprintf(stderr, "Nombre de jeux ou liste de taches invalide\n");
+        return false;
+    }
+    // Le format lot binaire stocke les durées sur 32 bits
+    if (configuration->chemin_export != NULL && configuration->periode_max > INT32_MAX) {
+        fprintf(stderr, "Export binaire limite aux periodes de %d ticks\n", INT32_MAX);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    ConfigurationBanc configuration;
+    
+    if (!lire_configuration(argc, argv, &configuration)) {
+        return 1;
+    }
+    
+    int taches_max = 0;
+    for (int k = 0; k < configuration.nb_valeurs_taches; k++) {
+        if (configuration.nb_taches[k] > taches_max) {
+            taches_max = configuration.nb_taches[k];
+        }
+    }
+    
+    // Tous les jeux d'un point sont générés avant d'être analysés,
+    // afin que la mesure de débit ne compte que les analyses
+    ParametresTache *jeux = malloc((size_t)configuration.jeux_par_point * taches_max * sizeof(ParametresTache));
+    ParametresTache *copie = malloc(taches_max * sizeof(ParametresTache));
+    double *utilisations = malloc(taches_max * sizeof(double));
+    if (jeux == NULL || copie == NULL || utilisations == NULL) {
+        fprintf(stderr, "Memoire insuffisante\n");
+        return 1;
+    }
+    
+    FILE *export = NULL;
+    if (configuration.chemin_export != NULL) {
+        export = fopen(configuration.chemin_export, "wb");
+        if (export == NULL || !lot_ecrire_entete_binaire(export)) {
+            perror(configuration.chemin_export);
+            return 1;
+        }
+    }
+    
+    double duree_totale[NB_ALGORITHMES_BANC] = { 0.0 };
+    long long taches_analysees = 0;
+    int nb_points_utilisation = (int)((configuration.utilisation_max - configuration.utilisation_min) / 
+                                      configuration.pas_utilisation + 1e-9) + 1;
+    
+    printf("taches,utilisation,jeux,hpf,rm,dm,opa,edf\n");
+    for (int k = 0; k < configuration.nb_valeurs_taches; k++) {
+        int n = configuration.nb_taches[k];
+        
+        for (int p = 0; p < nb_points_utilisation; p++) {
+            double utilisation = configuration.utilisation_min + p * configuration.pas_utilisation;
+            ParametresGeneration generation = {
+                n, utilisation, configuration.periode_min, configuration.periode_max,
+                configuration.ratio_echeance_min, configuration.ratio_echeance_max
+            };
+            GenerateurAleatoire alea;
+            
+            // Graine propre au point : un point donne les mêmes jeux quel que soit le balayage
+            alea_initialiser(&alea, configuration.graine ^ ((uint64_t)n << 32) ^ (uint64_t)p);
+            int nb_jeux = 0;
+            for (int j = 0; j < configuration.jeux_par_point; j++) {
+                if (generer_jeu(&alea, &generation, jeux + (size_t)nb_jeux * n, utilisations)) {
+                    if (export != NULL) {
+                        lot_ecrire_jeu_binaire(export, jeux + (size_t)nb_jeux * n, n);
+                    }
+                    nb_jeux++;
+                }
+            }
+            
+            int acceptes[NB_ALGORITHMES_BANC] = { 0 };
+            for (int a = 0; a < NB_ALGORITHMES_BANC; a++) {
+                double debut = maintenant();
+                for (int j = 0; j < nb_jeux; j++) {
+                    acceptes[a] += jeu_accepte((AlgorithmeBanc)a, jeux + (size_t)j * n, copie, n);
+                }
+                duree_totale[a] += maintenant() - debut;
+            }
+            taches_analysees += (long long)nb_jeux * n;
+            
+            printf("%d,%.3f,%d", n, utilisation, nb_jeux);
+            for (int a = 0; a < NB_ALGORITHMES_BANC; a++) {
+                printf(",%.4f", nb_jeux > 0 ? (double)acceptes[a] / nb_jeux : 0.0);
+            }
+            printf("\n");
+        }
+    }
+    
+    printf("\n# debit des analyses (taches analysees par seconde, un thread)\n");
+    for (int a = 0; a < NB_ALGORITHMES_BANC; a++) {
+        printf("# %s: %.0f taches/s (%.3f s)\n", noms_algorithmes[a], 
+               duree_totale[a] > 0.0 ? taches_analysees / duree_totale[a] : 0.0, duree_totale[a]);
+    }
+    
+    if (export != NULL && fclose(export) != 0) {
+        perror(configuration.chemin_export);
+    }
+    free(jeux);
+    free(copie);
+    free(utilisations);
+    return 0;
+}
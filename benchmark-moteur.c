@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "tas.h"
+#include "moteur-simulation.h"
+#include "generateur-taches.h"
+
+// Opérations chronométrées par répétition d'une micro-mesure des tas
+#define OPERATIONS_TAS (1 << 20)
+
+// Nombre maximal de mesures lues dans un fichier de référence
+#define MESURES_REFERENCE_MAX 4096
+
+// Utilisation des jeux simulés (sous 1 pour que l'arriéré reste borné)
+#define UTILISATION_SIMULATION 0.8
+
+// Mesure d'un chemin du moteur : temps par opération (minimum et médiane des
+// répétitions) et somme de contrôle des résultats, identique d'une compilation
+// à l'autre pour une même graine
+typedef struct {
+    char nom[32];
+    int taches;
+    int horizon;              // Durée simulée (0 : micro-mesure d'un tas)
+    long long operations;     // Opérations par répétition (activations pour une simulation)
+    double ns_min;
+    double ns_median;
+    long long controle;
+} MesureMoteur;
+
+// Simulations mesurées : une par spécialisation du moteur
+static const TypeOrdonnanceur algorithmes_simules[] = { RM, EDF, FIFO };
+static const char *noms_simules[] = { "simulation_rm", "simulation_edf", "simulation_fifo" };
+#define NB_SIMULATIONS ((int)(sizeof(algorithmes_simules) / sizeof(algorithmes_simules[0])))
+
+// Fonction pour lire l'horloge monotone en secondes
+static double maintenant(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Fonction pour lire une liste d'entiers séparés par des virgules
+static int lire_liste(const char *texte, int **valeurs) {
+    int nb = 0;
+    const char *p = texte;
+    
+    *valeurs = malloc((strlen(texte) / 2 + 1) * sizeof(int));
+    while (*p != '\0') {
+        char *fin;
+        long v = strtol(p, &fin, 10);
+        if (fin == p || v <= 0) {
+            return -1;
+        }
+        (*valeurs)[nb++] = (int)v;
+        p = *fin == ',' ? fin + 1 : fin;
+        if (*fin != ',' && *fin != '\0') {
+            return -1;
+        }
+    }
+    return nb;
+}
+
+// Fonction pour choisir la tâche modifiée à chaque opération, comme le ferait
+// un événement de la simulation
+static inline int tache_modifiee(long long operation, int nb_taches) {
+    return (int)((operation * 7919LL) % nb_taches);
+}
+
+// Fonction de comparaison pour le tri des durées
+static int comparer_durees(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Fonction pour résumer les durées des répétitions (secondes) en ns par opération
+static void resumer(MesureMoteur *mesure, double *durees, int repetitions) {
+    qsort(durees, repetitions, sizeof(double), comparer_durees);
+    mesure->ns_min = durees[0] * 1e9 / mesure->operations;
+    mesure->ns_median = (repetitions % 2 == 1 ? durees[repetitions / 2] :
+                         (durees[repetitions / 2 - 1] + durees[repetitions / 2]) / 2) * 1e9 / mesure->operations;
+}
+
+// Fonction pour mesurer la sélection par échéance (EDF) : l'échéance de la
+// première instance d'une tâche avance (tas_modifier), puis le sommet est élu
+static void mesurer_selection_echeance(GenerateurAleatoire *alea, int nb_taches, int repetitions,
+                                       double *durees, MesureMoteur *mesure) {
+    long long *cles = malloc(nb_taches * sizeof(long long));
+    Tas pret;
+    
+    tas_initialiser(&pret, nb_taches);
+    for (int i = 0; i < nb_taches; i++) {
+        cles[i] = (long long)(alea_suivant(alea) % 1000);
+        tas_inserer(&pret, i, cles[i]);
+    }
+    
+    for (int r = 0; r < repetitions; r++) {
+        double debut = maintenant();
+        for (long long k = 0; k < OPERATIONS_TAS; k++) {
+            int i = tache_modifiee(k, nb_taches);
+            cles[i] += 1 + (unsigned)(k * 2654435761u) % 1000;
+            tas_modifier(&pret, i, cles[i]);
+            mesure->controle += tas_sommet(&pret);
+        }
+        durees[r] = maintenant() - debut;
+    }
+    
+    tas_liberer(&pret);
+    free(cles);
+}
+
+// Fonction pour mesurer la sélection par priorité (priorités fixes) : une tâche
+// entre dans la file des prêtes ou en sort (activation, terminaison), puis le
+// sommet est élu
+static void mesurer_selection_priorite(GenerateurAleatoire *alea, int nb_taches, int repetitions,
+                                       double *durees, MesureMoteur *mesure) {
+    int *priorites = malloc(nb_taches * sizeof(int));
+    Tas pret;
+    
+    tas_initialiser(&pret, nb_taches);
+    for (int i = 0; i < nb_taches; i++) {
+        priorites[i] = (int)(alea_suivant(alea) % (4u * nb_taches));
+        if (alea_suivant(alea) % 2 == 0) {
+            tas_inserer(&pret, i, -(long long)priorites[i]);
+        }
+    }
+    
+    for (int r = 0; r < repetitions; r++) {
+        double debut = maintenant();
+        for (long long k = 0; k < OPERATIONS_TAS; k++) {
+            int i = tache_modifiee(k, nb_taches);
+            if (tas_contient(&pret, i)) {
+                tas_retirer(&pret, i);
+            } else {
+                tas_inserer(&pret, i, -(long long)priorites[i]);
+            }
+            mesure->controle += tas_sommet(&pret);
+        }
+        durees[r] = maintenant() - debut;
+    }
+    
+    tas_liberer(&pret);
+    free(priorites);
+}
+
+// Fonction pour mesurer les activations : la tâche au sommet du tas des
+// activations est réactivée une période plus tard (chemin de activer_taches)
+static void mesurer_activations(GenerateurAleatoire *alea, int nb_taches, int repetitions,
+                                double *durees, MesureMoteur *mesure) {
+    long long *prochaines = malloc(nb_taches * sizeof(long long));
+    int *periodes = malloc(nb_taches * sizeof(int));
+    Tas activations;
+    
+    tas_initialiser(&activations, nb_taches);
+    for (int i = 0; i < nb_taches; i++) {
+        periodes[i] = 10 + (int)(alea_suivant(alea) % 1000);
+        prochaines[i] = 0;
+        tas_inserer(&activations, i, 0);
+    }
+    
+    for (int r = 0; r < repetitions; r++) {
+        double debut = maintenant();
+        for (long long k = 0; k < OPERATIONS_TAS; k++) {
+            int i = tas_sommet(&activations);
+            prochaines[i] += periodes[i];
+            tas_modifier(&activations, i, prochaines[i]);
+            mesure->controle += i;
+        }
+        durees[r] = maintenant() - debut;
+    }
+    
+    tas_liberer(&activations);
+    free(periodes);
+    free(prochaines);
+}
+
+// Fonction pour mesurer une simulation complète de l'horizon donné
+// La détection de cycle est désactivée (hyperpériode nulle) pour que toutes
+// les répétitions simulent la même durée ; les instances en retard sont
+// abandonnées, l'arriéré reste donc borné même si le jeu n'est pas faisable.
+// Le temps est rapporté au nombre d'activations simulées.
+static bool mesurer_simulation(TypeOrdonnanceur algorithme, const ParametresTache *jeu, int nb_taches,
+                               int horizon, int repetitions, double *durees, MesureMoteur *mesure) {
+    Systeme systeme = { 0 };
+    ParametresTache *parametres = malloc(nb_taches * sizeof(ParametresTache));
+    
+    systeme.taches = malloc(nb_taches * sizeof(Tache));
+    if (parametres == NULL || systeme.taches == NULL) {
+        free(parametres);
+        free(systeme.taches);
+        return false;
+    }
+    memcpy(parametres, jeu, nb_taches * sizeof(ParametresTache));
+    systeme.algorithme = algorithme;
+    systeme.politique_echec = ECHEC_ABANDONNER;
+    configurer_systeme(&systeme, parametres, nb_taches);
+    systeme.hyperperiode = 0;
+    
+    for (int r = 0; r < repetitions; r++) {
+        // Les files sont réinitialisées par la simulation, pas les tâches
+        // (réinitialisées avec leurs propres paramètres, déjà en ticks compressés)
+        for (int i = 0; i < nb_taches; i++) {
+            Tache *tache = &systeme.taches[i];
+            initialiser_tache(tache, tache->id, tache->duree_execution, tache->echeance,
+                              tache->periode, tache->priorite, tache->decalage);
+        }
+        double debut = maintenant();
+        bool faisable = simuler_ordonnancement(&systeme, horizon);
+        durees[r] = maintenant() - debut;
+        
+        long long activations = 0;
+        for (int i = 0; i < nb_taches; i++) {
+            activations += systeme.taches[i].instance;
+            mesure->controle += (i + 1LL) * systeme.taches[i].en_attente;
+        }
+        mesure->operations = activations > 0 ? activations : 1;
+        mesure->controle += 2 * activations + faisable;
+    }
+    
+    liberer_files(&systeme);
+    free(systeme.taches);
+    free(parametres);
+    return true;
+}
+
+// Fonction pour écrire une mesure (une ligne par mesure, relue par lire_reference)
+static void ecrire_mesure(FILE *sortie, const MesureMoteur *mesure, bool derniere) {
+    fprintf(sortie, "    {\"nom\": \"%s\", \"taches\": %d, \"horizon\": %d, \"operations\": %lld, "
+            "\"ns_min\": %.3f, \"ns_median\": %.3f, \"controle\": %lld}%s\n",
+            mesure->nom, mesure->taches, mesure->horizon, mesure->operations,
+            mesure->ns_min, mesure->ns_median, mesure->controle, derniere ? "" : ",");
+}
+
+// Fonction pour lire les mesures d'un fichier JSON écrit par ce programme
+// Renvoie le nombre de mesures lues (-1 si le fichier ne peut pas être ouvert).
+static int lire_reference(const char *chemin, MesureMoteur *mesures, int max, unsigned long long *graine) {
+    FILE *fichier = fopen(chemin, "r");
+    char ligne[512];
+    int nb = 0;
+    
+    if (fichier == NULL) {
+        return -1;
+    }
+    while (fgets(ligne, sizeof(ligne), fichier) != NULL && nb < max) {
+        const char *debut = strstr(ligne, "{\"nom\"");
+        const char *champ_graine = strstr(ligne, "\"graine\":");
+        MesureMoteur *mesure = &mesures[nb];
+        
+        if (champ_graine != NULL) {
+            sscanf(champ_graine, "\"graine\": %llu", graine);
+        } else if (debut != NULL &&
+                   sscanf(debut, "{\"nom\": \"%31[^\"]\", \"taches\": %d, \"horizon\": %d, "
+                          "\"operations\": %lld, \"ns_min\": %lf, \"ns_median\": %lf, \"controle\": %lld",
+                          mesure->nom, &mesure->taches, &mesure->horizon, &mesure->operations,
+                          &mesure->ns_min, &mesure->ns_median, &mesure->controle) == 7) {
+            nb++;
+        }
+    }
+    fclose(fichier);
+    return nb;
+}
+
+// Fonction pour comparer les mesures à une référence (temps minimaux)
+// Renvoie false si une mesure ralentit de plus de la tolérance, ou si ses
+// résultats diffèrent alors que la graine est la même.
+static bool comparer_reference(const MesureMoteur *mesures, int nb_mesures,
+                               const MesureMoteur *reference, int nb_reference,
+                               bool meme_graine, double tolerance) {
+    bool conforme = true;
+    
+    fprintf(stderr, "\nComparaison avec la reference (tolerance %.0f%%)\n", tolerance * 100);
+    for (int i = 0; i < nb_mesures; i++) {
+        const MesureMoteur *mesure = &mesures[i];
+        
+        for (int j = 0; j < nb_reference; j++) {
+            const MesureMoteur *ancienne = &reference[j];
+            if (strcmp(ancienne->nom, mesure->nom) != 0 || ancienne->taches != mesure->taches ||
+                ancienne->horizon != mesure->horizon) {
+                continue;
+            }
+            double variation = mesure->ns_min / ancienne->ns_min - 1.0;
+            bool regression = variation > tolerance;
+            bool resultats_differents = meme_graine && ancienne->controle != mesure->controle;
+            
+            fprintf(stderr, "  %-24s n=%-7d h=%-10d %10.1f -> %10.1f ns (%+6.1f%%)%s%s\n",
+                    mesure->nom, mesure->taches, mesure->horizon, ancienne->ns_min, mesure->ns_min,
+                    variation * 100, regression ? "  REGRESSION" : "",
+                    resultats_differents ? "  RESULTATS DIFFERENTS" : "");
+            conforme = conforme && !regression && !resultats_differents;
+            break;
+        }
+    }
+    return conforme;
+}
+
+// Fonction pour afficher l'aide de la ligne de commande
+static void afficher_usage(const char *programme) {
+    printf("Usage: %s [options]\n\n", programme);
+    printf("Temps par operation (ns, minimum et mediane des repetitions) des chemins\n");
+    printf("critiques du moteur : selection par echeance et par priorite, activations,\n");
+    printf("puis simulations completes RM, EDF et FIFO (ns par activation simulee).\n");
+    printf("Les resultats sont ecrits en JSON.\n\n");
+    printf("  --graine N               graine du generateur (defaut: 1)\n");
+    printf("  --taches LISTE           nombres de taches (defaut: 10,100,1000)\n");
+    printf("  --horizons LISTE         durees simulees (defaut: 100000,1000000,10000000)\n");
+    printf("  --repetitions N          repetitions de chaque mesure (defaut: 5)\n");
+    printf("  --sortie FICHIER         fichier JSON (defaut: sortie standard)\n");
+    printf("  --reference FICHIER      resultats JSON de reference : code de retour 1\n");
+    printf("                           si une mesure ralentit au-dela de la tolerance\n");
+    printf("  --tolerance X            ralentissement tolere (defaut: 0.10)\n");
+}
+
+int main(int argc, char **argv) {
+    static int taches_defaut[] = { 10, 100, 1000 };
+    static int horizons_defaut[] = { 100000, 1000000, 10000000 };
+    int *nb_taches = taches_defaut;
+    int *horizons = horizons_defaut;
+    int nb_valeurs_taches = 3;
+    int nb_horizons = 3;
+    int repetitions = 5;
+    unsigned long long graine = 1;
+    const char *chemin_sortie = NULL;
+    const char *chemin_reference = NULL;
+    double tolerance = 0.10;
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(argv[0]);
+            return 0;
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            return 1;
+        } else if (strcmp(argv[i], "--graine") == 0) {
+            graine = strtoull(valeur, NULL, 10);
+        } else if (strcmp(argv[i], "--taches") == 0) {
+            nb_valeurs_taches = lire_liste(valeur, &nb_taches);
+            if (nb_valeurs_taches <= 0) {
+                fprintf(stderr, "Liste de taches invalide: %s\n", valeur);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--horizons") == 0) {
+            nb_horizons = lire_liste(valeur, &horizons);
+            if (nb_horizons <= 0) {
+                fprintf(stderr, "Liste d'horizons invalide: %s\n", valeur);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--repetitions") == 0) {
+            repetitions = atoi(valeur);
+            if (repetitions <= 0) {
+                fprintf(stderr, "Nombre de repetitions invalide: %s\n", valeur);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--sortie") == 0) {
+            chemin_sortie = valeur;
+        } else if (strcmp(argv[i], "--reference") == 0) {
+            chemin_reference = valeur;
+        } else if (strcmp(argv[i], "--tolerance") == 0) {
+            tolerance = atof(valeur);
+        } else {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    
+    int max_mesures = nb_valeurs_taches * (3 + NB_SIMULATIONS * nb_horizons);
+    MesureMoteur *mesures = calloc(max_mesures, sizeof(MesureMoteur));
+    double *durees = malloc(repetitions * sizeof(double));
+    int nb_mesures = 0;
+    
+    if (mesures == NULL || durees == NULL) {
+        fprintf(stderr, "Memoire insuffisante\n");
+        return 1;
+    }
+    
+    for (int k = 0; k < nb_valeurs_taches; k++) {
+        int n = nb_taches[k];
+        GenerateurAleatoire alea;
+        
+        // Micro-mesures des tas
+        static const char *noms_tas[] = { "tas_selection_echeance", "tas_selection_priorite", "tas_activations" };
+        for (int m = 0; m < 3; m++) {
+            MesureMoteur *mesure = &mesures[nb_mesures++];
+            snprintf(mesure->nom, sizeof(mesure->nom), "%s", noms_tas[m]);
+            mesure->taches = n;
+            mesure->operations = OPERATIONS_TAS;
+            alea_initialiser(&alea, graine ^ (uint64_t)n);
+            if (m == 0) {
+                mesurer_selection_echeance(&alea, n, repetitions, durees, mesure);
+            } else if (m == 1) {
+                mesurer_selection_priorite(&alea, n, repetitions, durees, mesure);
+            } else {
+                mesurer_activations(&alea, n, repetitions, durees, mesure);
+            }
+            resumer(mesure, durees, repetitions);
+            fprintf(stderr, "%-24s n=%-7d %10.1f ns/op\n", mesure->nom, n, mesure->ns_min);
+        }
+        
+        // Simulations complètes : périodes proportionnelles à n, pour que le
+        // nombre d'activations par horizon ne dépende pas du nombre de tâches
+        ParametresGeneration generation = {
+            n, UTILISATION_SIMULATION, 10 * n, 1000 * n, 0.5, 1.0
+        };
+        ParametresTache *jeu = malloc(n * sizeof(ParametresTache));
+        double *utilisations = malloc(n * sizeof(double));
+        alea_initialiser(&alea, graine ^ (uint64_t)n);
+        if (jeu == NULL || utilisations == NULL || !generer_jeu(&alea, &generation, jeu, utilisations)) {
+            fprintf(stderr, "Generation impossible pour %d taches\n", n);
+            return 1;
+        }
+        for (int h = 0; h < nb_horizons; h++) {
+            for (int s = 0; s < NB_SIMULATIONS; s++) {
+                MesureMoteur *mesure = &mesures[nb_mesures++];
+                snprintf(mesure->nom, sizeof(mesure->nom), "%s", noms_simules[s]);
+                mesure->taches = n;
+                mesure->horizon = horizons[h];
+                if (!mesurer_simulation(algorithmes_simules[s], jeu, n, horizons[h], repetitions,
+                                        durees, mesure)) {
+                    fprintf(stderr, "Memoire insuffisante\n");
+                    return 1;
+                }
+                resumer(mesure, durees, repetitions);
+                fprintf(stderr, "%-24s n=%-7d h=%-10d %10.1f ns/activation\n",
+                        mesure->nom, n, horizons[h], mesure->ns_min);
+            }
+        }
+        free(jeu);
+        free(utilisations);
+    }
+    
+    FILE *sortie = chemin_sortie != NULL ? fopen(chemin_sortie, "w") : stdout;
+    if (sortie == NULL) {
+        fprintf(stderr, "Impossible d'ecrire %s\n", chemin_sortie);
+        return 1;
+    }
+    fprintf(sortie, "{\n  \"graine\": %llu,\n  \"repetitions\": %d,\n  \"mesures\": [\n", graine, repetitions);
+    for (int i = 0; i < nb_mesures; i++) {
+        ecrire_mesure(sortie, &mesures[i], i == nb_mesures - 1);
+    }
+    fprintf(sortie, "  ]\n}\n");
+    if (sortie != stdout) {
+        fclose(sortie);
+    }
+    
+    int code = 0;
+    if (chemin_reference != NULL) {
+        MesureMoteur *reference = malloc(MESURES_REFERENCE_MAX * sizeof(MesureMoteur));
+        unsigned long long graine_reference = 0;
+        int nb_reference = reference != NULL ?
+            lire_reference(chemin_reference, reference, MESURES_REFERENCE_MAX, &graine_reference) : -1;
+        if (nb_reference < 0) {
+            fprintf(stderr, "Impossible de lire %s\n", chemin_reference);
+            code = 1;
+        } else if (!comparer_reference(mesures, nb_mesures, reference, nb_reference,
+                                       graine_reference == graine, tolerance)) {
+            code = 1;
+        }
+        free(reference);
+    }
+    
+    if (nb_taches != taches_defaut) {
+        free(nb_taches);
+    }
+    if (horizons != horizons_defaut) {
+        free(horizons);
+    }
+    free(mesures);
+    free(durees);
+    return code;
+}
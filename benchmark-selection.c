@@ -0,0 +1,322 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "tas.h"
+#include "table-taches.h"
+#include "generateur-taches.h"
+
+// Disposition en tableau de structures, identique à la tâche des simulateurs
+typedef struct {
+    int id;
+    int duree_execution;
+    int echeance;
+    int periode;
+    int priorite;
+    int temps_restant;
+    int prochaine_activation;
+    int echeance_absolue;
+    int instance;
+} TacheAos;
+
+// Mesures d'une implémentation (ns par appel, somme de contrôle des résultats)
+typedef struct {
+    double echeance_min;
+    double priorite_max;
+    double activations;
+    long long controle[3];
+} Mesure;
+
+// Fonction pour lire l'horloge monotone en secondes
+static double maintenant(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Fonction pour lire une liste d'entiers séparés par des virgules
+static int lire_liste(const char *texte, int **valeurs) {
+    int nb = 0;
+    const char *p = texte;
+    
+    *valeurs = malloc((strlen(texte) / 2 + 1) * sizeof(int));
+    while (*p != '\0') {
+        char *fin;
+        long v = strtol(p, &fin, 10);
+        if (fin == p || v <= 0) {
+            return -1;
+        }
+        (*valeurs)[nb++] = (int)v;
+        p = *fin == ',' ? fin + 1 : fin;
+        if (*fin != ',' && *fin != '\0') {
+            return -1;
+        }
+    }
+    return nb;
+}
+
+// Fonction pour remplir une table de tâches aléatoires (la moitié sont prêtes)
+static void generer_table(GenerateurAleatoire *alea, TableTaches *table, int nb_taches) {
+    table->nb_taches = nb_taches;
+    for (int i = 0; i < nb_taches; i++) {
+        table->priorite[i] = (int)(alea_suivant(alea) % (4u * nb_taches));
+        table->echeance_absolue[i] = (int)(alea_suivant(alea) % 1000000);
+        table->prochaine_activation[i] = (int)(alea_suivant(alea) % 1000);
+        table->temps_restant[i] = alea_suivant(alea) % 2 == 0 ? 0 : 1 + (int)(alea_suivant(alea) % 10);
+    }
+}
+
+// Fonction pour copier une table (restauration avant chaque implémentation)
+static void copier_table(TableTaches *destination, const TableTaches *source) {
+    size_t taille = source->nb_taches * sizeof(int);
+    
+    destination->nb_taches = source->nb_taches;
+    memcpy(destination->priorite, source->priorite, taille);
+    memcpy(destination->echeance_absolue, source->echeance_absolue, taille);
+    memcpy(destination->prochaine_activation, source->prochaine_activation, taille);
+    memcpy(destination->temps_restant, source->temps_restant, taille);
+}
+
+// Fonction pour choisir la tâche modifiée entre deux sélections, comme le
+// ferait un événement de la simulation (même suite pour toutes les implémentations)
+static inline int tache_modifiee(int repetition, int nb_taches) {
+    return (int)((repetition * 7919LL) % nb_taches);
+}
+
+// ---- Parcours du tableau de structures (référence) ----
+
+__attribute__((noinline))
+static int echeance_min_aos(const TacheAos *taches, int nb_taches) {
+    int meilleure = -1;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].temps_restant > 0 &&
+            (meilleure == -1 || taches[i].echeance_absolue < taches[meilleure].echeance_absolue)) {
+            meilleure = i;
+        }
+    }
+    return meilleure;
+}
+
+__attribute__((noinline))
+static int priorite_max_aos(const TacheAos *taches, int nb_taches) {
+    int meilleure = -1;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].temps_restant > 0 &&
+            (meilleure == -1 || taches[i].priorite > taches[meilleure].priorite)) {
+            meilleure = i;
+        }
+    }
+    return meilleure;
+}
+
+__attribute__((noinline))
+static int activations_aos(const TacheAos *taches, int nb_taches, int temps, int *indices) {
+    int nb = 0;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].prochaine_activation == temps) {
+            indices[nb++] = i;
+        }
+    }
+    return nb;
+}
+
+// Fonction pour mesurer le parcours du tableau de structures
+static Mesure mesurer_aos(const TableTaches *source, int repetitions, int *indices) {
+    int n = source->nb_taches;
+    TacheAos *taches = calloc(n, sizeof(TacheAos));
+    Mesure mesure = { 0 };
+    
+    for (int i = 0; i < n; i++) {
+        taches[i].id = i + 1;
+        taches[i].priorite = source->priorite[i];
+        taches[i].echeance_absolue = source->echeance_absolue[i];
+        taches[i].prochaine_activation = source->prochaine_activation[i];
+        taches[i].temps_restant = source->temps_restant[i];
+    }
+    
+    double debut = maintenant();
+    for (int r = 0; r < repetitions; r++) {
+        taches[tache_modifiee(r, n)].echeance_absolue += r;
+        mesure.controle[0] += echeance_min_aos(taches, n);
+    }
+    mesure.echeance_min = (maintenant() - debut) * 1e9 / repetitions;
+    
+    debut = maintenant();
+    for (int r = 0; r < repetitions; r++) {
+        taches[tache_modifiee(r, n)].priorite ^= 1;
+        mesure.controle[1] += priorite_max_aos(taches, n);
+    }
+    mesure.priorite_max = (maintenant() - debut) * 1e9 / repetitions;
+    
+    debut = maintenant();
+    for (int r = 0; r < repetitions; r++) {
+        mesure.controle[2] += activations_aos(taches, n, r % 1000, indices);
+    }
+    mesure.activations = (maintenant() - debut) * 1e9 / repetitions;
+    
+    free(taches);
+    return mesure;
+}
+
+// Fonction pour mesurer un jeu de noyaux sur la table SoA
+static Mesure mesurer_noyaux(const NoyauxSelection *noyaux, TableTaches *table,
+                             const TableTaches *source, int repetitions, int *indices) {
+    int n = source->nb_taches;
+    Mesure mesure = { 0 };
+    
+    copier_table(table, source);
+    double debut = maintenant();
+    for (int r = 0; r < repetitions; r++) {
+        table->echeance_absolue[tache_modifiee(r, n)] += r;
+        mesure.controle[0] += noyaux->echeance_min(table);
+    }
+    mesure.echeance_min = (maintenant() - debut) * 1e9 / repetitions;
+    
+    debut = maintenant();
+    for (int r = 0; r < repetitions; r++) {
+        table->priorite[tache_modifiee(r, n)] ^= 1;
+        mesure.controle[1] += noyaux->priorite_max(table);
+    }
+    mesure.priorite_max = (maintenant() - debut) * 1e9 / repetitions;
+    
+    debut = maintenant();
+    for (int r = 0; r < repetitions; r++) {
+        mesure.controle[2] += noyaux->activations(table, r % 1000, indices);
+    }
+    mesure.activations = (maintenant() - debut) * 1e9 / repetitions;
+    return mesure;
+}
+
+// Fonction pour mesurer la sélection par tas indexé (celle des simulateurs) :
+// chaque modification d'échéance coûte O(log n), la sélection O(1)
+static Mesure mesurer_tas(const TableTaches *source, int repetitions) {
+    int n = source->nb_taches;
+    int *echeances = malloc(n * sizeof(int));
+    Mesure mesure = { 0 };
+    Tas pret;
+    
+    tas_initialiser(&pret, n);
+    memcpy(echeances, source->echeance_absolue, n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        if (source->temps_restant[i] > 0) {
+            tas_inserer(&pret, i, echeances[i]);
+        }
+    }
+    
+    double debut = maintenant();
+    for (int r = 0; r < repetitions; r++) {
+        int k = tache_modifiee(r, n);
+        echeances[k] += r;
+        if (tas_contient(&pret, k)) {
+            tas_modifier(&pret, k, echeances[k]);
+        }
+        mesure.controle[0] += tas_sommet(&pret);
+    }
+    mesure.echeance_min = (maintenant() - debut) * 1e9 / repetitions;
+    
+    tas_liberer(&pret);
+    free(echeances);
+    return mesure;
+}
+
+// Fonction pour afficher une ligne de résultats
+static void afficher_mesure(int nb_taches, const char *nom, const Mesure *mesure,
+                            const Mesure *reference, bool selection_seule) {
+    printf("%d,%s,%.1f,", nb_taches, nom, mesure->echeance_min);
+    if (selection_seule) {
+        printf("-,-,%.2f\n", reference->echeance_min / mesure->echeance_min);
+    } else {
+        printf("%.1f,%.1f,%.2f\n", mesure->priorite_max, mesure->activations,
+               reference->echeance_min / mesure->echeance_min);
+    }
+}
+
+// Fonction pour afficher l'aide de la ligne de commande
+static void afficher_usage(const char *programme) {
+    printf("Usage: %s [options]\n\n", programme);
+    printf("Temps par appel (ns) des noyaux de selection : tableau de structures,\n");
+    printf("table SoA scalaire, SSE4.1 et AVX2 (si disponibles), puis tas indexe.\n\n");
+    printf("  --graine N               graine du generateur (defaut: 1)\n");
+    printf("  --taches LISTE           nombres de taches (defaut: 1000,10000,100000)\n");
+}
+
+int main(int argc, char **argv) {
+    static int taches_defaut[] = { 1000, 10000, 100000 };
+    int *nb_taches = taches_defaut;
+    int nb_valeurs = 3;
+    uint64_t graine = 1;
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(argv[0]);
+            return 0;
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            return 1;
+        } else if (strcmp(argv[i], "--graine") == 0) {
+            graine = strtoull(valeur, NULL, 10);
+        } else if (strcmp(argv[i], "--taches") == 0) {
+            nb_valeurs = lire_liste(valeur, &nb_taches);
+            if (nb_valeurs <= 0) {
+                fprintf(stderr, "Liste de taches invalide: %s\n", valeur);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    
+    printf("taches,implementation,echeance_min_ns,priorite_max_ns,activations_ns,acceleration\n");
+    for (int k = 0; k < nb_valeurs; k++) {
+        int n = nb_taches[k];
+        // Environ 5e7 tâches parcourues par mesure
+        int repetitions = n < 2500000 ? 50000000 / n : 20;
+        TableTaches source, table;
+        GenerateurAleatoire alea;
+        int *indices = malloc(n * sizeof(int));
+        
+        if (indices == NULL || !table_initialiser(&source, n) || !table_initialiser(&table, n)) {
+            fprintf(stderr, "Memoire insuffisante\n");
+            return 1;
+        }
+        alea_initialiser(&alea, graine ^ (uint64_t)n);
+        generer_table(&alea, &source, n);
+        
+        Mesure reference = mesurer_aos(&source, repetitions, indices);
+        afficher_mesure(n, "aos", &reference, &reference, false);
+        
+        for (int type = NOYAU_SCALAIRE; type < NB_NOYAUX; type++) {
+            const NoyauxSelection *noyaux = noyaux_obtenir((TypeNoyau)type);
+            if (noyaux == NULL) {
+                continue;
+            }
+            Mesure mesure = mesurer_noyaux(noyaux, &table, &source, repetitions, indices);
+            if (memcmp(mesure.controle, reference.controle, sizeof(mesure.controle)) != 0) {
+                fprintf(stderr, "Resultats differents pour les noyaux %s\n", nom_noyau((TypeNoyau)type));
+                return 1;
+            }
+            afficher_mesure(n, nom_noyau((TypeNoyau)type), &mesure, &reference, false);
+        }
+        
+        Mesure mesure = mesurer_tas(&source, repetitions);
+        if (mesure.controle[0] != reference.controle[0]) {
+            fprintf(stderr, "Resultats differents pour le tas\n");
+            return 1;
+        }
+        afficher_mesure(n, "tas", &mesure, &reference, true);
+        
+        table_liberer(&source);
+        table_liberer(&table);
+        free(indices);
+    }
+    return 0;
+}
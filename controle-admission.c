@@ -0,0 +1,464 @@
+#include <stdlib.h>
+#include <string.h>
+#include "analyse.h"
+#include "controle-admission.h"
+
+// Type de modification demandée, qui décide des valeurs mémorisées réutilisables
+typedef enum {
+    CHANGEMENT_QUELCONQUE,    // Tout peut augmenter ou diminuer
+    CHANGEMENT_CROISSANT,     // La demande ne diminue pour aucune tâche
+    CHANGEMENT_RELACHE        // La demande n'augmente pour aucune autre tâche
+} TypeChangement;
+
+// Fonction pour initialiser un contrôleur vide (HPF, RM, DM ou EDF)
+bool controle_initialiser(ControleAdmission *controle, TypeOrdonnanceur algorithme) {
+    memset(controle, 0, sizeof(ControleAdmission));
+    controle->algorithme = algorithme;
+    return algorithme == HPF || algorithme == RM || algorithme == DM || algorithme == EDF;
+}
+
+// Fonction pour libérer la mémoire d'un contrôleur
+void controle_liberer(ControleAdmission *controle) {
+    free(controle->parametres);
+    free(controle->admises);
+    free(controle->parametres_candidat);
+    free(controle->admises_candidat);
+    memset(controle, 0, sizeof(ControleAdmission));
+}
+
+// Fonction pour agrandir les tables (le contenu et la synchronisation sont conservés)
+static bool reserver(ControleAdmission *controle, int nb_taches) {
+    if (nb_taches <= controle->capacite) {
+        return true;
+    }
+    
+    int capacite = controle->capacite > 0 ? controle->capacite * 2 : 64;
+    while (capacite < nb_taches) {
+        capacite *= 2;
+    }
+    ParametresTache *parametres = realloc(controle->parametres, capacite * sizeof(ParametresTache));
+    if (parametres != NULL) {
+        controle->parametres = parametres;
+    }
+    ParametresTache *parametres_candidat = realloc(controle->parametres_candidat,
+                                                   capacite * sizeof(ParametresTache));
+    if (parametres_candidat != NULL) {
+        controle->parametres_candidat = parametres_candidat;
+    }
+    TacheAdmise *admises = realloc(controle->admises, capacite * sizeof(TacheAdmise));
+    if (admises != NULL) {
+        controle->admises = admises;
+    }
+    TacheAdmise *admises_candidat = realloc(controle->admises_candidat, capacite * sizeof(TacheAdmise));
+    if (admises_candidat != NULL) {
+        controle->admises_candidat = admises_candidat;
+    }
+    if (parametres == NULL || parametres_candidat == NULL || admises == NULL || admises_candidat == NULL) {
+        return false;
+    }
+    controle->capacite = capacite;
+    return true;
+}
+
+// Fonction pour calculer la clé d'ordre d'une tâche (plus petite = plus prioritaire)
+// En EDF, la table est triée par échéance relative pour la borne linéaire.
+static long long cle_ordre(TypeOrdonnanceur algorithme, const ParametresTache *tache) {
+    switch (algorithme) {
+        case HPF: return -(long long)tache->priorite;
+        case RM:  return tache->periode;
+        default:  return tache->echeance;
+    }
+}
+
+// Fonction pour trouver la place d'une tâche dans la table admise, par recherche
+// dichotomique : première position de clé (ou de séquence, à clé égale) supérieure
+static int position_insertion(const ControleAdmission *controle, const ParametresTache *tache,
+                              long long sequence) {
+    long long cle = cle_ordre(controle->algorithme, tache);
+    int bas = 0;
+    int haut = controle->nb_taches;
+    
+    while (bas < haut) {
+        int milieu = (bas + haut) / 2;
+        long long cle_milieu = cle_ordre(controle->algorithme, &controle->parametres[milieu]);
+        if (cle_milieu > cle || (cle_milieu == cle && controle->admises[milieu].sequence > sequence)) {
+            haut = milieu;
+        } else {
+            bas = milieu + 1;
+        }
+    }
+    return bas;
+}
+
+// Fonction pour trouver la position d'une tâche admise (-1 si l'identifiant est inconnu)
+static int chercher(const ControleAdmission *controle, int id) {
+    for (int i = 0; i < controle->nb_taches; i++) {
+        if (controle->admises[i].id == id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Fonction pour recalculer les sommes des tâches précédentes à partir de debut
+// ainsi que la borne linéaire de la demande (Devi) : dbf(t) <= C + U(t - D) pour
+// t >= D, et la somme de ces bornes moins t décroît entre deux échéances
+// lorsque U <= 1. Il suffit donc que Σ(Ci + Ui(Dk - Di)) <= Dk pour chaque
+// tâche k, la somme portant sur les tâches d'échéance au plus Dk.
+static void cumuler(const ParametresTache *parametres, TacheAdmise *admises, int debut, int nb_taches) {
+    for (int i = debut; i < nb_taches; i++) {
+        const ParametresTache *tache = &parametres[i];
+        TacheAdmise *admise = &admises[i];
+        
+        if (i == 0) {
+            admise->c_avant = 0;
+            admise->u_avant = 0.0;
+            admise->s_avant = 0.0;
+            admise->ud_avant = 0.0;
+        } else {
+            const ParametresTache *precedente = &parametres[i - 1];
+            double u = (double)precedente->duree_execution / precedente->periode;
+            admise->c_avant = admises[i - 1].c_avant + precedente->duree_execution;
+            admise->u_avant = admises[i - 1].u_avant + u;
+            admise->s_avant = admises[i - 1].s_avant + precedente->duree_execution * (1.0 - u);
+            admise->ud_avant = admises[i - 1].ud_avant + u * precedente->echeance;
+        }
+        double borne = admise->c_avant + tache->duree_execution + 
+                       admise->u_avant * tache->echeance - admise->ud_avant;
+        admise->lineaire = (i == 0 || admises[i - 1].lineaire) && borne * (1.0 + 1e-9) <= tache->echeance;
+    }
+}
+
+// Fonction pour calculer la demande ⌈w/T⌉C d'une tâche sur une fenêtre w
+static inline long long demande_tache(const ParametresTache *tache, long long w) {
+    return ((w + tache->periode - 1) / tache->periode) * tache->duree_execution;
+}
+
+// Fonction pour calculer C + Σ⌈L/Tj⌉Cj sur les tâches 0..i-1, L = min(D, T)
+static long long demande_position(const ParametresTache *taches, int i) {
+    long long limite = taches[i].echeance < taches[i].periode ? taches[i].echeance : taches[i].periode;
+    long long demande = taches[i].duree_execution;
+    
+    for (int j = 0; j < i; j++) {
+        demande += demande_tache(&taches[j], limite);
+    }
+    return demande;
+}
+
+// Fonction pour mettre à jour les positions [debut, nb_taches) du candidat :
+// seule la tâche retirée (ancienne, avant insertion) ou insérée (position)
+// passe d'un côté à l'autre, une correction en O(1) suffit. La demande à
+// min(D, T) reste exacte ; un minorant w valide est relevé à w + Δ(w), car le
+// nouveau point fixe vaut au moins f(w) = w + Δ(w) (f croissante, w en dessous).
+static void ajuster_candidat(const ParametresTache *parametres, TacheAdmise *admises, int nb_taches,
+                             int debut, const ParametresTache *retiree, int ancienne, int position) {
+    const ParametresTache *inseree = position >= 0 ? &parametres[position] : NULL;
+    
+    for (int i = debut; i < nb_taches; i++) {
+        TacheAdmise *admise = &admises[i];
+        
+        if (i == position) {
+            admise->demande = demande_position(parametres, i);
+            continue;
+        }
+        long long limite = parametres[i].echeance < parametres[i].periode ? 
+                           parametres[i].echeance : parametres[i].periode;
+        long long w = admise->premiere_fin;
+        int avant_insertion = position >= 0 && i > position ? i - 1 : i;
+        if (retiree != NULL && avant_insertion >= ancienne) {
+            admise->demande -= demande_tache(retiree, limite);
+            admise->premiere_fin -= w > 0 ? demande_tache(retiree, w) : 0;
+        }
+        if (inseree != NULL && i > position) {
+            admise->demande += demande_tache(inseree, limite);
+            admise->premiere_fin += w > 0 ? demande_tache(inseree, w) : 0;
+        }
+    }
+}
+
+// Fonction pour préparer le jeu candidat : tâche en position ancienne retirée
+// (si ancienne >= 0), puis tache insérée à sa place (si elle n'est pas NULL)
+// Seules les positions à partir de *debut diffèrent du jeu admis, et seules
+// celles qui ne sont pas déjà synchronisées sont recopiées. Les minorants des
+// positions suivantes ne restent valides que si la demande ne diminue pas.
+// Renvoie le nombre de tâches du candidat ; *position reçoit celle de tache.
+static int preparer_candidat(ControleAdmission *controle, int ancienne, const ParametresTache *tache,
+                             int id, long long sequence, bool minorants_valides,
+                             int *debut, int *position) {
+    int nb_taches = controle->nb_taches;
+    ParametresTache *parametres = controle->parametres_candidat;
+    TacheAdmise *admises = controle->admises_candidat;
+    
+    *position = -1;
+    if (tache != NULL) {
+        int p = position_insertion(controle, tache, sequence);
+        *position = ancienne >= 0 && ancienne < p ? p - 1 : p;
+    }
+    *debut = ancienne >= 0 && (*position < 0 || ancienne < *position) ? ancienne : *position;
+    
+    int copie = controle->synchro < *debut ? controle->synchro : *debut;
+    memcpy(&parametres[copie], &controle->parametres[copie], (nb_taches - copie) * sizeof(ParametresTache));
+    memcpy(&admises[copie], &controle->admises[copie], (nb_taches - copie) * sizeof(TacheAdmise));
+    
+    ParametresTache retiree;
+    if (ancienne >= 0) {
+        retiree = parametres[ancienne];
+        nb_taches--;
+        memmove(&parametres[ancienne], &parametres[ancienne + 1], (nb_taches - ancienne) * sizeof(ParametresTache));
+        memmove(&admises[ancienne], &admises[ancienne + 1], (nb_taches - ancienne) * sizeof(TacheAdmise));
+    }
+    if (tache != NULL) {
+        int p = *position;
+        memmove(&parametres[p + 1], &parametres[p], (nb_taches - p) * sizeof(ParametresTache));
+        memmove(&admises[p + 1], &admises[p], (nb_taches - p) * sizeof(TacheAdmise));
+        parametres[p] = *tache;
+        admises[p].id = id;
+        admises[p].sequence = sequence;
+        admises[p].premiere_fin = 0;
+        nb_taches++;
+    }
+    
+    if (!minorants_valides) {
+        for (int i = *debut; i < nb_taches; i++) {
+            admises[i].premiere_fin = 0;
+        }
+    }
+    cumuler(parametres, admises, *debut, nb_taches);
+    if (controle->algorithme != EDF) {
+        ajuster_candidat(parametres, admises, nb_taches, *debut, ancienne >= 0 ? &retiree : NULL,
+                         ancienne, *position);
+    }
+    return nb_taches;
+}
+
+// Fonction pour calculer le pire temps de réponse de la tâche en position i,
+// les tâches 0..i-1 étant plus prioritaires (même récurrence que temps_reponse_tache)
+// La fin de la première instance repart de son minorant mémorisé : la demande
+// des tâches plus prioritaires n'ayant pas diminué, le point fixe est au-delà.
+// Le calcul s'arrête dès que l'échéance est dépassée.
+static long long temps_reponse_position(const ParametresTache *taches, TacheAdmise *admise, int i) {
+    const ParametresTache *tache = &taches[i];
+    long long pire = 0;
+    long long w = tache->duree_execution + admise->c_avant;
+    
+    if (admise->premiere_fin > w) {
+        w = admise->premiere_fin;
+    }
+    for (long long q = 0; ; q++) {
+        if (q > 0) {
+            w += tache->duree_execution;
+        }
+        for (;;) {
+            long long total = (q + 1) * tache->duree_execution;
+            for (int j = 0; j < i; j++) {
+                total += ((w + taches[j].periode - 1) / taches[j].periode) * taches[j].duree_execution;
+            }
+            if (total - q * tache->periode > tache->echeance) {
+                return total - q * tache->periode;
+            }
+            if (total == w) {
+                break;
+            }
+            w = total;
+        }
+        
+        if (q == 0) {
+            admise->premiere_fin = w;
+        }
+        if (w - q * tache->periode > pire) {
+            pire = w - q * tache->periode;
+        }
+        if (w <= (q + 1) * tache->periode) {
+            return pire;
+        }
+    }
+}
+
+// Fonction pour décider en O(1) d'une position du candidat (priorités fixes) :
+// -1 si l'échéance est forcément manquée (ΣC ou le minorant la dépassent),
+// 1 si elle est forcément respectée (demande à L = min(D, T) qui tient dans L,
+// ou borne de Bini et Baruah sous L : le point fixe précède L), 0 sinon
+static int decider_position(const ParametresTache *tache, const TacheAdmise *admise) {
+    long long limite = tache->echeance < tache->periode ? tache->echeance : tache->periode;
+    
+    if (admise->c_avant + tache->duree_execution > tache->echeance || admise->premiere_fin > tache->echeance) {
+        return -1;
+    }
+    if (admise->demande <= limite) {
+        return 1;
+    }
+    if (admise->u_avant < 1.0 - 1e-9) {
+        double borne = (tache->duree_execution + admise->s_avant) / (1.0 - admise->u_avant);
+        if (borne * (1.0 + 1e-9) <= limite) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Fonction pour vérifier les positions [debut, fin) du candidat (priorités fixes)
+// Les tâches précédentes gardent le même ensemble de tâches plus prioritaires,
+// leur temps de réponse est inchangé. Toutes les positions passent d'abord les
+// tests en O(1), un refus coûte ainsi rarement une RTA ; les indécises passent
+// ensuite la RTA, qui repart du minorant mémorisé. La tâche i subissant tout ce
+// que subit la tâche i - 1, plus i - 1 elle-même, son point fixe dépasse celui
+// de i - 1 d'au moins Ci : les minorants sont relevés de proche en proche.
+static bool verifier_priorites_fixes(ControleAdmission *controle, int nb_taches, int debut, int fin) {
+    const ParametresTache *parametres = controle->parametres_candidat;
+    TacheAdmise *admises = controle->admises_candidat;
+    const ParametresTache *derniere = &parametres[nb_taches - 1];
+    bool indecises = false;
+    
+    if (admises[nb_taches - 1].u_avant + (double)derniere->duree_execution / derniere->periode > 1.0 + 1e-9) {
+        return false;
+    }
+    for (int i = debut; i < fin; i++) {
+        if (i > 0 && admises[i - 1].premiere_fin + parametres[i].duree_execution > admises[i].premiere_fin) {
+            admises[i].premiere_fin = admises[i - 1].premiere_fin + parametres[i].duree_execution;
+        }
+        int decision = decider_position(&parametres[i], &admises[i]);
+        if (decision < 0) {
+            return false;
+        }
+        indecises = indecises || decision == 0;
+    }
+    for (int i = debut; indecises && i < fin; i++) {
+        if (decider_position(&parametres[i], &admises[i]) == 0 &&
+            temps_reponse_position(parametres, &admises[i], i) > parametres[i].echeance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Fonction pour vérifier le candidat (EDF) : U > 1 rejette, la borne linéaire
+// de la demande accepte, sinon test exact QPA sur le candidat
+static bool verifier_edf(ControleAdmission *controle, int nb_taches) {
+    const ParametresTache *derniere = &controle->parametres_candidat[nb_taches - 1];
+    const TacheAdmise *admise = &controle->admises_candidat[nb_taches - 1];
+    
+    if (admise->u_avant + (double)derniere->duree_execution / derniere->periode > 1.0 + 1e-9) {
+        return false;
+    }
+    if (admise->lineaire) {
+        return true;
+    }
+    return analyser_qpa(controle->parametres_candidat, nb_taches, NULL);
+}
+
+// Fonction pour appliquer le candidat : seules les positions modifiées sont recopiées
+static void valider_candidat(ControleAdmission *controle, int nb_taches, int debut) {
+    memcpy(&controle->parametres[debut], &controle->parametres_candidat[debut],
+           (nb_taches - debut) * sizeof(ParametresTache));
+    memcpy(&controle->admises[debut], &controle->admises_candidat[debut],
+           (nb_taches - debut) * sizeof(TacheAdmise));
+    controle->nb_taches = nb_taches;
+    controle->synchro = nb_taches;
+}
+
+// Fonction pour évaluer une demande (retrait de ancienne et/ou insertion de tache)
+// et l'appliquer si le jeu résultant reste ordonnançable
+static ReponseAdmission traiter_demande(ControleAdmission *controle, int ancienne, const ParametresTache *tache,
+                                        int id, long long sequence, TypeChangement changement) {
+    int debut;
+    int position;
+    int nb_taches = preparer_candidat(controle, ancienne, tache, id, sequence,
+                                      changement == CHANGEMENT_CROISSANT, &debut, &position);
+    bool faisable = true;
+    
+    // Un retrait ne peut que réduire la demande des tâches restantes
+    if (tache != NULL && controle->algorithme == EDF) {
+        faisable = changement == CHANGEMENT_RELACHE || verifier_edf(controle, nb_taches);
+    } else if (tache != NULL && changement == CHANGEMENT_RELACHE) {
+        // Seule la tâche modifiée peut alors manquer son échéance
+        faisable = verifier_priorites_fixes(controle, nb_taches, position, position + 1);
+    } else if (tache != NULL) {
+        faisable = verifier_priorites_fixes(controle, nb_taches, debut, nb_taches);
+    }
+    
+    if (!faisable) {
+        controle->synchro = debut;
+        return ADMISSION_REFUSEE;
+    }
+    valider_candidat(controle, nb_taches, debut);
+    return ADMISSION_ACCEPTEE;
+}
+
+// Fonction pour vérifier les paramètres d'une tâche (bornés par TEMPS_PARAMETRE_MAX)
+static bool parametres_valides(const ParametresTache *tache) {
+    return tache != NULL && tache->duree_execution > 0 && tache->echeance > 0 && tache->periode > 0 &&
+           tache->duree_execution <= TEMPS_PARAMETRE_MAX && tache->echeance <= TEMPS_PARAMETRE_MAX &&
+           tache->periode <= TEMPS_PARAMETRE_MAX;
+}
+
+// Fonction pour demander l'admission d'une nouvelle tâche
+ReponseAdmission controle_ajouter(ControleAdmission *controle, int id, const ParametresTache *tache) {
+    if (!parametres_valides(tache) || chercher(controle, id) >= 0) {
+        return ADMISSION_INVALIDE;
+    }
+    if (!reserver(controle, controle->nb_taches + 1)) {
+        return ADMISSION_MEMOIRE;
+    }
+    
+    ReponseAdmission reponse = traiter_demande(controle, -1, tache, id, controle->sequence, CHANGEMENT_CROISSANT);
+    if (reponse == ADMISSION_ACCEPTEE) {
+        controle->sequence++;
+    }
+    return reponse;
+}
+
+// Fonction pour demander la modification des paramètres d'une tâche admise
+// (refusée, la tâche garde ses anciens paramètres)
+ReponseAdmission controle_modifier(ControleAdmission *controle, int id, const ParametresTache *tache) {
+    int ancienne = chercher(controle, id);
+    
+    if (!parametres_valides(tache) || ancienne < 0) {
+        return ADMISSION_INVALIDE;
+    }
+    
+    const ParametresTache *avant = &controle->parametres[ancienne];
+    int position = position_insertion(controle, tache, controle->admises[ancienne].sequence);
+    TypeChangement changement = CHANGEMENT_QUELCONQUE;
+    
+    // Nouvelle position une fois l'ancienne retirée : remontée avec une demande
+    // plus forte, la tâche ne gêne que davantage ; descendue avec une demande
+    // plus faible, elle ne gêne que moins
+    if (position > ancienne) {
+        position--;
+    }
+    if (tache->duree_execution >= avant->duree_execution && tache->periode <= avant->periode &&
+        position <= ancienne) {
+        changement = CHANGEMENT_CROISSANT;
+    } else if (tache->duree_execution <= avant->duree_execution && tache->periode >= avant->periode &&
+               position >= ancienne) {
+        changement = CHANGEMENT_RELACHE;
+    }
+    if (controle->algorithme == EDF) {
+        bool relache = tache->duree_execution <= avant->duree_execution && tache->periode >= avant->periode &&
+                       tache->echeance >= avant->echeance;
+        changement = relache ? CHANGEMENT_RELACHE : CHANGEMENT_QUELCONQUE;
+    }
+    
+    return traiter_demande(controle, ancienne, tache, id, controle->admises[ancienne].sequence, changement);
+}
+
+// Fonction pour retirer une tâche admise (toujours acceptée)
+ReponseAdmission controle_retirer(ControleAdmission *controle, int id) {
+    int ancienne = chercher(controle, id);
+    
+    if (ancienne < 0) {
+        return ADMISSION_INVALIDE;
+    }
+    return traiter_demande(controle, ancienne, NULL, id, 0, CHANGEMENT_RELACHE);
+}
+
+// Fonction pour obtenir le facteur d'utilisation du jeu admis
+double controle_utilisation(const ControleAdmission *controle) {
+    int n = controle->nb_taches;
+    
+    if (n == 0) {
+        return 0.0;
+    }
+    return controle->admises[n - 1].u_avant +
+           (double)controle->parametres[n - 1].duree_execution / controle->parametres[n - 1].periode;
+}
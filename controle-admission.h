@@ -0,0 +1,56 @@
+#ifndef CONTROLE_ADMISSION_H
+#define CONTROLE_ADMISSION_H
+
+#include <stdbool.h>
+#include "tache.h"
+#include "moteur-simulation.h"
+
+// Réponse à une demande d'admission
+typedef enum {
+    ADMISSION_ACCEPTEE,       // Demande appliquée : le jeu reste ordonnançable
+    ADMISSION_REFUSEE,        // Une échéance serait manquée (jeu admis inchangé)
+    ADMISSION_INVALIDE,       // Paramètres incorrects, identifiant inconnu ou déjà utilisé
+    ADMISSION_MEMOIRE         // Allocation impossible (jeu admis inchangé)
+} ReponseAdmission;
+
+// Tâche admise et valeurs mémorisées pour la réanalyse incrémentale
+// Les sommes portent sur les tâches qui la précèdent dans la table, c'est-à-dire
+// les tâches plus prioritaires en priorités fixes.
+typedef struct {
+    int id;                   // Identifiant choisi par le demandeur
+    long long sequence;       // Ordre d'admission (départage à priorité égale)
+    long long premiere_fin;   // Minorant de la fin de la première instance (0 : inconnu)
+    long long demande;        // C + Σ⌈L/Tj⌉Cj, L = min(D, T) (priorités fixes)
+    long long c_avant;        // Σ C
+    double u_avant;           // Σ C/T
+    double s_avant;           // Σ C(1 - C/T)
+    double ud_avant;          // Σ D C/T
+    bool lineaire;            // Borne linéaire de la demande respectée jusqu'ici (EDF)
+} TacheAdmise;
+
+// Contrôleur d'admission : jeu de tâches résident, trié par priorité
+// décroissante (par échéance en EDF), et jeu candidat sur lequel chaque
+// demande est évaluée avant d'être appliquée
+typedef struct {
+    TypeOrdonnanceur algorithme; // HPF, RM, DM ou EDF
+    int nb_taches;
+    int capacite;
+    ParametresTache *parametres;
+    TacheAdmise *admises;
+    ParametresTache *parametres_candidat;
+    TacheAdmise *admises_candidat;
+    int synchro;              // Positions du candidat identiques au jeu admis
+    long long sequence;       // Prochain numéro d'admission
+} ControleAdmission;
+
+bool controle_initialiser(ControleAdmission *controle, TypeOrdonnanceur algorithme);
+void controle_liberer(ControleAdmission *controle);
+
+// En priorités fixes, la priorité vient de P (HPF), de T (RM) ou de D (DM)
+ReponseAdmission controle_ajouter(ControleAdmission *controle, int id, const ParametresTache *tache);
+ReponseAdmission controle_modifier(ControleAdmission *controle, int id, const ParametresTache *tache);
+ReponseAdmission controle_retirer(ControleAdmission *controle, int id);
+
+double controle_utilisation(const ControleAdmission *controle);
+
+#endif
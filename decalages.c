@@ -0,0 +1,260 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include "decalages.h"
+#include "metriques.h"
+#include "pool-travail.h"
+
+// Tampons propres à un ouvrier : aucun état modifiable n'est partagé
+typedef struct {
+    Systeme systeme;
+    ParametresTache *parametres; // Copie du jeu avec les décalages de la combinaison
+    temps_t *decalages;
+    Metriques metriques;
+    long long echecs;
+    long long premier_echec;
+    temps_t *reponse_max;
+    long long *combinaison_max;
+} ContexteOuvrier;
+
+// Description de la recherche, partagée en lecture seule par les ouvriers
+typedef struct {
+    const Systeme *modele;
+    const RechercheDecalages *recherche;
+    ContexteOuvrier *ouvriers;
+} TravailDecalages;
+
+// Fonction pour libérer la recherche
+void decalages_liberer(RechercheDecalages *recherche) {
+    free(recherche->bornes);
+    free(recherche->reponse_max);
+    free(recherche->combinaison_max);
+    recherche->bornes = NULL;
+    recherche->reponse_max = NULL;
+    recherche->combinaison_max = NULL;
+}
+
+// Fonction pour préparer la recherche d'un système configuré : pas, bornes des
+// décalages de chaque tâche et nombre de combinaisons (-1 si leur produit
+// dépasse LLONG_MAX). Renvoie false si la mémoire manque.
+bool decalages_preparer(RechercheDecalages *recherche, const Systeme *modele) {
+    int taille = modele->nb_taches > 0 ? modele->nb_taches : 1;
+    temps_t ppcm = 1;
+    
+    memset(recherche, 0, sizeof(*recherche));
+    recherche->nb_taches = modele->nb_taches;
+    recherche->pas = modele->echelle;
+    recherche->combinaisons = 1;
+    recherche->premier_echec = -1;
+    recherche->bornes = malloc(taille * sizeof(temps_t));
+    recherche->reponse_max = malloc(taille * sizeof(temps_t));
+    recherche->combinaison_max = malloc(taille * sizeof(long long));
+    if (recherche->bornes == NULL || recherche->reponse_max == NULL || recherche->combinaison_max == NULL) {
+        decalages_liberer(recherche);
+        return false;
+    }
+    
+    for (int i = 0; i < modele->nb_taches; i++) {
+        temps_t periode = modele->parametres[i].periode;
+        
+        // Première tâche : décalage nul (symétrie) ; suivantes : modulo le PGCD
+        // de leur période et du PPCM des précédentes (0 : hors capacité, la
+        // période entière est alors parcourue)
+        recherche->bornes[i] = i == 0 ? recherche->pas : ppcm > 0 ? pgcd_temps(periode, ppcm) : periode;
+        if (ppcm > 0) {
+            temps_t facteur = periode / pgcd_temps(periode, ppcm);
+            ppcm = ppcm > TEMPS_MAX / facteur ? 0 : ppcm * facteur;
+        }
+        
+        long long nombre = recherche->bornes[i] / recherche->pas;
+        if (recherche->combinaisons >= 0) {
+            recherche->combinaisons = recherche->combinaisons > LLONG_MAX / nombre ? -1 :
+                                      recherche->combinaisons * nombre;
+        }
+        recherche->reponse_max[i] = -1;
+        recherche->combinaison_max[i] = -1;
+    }
+    return true;
+}
+
+// Fonction pour obtenir les décalages de la combinaison k (numération à base
+// variable, la dernière tâche variant le plus vite)
+void decalages_combinaison(const RechercheDecalages *recherche, long long k, temps_t *decalages) {
+    for (int i = recherche->nb_taches - 1; i >= 0; i--) {
+        long long nombre = recherche->bornes[i] / recherche->pas;
+        decalages[i] = (k % nombre) * recherche->pas;
+        k /= nombre;
+    }
+}
+
+// Fonction pour écrire les décalages de la combinaison k : "(O1, O2, ...)"
+void ecrire_combinaison(const RechercheDecalages *recherche, long long k, FILE *sortie) {
+    temps_t *decalages = malloc((recherche->nb_taches > 0 ? recherche->nb_taches : 1) * sizeof(temps_t));
+    
+    if (decalages == NULL) {
+        return;
+    }
+    decalages_combinaison(recherche, k, decalages);
+    fprintf(sortie, "(");
+    for (int i = 0; i < recherche->nb_taches; i++) {
+        fprintf(sortie, i > 0 ? ", %lld" : "%lld", decalages[i]);
+    }
+    fprintf(sortie, ")");
+    free(decalages);
+}
+
+// Fonction pour lire une liste de décalages séparés par des virgules
+// ("0,2ms,500us") ; false si une valeur est invalide ou si la mémoire manque
+bool lire_decalages(const char *texte, temps_t **decalages, int *nb_decalages) {
+    int capacite = 1;
+    
+    for (const char *c = texte; *c != '\0'; c++) {
+        capacite += *c == ',';
+    }
+    *decalages = malloc(capacite * sizeof(temps_t));
+    *nb_decalages = 0;
+    if (*decalages == NULL) {
+        return false;
+    }
+    for (const char *c = texte; ; c++) {
+        temps_t *decalage = &(*decalages)[(*nb_decalages)++];
+        if (!lire_temps(c, decalage, &c) || (*c != ',' && *c != '\0') || *decalage < 0 ||
+            *decalage > TEMPS_PARAMETRE_MAX) {
+            free(*decalages);
+            *decalages = NULL;
+            return false;
+        }
+        if (*c == '\0') {
+            return true;
+        }
+    }
+}
+
+// Fonction exécutée par les ouvriers : simuler les combinaisons [debut, fin)
+// Chaque simulation couvre tout l'horizon [0, Omax + 2H] (ou s'arrête sur un
+// cycle) pour relever le pire temps de réponse de chaque tâche.
+static void simuler_combinaisons(void *contexte, int ouvrier, long debut, long fin) {
+    TravailDecalages *travail = contexte;
+    const Systeme *modele = travail->modele;
+    ContexteOuvrier *tampons = &travail->ouvriers[ouvrier];
+    Systeme *systeme = &tampons->systeme;
+    int n = modele->nb_taches;
+    
+    for (long k = debut; k < fin; k++) {
+        decalages_combinaison(travail->recherche, k, tampons->decalages);
+        for (int i = 0; i < n; i++) {
+            tampons->parametres[i] = modele->parametres[i];
+            tampons->parametres[i].decalage = tampons->decalages[i];
+        }
+        configurer_systeme(systeme, tampons->parametres, n);
+        for (int i = 0; i < n; i++) {
+            systeme->taches[i].seuil = modele->taches[i].seuil;
+        }
+        metriques_reinitialiser(&tampons->metriques);
+        
+        if (!simuler_ordonnancement(systeme, 0)) {
+            tampons->echecs++;
+            if (tampons->premier_echec < 0 || k < tampons->premier_echec) {
+                tampons->premier_echec = k;
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            const Histogramme *reponse = &tampons->metriques.taches[i].reponse;
+            if (reponse->nombre > 0 && (reponse->max > tampons->reponse_max[i] ||
+                (reponse->max == tampons->reponse_max[i] && k < tampons->combinaison_max[i]))) {
+                tampons->reponse_max[i] = reponse->max;
+                tampons->combinaison_max[i] = k;
+            }
+        }
+    }
+}
+
+// Fonction pour préparer les tampons d'un ouvrier (copie des réglages du modèle)
+static bool preparer_ouvrier(ContexteOuvrier *tampons, const Systeme *modele) {
+    int taille = modele->nb_taches > 0 ? modele->nb_taches : 1;
+    
+    tampons->systeme.algorithme = modele->algorithme;
+    tampons->systeme.politique_echec = ECHEC_CONTINUER;
+    tampons->systeme.ressources = modele->ressources;
+    tampons->systeme.preemption = modele->preemption;
+    tampons->systeme.points = modele->points;
+    tampons->systeme.commutation = modele->commutation;
+    tampons->systeme.metriques = &tampons->metriques;
+    tampons->premier_echec = -1;
+    tampons->systeme.taches = malloc(taille * sizeof(Tache));
+    tampons->parametres = malloc(taille * sizeof(ParametresTache));
+    tampons->decalages = malloc(taille * sizeof(temps_t));
+    tampons->reponse_max = malloc(taille * sizeof(temps_t));
+    tampons->combinaison_max = malloc(taille * sizeof(long long));
+    if (tampons->systeme.taches == NULL || tampons->parametres == NULL || tampons->decalages == NULL ||
+        tampons->reponse_max == NULL || tampons->combinaison_max == NULL ||
+        !metriques_creer(&tampons->metriques, modele->nb_taches)) {
+        return false;
+    }
+    for (int i = 0; i < modele->nb_taches; i++) {
+        tampons->reponse_max[i] = -1;
+        tampons->combinaison_max[i] = -1;
+    }
+    return true;
+}
+
+// Fonction pour libérer les tampons d'un ouvrier
+static void liberer_ouvrier(ContexteOuvrier *tampons) {
+    free(tampons->systeme.taches);
+    liberer_files(&tampons->systeme);
+    free(tampons->parametres);
+    free(tampons->decalages);
+    free(tampons->reponse_max);
+    free(tampons->combinaison_max);
+    metriques_liberer(&tampons->metriques);
+}
+
+// Fonction pour simuler toutes les combinaisons de décalages d'un système
+// configuré (recherche préparée), réparties sur nb_threads threads (0 : un par
+// coeur). Les réglages du modèle (algorithme, préemption, seuils, ressources)
+// sont repris ; ses décalages sont ignorés. Le résultat ne dépend pas du
+// nombre de threads. Renvoie false si la mémoire ou les threads manquent.
+bool rechercher_pire_decalage(RechercheDecalages *recherche, const Systeme *modele, int nb_threads) {
+    TravailDecalages travail = { modele, recherche, NULL };
+    bool reussite = recherche->combinaisons >= 0;
+    
+    // Les ressources gardent l'état de leurs verrous : une simulation à la fois
+    PoolTravail *pool = reussite ? pool_creer(modele->ressources != NULL ? 1 : nb_threads) : NULL;
+    int nb_ouvriers = pool != NULL ? pool_nb_ouvriers(pool) : 0;
+    travail.ouvriers = pool != NULL ? calloc(nb_ouvriers, sizeof(ContexteOuvrier)) : NULL;
+    reussite = travail.ouvriers != NULL;
+    for (int o = 0; reussite && o < nb_ouvriers; o++) {
+        reussite = preparer_ouvrier(&travail.ouvriers[o], modele);
+    }
+    
+    if (reussite) {
+        pool_executer(pool, (long)recherche->combinaisons, 4, simuler_combinaisons, &travail);
+        
+        // Fusion des résultats des ouvriers (à égalité, la plus petite combinaison)
+        recherche->echecs = 0;
+        recherche->premier_echec = -1;
+        for (int o = 0; o < nb_ouvriers; o++) {
+            const ContexteOuvrier *tampons = &travail.ouvriers[o];
+            recherche->echecs += tampons->echecs;
+            if (tampons->premier_echec >= 0 &&
+                (recherche->premier_echec < 0 || tampons->premier_echec < recherche->premier_echec)) {
+                recherche->premier_echec = tampons->premier_echec;
+            }
+            for (int i = 0; i < modele->nb_taches; i++) {
+                if (tampons->reponse_max[i] > recherche->reponse_max[i] ||
+                    (tampons->reponse_max[i] == recherche->reponse_max[i] && tampons->reponse_max[i] >= 0 &&
+                     tampons->combinaison_max[i] < recherche->combinaison_max[i])) {
+                    recherche->reponse_max[i] = tampons->reponse_max[i];
+                    recherche->combinaison_max[i] = tampons->combinaison_max[i];
+                }
+            }
+        }
+    }
+    
+    for (int o = 0; travail.ouvriers != NULL && o < nb_ouvriers; o++) {
+        liberer_ouvrier(&travail.ouvriers[o]);
+    }
+    free(travail.ouvriers);
+    pool_detruire(pool);
+    return reussite;
+}
@@ -0,0 +1,54 @@
+#ifndef DECALAGES_H
+#define DECALAGES_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "tache.h"
+#include "moteur-simulation.h"
+
+// Recherche du pire décalage : les décalages d'activation d'un jeu sont
+// inconnus (ou peuvent changer), chaque combinaison est simulée sur
+// [0, Omax + 2H] pour trouver celle qui maximise les temps de réponse, ou
+// prouver que le jeu est faisable pour toutes.
+//
+// Combinaisons équivalentes éliminées (Goossens) :
+// - par symétrie, décaler toutes les tâches d'une même durée ne change pas
+//   l'ordonnancement : la première tâche garde un décalage nul ;
+// - par PGCD, le décalage de la tâche i n'a d'effet que modulo
+//   gi = PGCD(Ti, PPCM(T1..Ti-1)) : il est cherché dans [0, gi).
+// Les décalages sont des multiples du pas de temps du système (PGCD de ses
+// paramètres).
+
+// Nombre maximal de combinaisons par défaut
+#define COMBINAISONS_MAX_DEFAUT 1000000LL
+
+typedef struct {
+    int nb_taches;
+    temps_t pas;                  // Écart entre deux décalages essayés
+    temps_t *bornes;              // Décalages de la tâche i : 0, pas, ..., < bornes[i]
+    long long combinaisons;       // Combinaisons distinctes (-1 : hors capacité)
+    
+    // Résultats (rechercher_pire_decalage)
+    long long echecs;             // Combinaisons qui manquent au moins une échéance
+    long long premier_echec;      // Plus petite combinaison en échec (-1 : aucune)
+    temps_t *reponse_max;         // Pire temps de réponse de chaque tâche (-1 : aucune instance terminée)
+    long long *combinaison_max;   // Plus petite combinaison qui l'atteint
+} RechercheDecalages;
+
+// Options des programmes : décalages imposés et recherche du pire décalage
+typedef struct {
+    temps_t *decalages;           // Décalage de chaque tâche (NULL : activations synchrones)
+    int nb_decalages;
+    long long recherche_max;      // Combinaisons au plus pour la recherche (0 : pas de recherche)
+    int nb_threads;               // Threads de la recherche (0 : un par coeur)
+} OptionsDecalages;
+
+bool decalages_preparer(RechercheDecalages *recherche, const Systeme *modele);
+void decalages_combinaison(const RechercheDecalages *recherche, long long k, temps_t *decalages);
+bool rechercher_pire_decalage(RechercheDecalages *recherche, const Systeme *modele, int nb_threads);
+void decalages_liberer(RechercheDecalages *recherche);
+void ecrire_combinaison(const RechercheDecalages *recherche, long long k, FILE *sortie);
+
+bool lire_decalages(const char *texte, temps_t **decalages, int *nb_decalages);
+
+#endif
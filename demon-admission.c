@@ -0,0 +1,274 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "controle-admission.h"
+
+// Nombre maximal de clients connectés simultanément
+#define MAX_CLIENTS 64
+
+// Longueur maximale d'une requête (une ligne)
+#define TAILLE_REQUETE 256
+
+// Chemin par défaut de la socket
+#define SOCKET_DEFAUT "/tmp/ordonnanceur-admission.sock"
+
+// Client connecté et requête en cours de réception
+typedef struct {
+    int fd;
+    char tampon[TAILLE_REQUETE];
+    size_t longueur;
+} Client;
+
+static volatile sig_atomic_t arret = 0;
+
+// Fonction appelée à la réception de SIGINT ou SIGTERM
+static void demander_arret(int signal_recu) {
+    (void)signal_recu;
+    arret = 1;
+}
+
+// Fonction pour obtenir le texte d'une réponse du protocole
+static const char *texte_reponse(ReponseAdmission reponse) {
+    switch (reponse) {
+        case ADMISSION_ACCEPTEE: return "ACCEPTE";
+        case ADMISSION_REFUSEE:  return "REFUSE";
+        case ADMISSION_MEMOIRE:  return "MEMOIRE";
+        default:                 return "INVALIDE";
+    }
+}
+
+// Fonction pour traiter une requête et écrire la réponse dans reponse
+// AJOUTER id C D T [P], MODIFIER id C D T [P], RETIRER id, ETAT
+static void traiter_requete(ControleAdmission *controle, const char *requete, char *reponse, size_t taille) {
+    char commande[16];
+    int id;
+    ParametresTache tache = {0, 0, 0, 0, 0};
+    int position = 0;
+    int lus = sscanf(requete, "%15s %d%n", commande, &id, &position);
+    
+    // C, D et T acceptent une unité ("250us", "2ms"), comme dans les fichiers de lot
+    if (lus == 2) {
+        const char *p = requete + position;
+        temps_t *champs[3] = { &tache.duree_execution, &tache.echeance, &tache.periode };
+        for (int k = 0; k < 3 && lire_temps(p, champs[k], &p); k++) {
+            lus++;
+        }
+        if (lus == 5 && sscanf(p, "%d", &tache.priorite) == 1) {
+            lus++;
+        }
+    }
+    ReponseAdmission resultat = ADMISSION_INVALIDE;
+    
+    if (lus >= 1 && strcmp(commande, "ETAT") == 0) {
+        snprintf(reponse, taille, "ETAT %d %.6f\n", controle->nb_taches, controle_utilisation(controle));
+        return;
+    }
+    if (lus >= 5 && strcmp(commande, "AJOUTER") == 0) {
+        resultat = controle_ajouter(controle, id, &tache);
+    } else if (lus >= 5 && strcmp(commande, "MODIFIER") == 0) {
+        resultat = controle_modifier(controle, id, &tache);
+    } else if (lus >= 2 && strcmp(commande, "RETIRER") == 0) {
+        resultat = controle_retirer(controle, id);
+    }
+    snprintf(reponse, taille, "%s\n", texte_reponse(resultat));
+}
+
+// Fonction pour écrire une réponse complète (false si le client est parti)
+static bool envoyer(int fd, const char *texte) {
+    size_t longueur = strlen(texte);
+    
+    while (longueur > 0) {
+        ssize_t ecrit = write(fd, texte, longueur);
+        if (ecrit < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ecrit <= 0) {
+            return false;
+        }
+        texte += ecrit;
+        longueur -= ecrit;
+    }
+    return true;
+}
+
+// Fonction pour lire les données d'un client et répondre à chaque ligne complète
+// Renvoie false lorsque la connexion doit être fermée.
+static bool servir_client(ControleAdmission *controle, Client *client) {
+    ssize_t lu = read(client->fd, client->tampon + client->longueur, TAILLE_REQUETE - client->longueur);
+    char reponse[64];
+    
+    if (lu < 0 && errno == EINTR) {
+        return true;
+    }
+    if (lu <= 0) {
+        return false;
+    }
+    client->longueur += lu;
+    
+    for (;;) {
+        char *fin = memchr(client->tampon, '\n', client->longueur);
+        if (fin == NULL) {
+            break;
+        }
+        *fin = '\0';
+        traiter_requete(controle, client->tampon, reponse, sizeof(reponse));
+        if (!envoyer(client->fd, reponse)) {
+            return false;
+        }
+        client->longueur -= fin + 1 - client->tampon;
+        memmove(client->tampon, fin + 1, client->longueur);
+    }
+    
+    // Ligne trop longue : elle est refusée et ignorée
+    if (client->longueur == TAILLE_REQUETE) {
+        client->longueur = 0;
+        return envoyer(client->fd, "INVALIDE\n");
+    }
+    return true;
+}
+
+// Fonction pour ouvrir la socket d'écoute (une socket restée d'une exécution
+// précédente est remplacée)
+static int ouvrir_socket(const char *chemin) {
+    struct sockaddr_un adresse;
+    int fd;
+    
+    if (strlen(chemin) >= sizeof(adresse.sun_path)) {
+        fprintf(stderr, "Chemin de socket trop long: %s\n", chemin);
+        return -1;
+    }
+    memset(&adresse, 0, sizeof(adresse));
+    adresse.sun_family = AF_UNIX;
+    strcpy(adresse.sun_path, chemin);
+    
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+    unlink(chemin);
+    if (bind(fd, (struct sockaddr *)&adresse, sizeof(adresse)) < 0 || listen(fd, MAX_CLIENTS) < 0) {
+        perror(chemin);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Fonction pour afficher l'aide de la ligne de commande
+static void afficher_usage(const char *programme) {
+    printf("Usage: %s [options]\n\n", programme);
+    printf("Controle d'admission en ligne : repond aux demandes recues sur une socket Unix,\n");
+    printf("une requete par ligne, en ne reanalysant que les taches touchees.\n\n");
+    printf("  --socket CHEMIN          socket d'ecoute (defaut: %s)\n", SOCKET_DEFAUT);
+    printf("  --algo hpf|rm|dm|edf     politique d'ordonnancement (defaut: dm)\n\n");
+    printf("Requetes : AJOUTER id C D T [P], MODIFIER id C D T [P], RETIRER id, ETAT\n");
+    printf("Reponses : ACCEPTE, REFUSE, INVALIDE, MEMOIRE, ou ETAT nb_taches utilisation\n");
+}
+
+int main(int argc, char **argv) {
+    const char *chemin = SOCKET_DEFAUT;
+    TypeOrdonnanceur algorithme = DM;
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(argv[0]);
+            return 0;
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            return 1;
+        } else if (strcmp(argv[i], "--socket") == 0) {
+            chemin = valeur;
+        } else if (strcmp(argv[i], "--algo") == 0) {
+            if (strcmp(valeur, "hpf") == 0) {
+                algorithme = HPF;
+            } else if (strcmp(valeur, "rm") == 0) {
+                algorithme = RM;
+            } else if (strcmp(valeur, "dm") == 0) {
+                algorithme = DM;
+            } else if (strcmp(valeur, "edf") == 0) {
+                algorithme = EDF;
+            } else {
+                fprintf(stderr, "Algorithme inconnu: %s\n", valeur);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    
+    ControleAdmission controle;
+    controle_initialiser(&controle, algorithme);
+    int ecoute = ouvrir_socket(chemin);
+    if (ecoute < 0) {
+        return 1;
+    }
+    
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = demander_arret;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    
+    // Entrée 0 : socket d'écoute, entrées suivantes : clients
+    struct pollfd attente[MAX_CLIENTS + 1];
+    Client clients[MAX_CLIENTS];
+    int nb_clients = 0;
+    
+    fprintf(stderr, "Controle d'admission %s en attente sur %s\n", nom_court_algorithme(algorithme), chemin);
+    while (!arret) {
+        attente[0].fd = ecoute;
+        attente[0].events = POLLIN;
+        for (int c = 0; c < nb_clients; c++) {
+            attente[c + 1].fd = clients[c].fd;
+            attente[c + 1].events = POLLIN;
+        }
+        if (poll(attente, nb_clients + 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("poll");
+            break;
+        }
+        
+        // Les clients sont servis avant d'en accepter un nouveau (indices stables)
+        for (int c = nb_clients - 1; c >= 0; c--) {
+            if (attente[c + 1].revents != 0 && !servir_client(&controle, &clients[c])) {
+                close(clients[c].fd);
+                clients[c] = clients[--nb_clients];
+            }
+        }
+        if (attente[0].revents & POLLIN) {
+            int fd = accept(ecoute, NULL, NULL);
+            if (fd >= 0 && nb_clients < MAX_CLIENTS) {
+                clients[nb_clients].fd = fd;
+                clients[nb_clients].longueur = 0;
+                nb_clients++;
+            } else if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+    
+    for (int c = 0; c < nb_clients; c++) {
+        close(clients[c].fd);
+    }
+    close(ecoute);
+    unlink(chemin);
+    controle_liberer(&controle);
+    return 0;
+}
@@ -0,0 +1,440 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include "executeur.h"
+
+// Délai entre le lancement des threads et la première tranche
+#define DELAI_DEMARRAGE_NS 20000000LL
+
+// Fonction pour libérer une table de répartition
+void table_liberer(TableRepartition *table) {
+    free(table->tranches);
+    table->tranches = NULL;
+    table->nb_tranches = 0;
+}
+
+// Fonction pour ajouter une tranche d'exécution à la table (fusionnée avec la
+// précédente si c'est la suite de la même instance)
+static void ajouter_tranche(TableRepartition *table, int *derniere_instance, const EvenementTrace *evenement) {
+    TrancheTable *precedente = table->nb_tranches > 0 ? &table->tranches[table->nb_tranches - 1] : NULL;
+    
+    if (precedente != NULL && precedente->tache == evenement->tache &&
+        precedente->instance == evenement->instance &&
+        precedente->debut + precedente->duree == evenement->temps) {
+        precedente->duree += evenement->valeur;
+        return;
+    }
+    TrancheTable *tranche = &table->tranches[table->nb_tranches++];
+    tranche->debut = evenement->temps;
+    tranche->duree = evenement->valeur;
+    tranche->tache = evenement->tache;
+    tranche->instance = evenement->instance;
+    tranche->debut_instance = derniere_instance[evenement->tache] != evenement->instance;
+    tranche->fin_instance = false;
+    derniere_instance[evenement->tache] = evenement->instance;
+}
+
+// Fonction pour compiler la simulation d'une hyperpériode en table de répartition
+// La simulation est refaite avec une trace complète en mémoire (trace, métriques
+// et mode du système sont rétablis ensuite). Le plan doit être faisable et
+// cyclique : toute instance activée dans l'hyperpériode y est terminée, la table
+// peut alors être rejouée en boucle. Renvoie false (message sur stderr) sinon.
+bool table_construire(TableRepartition *table, Systeme *systeme) {
+    Trace trace;
+    Trace *trace_systeme = systeme->trace;
+    Metriques *metriques_systeme = systeme->metriques;
+    bool verdict_seul = systeme->verdict_seul;
+    PolitiqueEchec politique_echec = systeme->politique_echec;
+    long long instances = 0;
+    long long terminees = 0;
+    
+    table->tranches = NULL;
+    table->nb_tranches = 0;
+    table->hyperperiode = systeme->hyperperiode;
+    if (systeme->hyperperiode <= 0) {
+        fprintf(stderr, "Table: hyperperiode hors capacite\n");
+        return false;
+    }
+    
+    // Chaque instance donne une activation, une terminaison, au plus une
+    // préemption et une période d'inactivité ; les segments d'exécution sont
+    // coupés à chaque activation, échéance ou terminaison (au plus 3 par instance)
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        instances += systeme->hyperperiode / systeme->parametres[i].periode;
+    }
+    if (instances > (TAILLE_TABLE_MAX - 16) / 8) {
+        fprintf(stderr, "Table: %lld instances par hyperperiode, trop pour une table\n", instances);
+        return false;
+    }
+    // Avec des ressources partagées, chaque section ajoute un verrouillage, une
+    // libération et deux coupures de segment, et chaque segment peut tracer un
+    // blocage et une inversion par tâche en attente
+    long long evenements = 8 * instances;
+    // Une commutation de contexte peut précéder chaque segment, et chaque point
+    // de préemption coupe un segment
+    if (systeme->commutation > 0) {
+        evenements += 3 * instances;
+    }
+    for (int i = 0; systeme->preemption == PREEMPTION_POINTS && i < systeme->nb_taches; i++) {
+        evenements += 2 * (systeme->hyperperiode / systeme->parametres[i].periode) *
+                      (systeme->parametres[i].duree_execution / systeme->points + 1);
+    }
+    if (systeme->ressources != NULL) {
+        const JeuRessources *ressources = systeme->ressources;
+        for (int i = 0; i < systeme->nb_taches; i++) {
+            evenements += 4 * (systeme->hyperperiode / systeme->parametres[i].periode) *
+                          (ressources->premiere_section[i + 1] - ressources->premiere_section[i]);
+        }
+        evenements *= 2 * systeme->nb_taches + 1;
+    }
+    if (!trace_creer_anneau(&trace, TRACE_COMPLET, (size_t)(evenements + 16))) {
+        fprintf(stderr, "Table: memoire insuffisante\n");
+        return false;
+    }
+    
+    // Les tâches repartent de leur première activation (priorités et décalages inchangés)
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        Tache *tache = &systeme->taches[i];
+        initialiser_tache(tache, tache->id, tache->duree_execution, tache->echeance, tache->periode,
+                          tache->priorite, tache->decalage);
+    }
+    systeme->trace = &trace;
+    systeme->metriques = NULL;
+    systeme->verdict_seul = false;
+    systeme->politique_echec = ECHEC_CONTINUER;
+    bool faisable = simuler_ordonnancement(systeme, systeme->hyperperiode);
+    systeme->trace = trace_systeme;
+    systeme->metriques = metriques_systeme;
+    systeme->verdict_seul = verdict_seul;
+    systeme->politique_echec = politique_echec;
+    
+    int *derniere_instance = malloc(systeme->nb_taches * sizeof(int));
+    table->tranches = malloc(trace.nb * sizeof(TrancheTable));
+    if (derniere_instance == NULL || table->tranches == NULL) {
+        fprintf(stderr, "Table: memoire insuffisante\n");
+        faisable = false;
+    } else if (!faisable) {
+        fprintf(stderr, "Table: le plan simule manque une echeance\n");
+    } else if (trace.perdus > 0) {
+        fprintf(stderr, "Table: trace de l'hyperperiode incomplete\n");
+        faisable = false;
+    } else {
+        for (int i = 0; i < systeme->nb_taches; i++) {
+            derniere_instance[i] = 0;
+        }
+        for (size_t k = 0; k < trace.nb; k++) {
+            const EvenementTrace *evenement = trace_lire(&trace, k);
+            if (evenement->type == EVT_EXECUTION) {
+                ajouter_tranche(table, derniere_instance, evenement);
+            } else if (evenement->type == EVT_TERMINAISON) {
+                // La terminaison suit le segment qui l'a produite
+                table->tranches[table->nb_tranches - 1].fin_instance = true;
+                terminees++;
+            }
+        }
+        if (terminees != instances) {
+            fprintf(stderr, "Table: plan non cyclique, des instances restent en cours a la fin "
+                            "de l'hyperperiode\n");
+            faisable = false;
+        }
+    }
+    
+    free(derniere_instance);
+    trace_fermer(&trace);
+    if (!faisable) {
+        table_liberer(table);
+    }
+    return faisable;
+}
+
+// Thread d'une tâche : chaque tranche consomme duree_ns de temps processeur en
+// boucle active (le travail prend plus longtemps si le thread est interrompu)
+typedef struct {
+    pthread_t thread;
+    sem_t depart;
+    sem_t *termine;           // Signalé au répartiteur à la fin de chaque tranche
+    long long duree_ns;       // Tranche à exécuter, écrite avant depart
+    long long debut;          // Début et fin réels de la tranche (horloge monotone)
+    long long fin;
+    bool arret;
+} Ouvrier;
+
+// Fonction pour lire une horloge en nanosecondes
+static inline long long horloge_ns(clockid_t horloge) {
+    struct timespec ts;
+    clock_gettime(horloge, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Fonction pour dormir jusqu'à une date absolue de l'horloge monotone
+static void attendre_jusqua(long long date) {
+    struct timespec ts = { (time_t)(date / 1000000000LL), (long)(date % 1000000000LL) };
+    
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
+
+// Fonction exécutée par le thread d'une tâche
+static void *executer_ouvrier(void *argument) {
+    Ouvrier *ouvrier = argument;
+    
+    for (;;) {
+        while (sem_wait(&ouvrier->depart) != 0) {
+        }
+        if (ouvrier->arret) {
+            return NULL;
+        }
+        ouvrier->debut = horloge_ns(CLOCK_MONOTONIC);
+        long long cible = horloge_ns(CLOCK_THREAD_CPUTIME_ID) + ouvrier->duree_ns;
+        while (horloge_ns(CLOCK_THREAD_CPUTIME_ID) < cible) {
+        }
+        ouvrier->fin = horloge_ns(CLOCK_MONOTONIC);
+        sem_post(ouvrier->termine);
+    }
+}
+
+// Fonction pour épingler un thread sur un cœur (false si refusé)
+static bool epingler(pthread_t thread, int coeur) {
+    cpu_set_t ensemble;
+    
+    CPU_ZERO(&ensemble);
+    CPU_SET(coeur, &ensemble);
+    return pthread_setaffinity_np(thread, sizeof(ensemble), &ensemble) == 0;
+}
+
+// Fonction pour passer un thread en SCHED_FIFO (false si refusé, sans droits)
+static bool passer_temps_reel(pthread_t thread, int priorite) {
+    struct sched_param parametre = { .sched_priority = priorite };
+    
+    return pthread_setschedparam(thread, SCHED_FIFO, &parametre) == 0;
+}
+
+// Fonction pour choisir le cœur d'exécution : le premier cœur autorisé par défaut
+static int choisir_coeur(int demande) {
+    cpu_set_t autorises;
+    
+    if (demande >= 0 || sched_getaffinity(0, sizeof(autorises), &autorises) != 0) {
+        return demande >= 0 ? demande : 0;
+    }
+    for (int c = 0; c < CPU_SETSIZE; c++) {
+        if (CPU_ISSET(c, &autorises)) {
+            return c;
+        }
+    }
+    return 0;
+}
+
+// Fonction pour enregistrer les mesures d'une tranche exécutée
+static void mesurer_tranche(MesuresTache *m, const TrancheTable *tranche, const ParametresTache *parametres,
+                            const Ouvrier *ouvrier, long long origine, long long unite_ns) {
+    long long prevu = origine + tranche->debut * unite_ns;
+    long long latence = ouvrier->debut - prevu;
+    
+    histogramme_ajouter(&m->latence, latence);
+    if (tranche->debut_instance) {
+        if (latence < m->latence_debut_min) {
+            m->latence_debut_min = latence;
+        }
+        if (latence > m->latence_debut_max) {
+            m->latence_debut_max = latence;
+        }
+    }
+    if (tranche->fin_instance) {
+        long long activation = (tranche->instance - 1) * parametres->periode;
+        long long ecart = ouvrier->fin - (prevu + tranche->duree * unite_ns);
+        if (ouvrier->fin > origine + (activation + parametres->echeance) * unite_ns) {
+            m->echeances_manquees++;
+        }
+        if (m->instances == 0 || ecart > m->ecart_fin_max) {
+            m->ecart_fin_max = ecart;
+        }
+        m->instances++;
+    }
+}
+
+// Fonction pour exécuter une table de répartition pendant options->cycles hyperpériodes
+// Le répartiteur (thread appelant) dort jusqu'au début prévu de chaque tranche,
+// la confie au thread de sa tâche et attend sa fin : une tranche en retard
+// décale les suivantes, ce que mesurent les latences. Tous les threads sont
+// épinglés sur le même cœur ; en SCHED_FIFO (si permis), le répartiteur est
+// plus prioritaire que les tâches. Le thread appelant retrouve ensuite son
+// cœur et sa politique. Renvoie false si les threads n'ont pu être créés.
+bool table_executer(const TableRepartition *table, const ParametresTache *parametres, int nb_taches,
+                    const OptionsExecution *options, MesuresExecution *mesures) {
+    pthread_t repartiteur = pthread_self();
+    cpu_set_t affinite;
+    struct sched_param parametre_initial;
+    int politique_initiale;
+    sem_t termine;
+    int nb_ouvriers = 0;
+    bool reussi = true;
+    
+    mesures->taches = calloc(nb_taches > 0 ? nb_taches : 1, sizeof(MesuresTache));
+    mesures->nb_taches = nb_taches;
+    Ouvrier *ouvriers = calloc(nb_taches > 0 ? nb_taches : 1, sizeof(Ouvrier));
+    if (mesures->taches == NULL || ouvriers == NULL || sem_init(&termine, 0, 0) != 0) {
+        fprintf(stderr, "Execution: memoire insuffisante\n");
+        free(ouvriers);
+        mesures_liberer(mesures);
+        return false;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        mesures->taches[i].latence_debut_min = LLONG_MAX;
+    }
+    
+    pthread_getaffinity_np(repartiteur, sizeof(affinite), &affinite);
+    pthread_getschedparam(repartiteur, &politique_initiale, &parametre_initial);
+    mesures->coeur = choisir_coeur(options->coeur);
+    if (!epingler(repartiteur, mesures->coeur)) {
+        mesures->coeur = -1;
+    }
+    int priorite = sched_get_priority_min(SCHED_FIFO) + 1;
+    mesures->temps_reel = passer_temps_reel(repartiteur, priorite + 1);
+    
+    for (int i = 0; i < nb_taches && reussi; i++) {
+        Ouvrier *ouvrier = &ouvriers[i];
+        ouvrier->termine = &termine;
+        if (sem_init(&ouvrier->depart, 0, 0) != 0) {
+            reussi = false;
+        } else if (pthread_create(&ouvrier->thread, NULL, executer_ouvrier, ouvrier) != 0) {
+            sem_destroy(&ouvrier->depart);
+            reussi = false;
+        } else {
+            nb_ouvriers++;
+            if (mesures->coeur >= 0) {
+                epingler(ouvrier->thread, mesures->coeur);
+            }
+            if (mesures->temps_reel) {
+                mesures->temps_reel = passer_temps_reel(ouvrier->thread, priorite);
+            }
+        }
+    }
+    
+    if (reussi) {
+        long long origine = horloge_ns(CLOCK_MONOTONIC) + DELAI_DEMARRAGE_NS;
+        for (int cycle = 0; cycle < options->cycles; cycle++) {
+            for (int k = 0; k < table->nb_tranches; k++) {
+                const TrancheTable *tranche = &table->tranches[k];
+                Ouvrier *ouvrier = &ouvriers[tranche->tache];
+                
+                attendre_jusqua(origine + tranche->debut * options->unite_ns);
+                ouvrier->duree_ns = tranche->duree * options->unite_ns;
+                sem_post(&ouvrier->depart);
+                while (sem_wait(&termine) != 0) {
+                }
+                mesurer_tranche(&mesures->taches[tranche->tache], tranche, &parametres[tranche->tache],
+                                ouvrier, origine, options->unite_ns);
+            }
+            origine += table->hyperperiode * options->unite_ns;
+        }
+    } else {
+        fprintf(stderr, "Execution: impossible de creer les threads des taches\n");
+    }
+    
+    for (int i = 0; i < nb_ouvriers; i++) {
+        ouvriers[i].arret = true;
+        sem_post(&ouvriers[i].depart);
+        pthread_join(ouvriers[i].thread, NULL);
+        sem_destroy(&ouvriers[i].depart);
+    }
+    sem_destroy(&termine);
+    free(ouvriers);
+    pthread_setschedparam(repartiteur, politique_initiale, &parametre_initial);
+    pthread_setaffinity_np(repartiteur, sizeof(affinite), &affinite);
+    if (!reussi) {
+        mesures_liberer(mesures);
+    }
+    return reussi;
+}
+
+// Fonction pour libérer les mesures d'une exécution
+void mesures_liberer(MesuresExecution *mesures) {
+    free(mesures->taches);
+    mesures->taches = NULL;
+    mesures->nb_taches = 0;
+}
+
+// Fonction pour afficher les mesures d'une exécution (durées en microsecondes)
+// La latence est l'écart entre le début réel et le début prévu d'une tranche ;
+// la gigue, l'écart entre la plus grande et la plus petite latence de
+// démarrage des instances ; l'écart de fin, le retard maximal sur le plan.
+void mesures_afficher(const MesuresExecution *mesures, const TableRepartition *table,
+                      const OptionsExecution *options, FILE *sortie) {
+    long long manquees = 0;
+    char coeur[16] = "non epingle";
+    
+    if (mesures->coeur >= 0) {
+        snprintf(coeur, sizeof(coeur), "%d", mesures->coeur);
+    }
+    fprintf(sortie, "+------------------------------------------------+\n");
+    fprintf(sortie, "|         EXECUTION REELLE DE LA TABLE           |\n");
+    fprintf(sortie, "+------------------------------------------------+\n");
+    fprintf(sortie, "| Tranches par hyperperiode: %-19d |\n", table->nb_tranches);
+    fprintf(sortie, "| Hyperperiodes executees  : %-19d |\n", options->cycles);
+    fprintf(sortie, "| Unite de temps (us)      : %-19.1f |\n", options->unite_ns / 1000.0);
+    fprintf(sortie, "| Coeur                    : %-19s |\n", coeur);
+    fprintf(sortie, "| Politique                : %-19s |\n",
+            mesures->temps_reel ? "SCHED_FIFO" : "SCHED_OTHER");
+    fprintf(sortie, "+------------------------------------------------+\n\n");
+    
+    fprintf(sortie, "Tache  Instances  Manquees  Latence moy   p99      max (us)  Gigue (us)  Ecart fin max (us)\n");
+    for (int i = 0; i < mesures->nb_taches; i++) {
+        const MesuresTache *m = &mesures->taches[i];
+        const Histogramme *latence = &m->latence;
+        
+        manquees += m->echeances_manquees;
+        if (m->instances == 0) {
+            fprintf(sortie, "%-5d  %9d  %8d  %11s %8s %8s  %10s  %18s\n", i + 1, 0, 0, "-", "-", "-", "-", "-");
+            continue;
+        }
+        fprintf(sortie, "%-5d  %9lld  %8lld  %11.1f %8.1f %8.1f  %10.1f  %18.1f\n", i + 1, m->instances,
+                m->echeances_manquees, histogramme_moyenne(latence) / 1000.0,
+                histogramme_quantile(latence, 0.99) / 1000.0, latence->max / 1000.0,
+                (m->latence_debut_max - m->latence_debut_min) / 1000.0, m->ecart_fin_max / 1000.0);
+    }
+    fprintf(sortie, "\n");
+    if (manquees == 0) {
+        fprintf(sortie, ">> Aucune echeance manquee en execution reelle (conforme au plan simule)\n");
+    } else {
+        fprintf(sortie, ">> %lld echeance(s) manquee(s) en execution reelle (aucune dans le plan simule)\n",
+                manquees);
+    }
+    if (!mesures->temps_reel) {
+        fprintf(sortie, ">> SCHED_FIFO refuse (droits insuffisants) : threads en SCHED_OTHER\n");
+    }
+}
+
+// Fonction pour exécuter réellement le plan simulé d'un système et afficher les
+// mesures (false si la table n'a pu être construite ou exécutée)
+bool executer_plan(Systeme *systeme, const OptionsExecution *options) {
+    TableRepartition table;
+    MesuresExecution mesures;
+    
+    if (!table_construire(&table, systeme)) {
+        printf(">> Execution reelle impossible (voir ci-dessus)\n");
+        return false;
+    }
+    long long duree_ns;
+    if (__builtin_mul_overflow(table.hyperperiode, options->unite_ns, &duree_ns) ||
+        __builtin_mul_overflow(duree_ns, (long long)options->cycles, &duree_ns)) {
+        printf(">> Execution reelle impossible : duree reelle hors capacite\n");
+        table_liberer(&table);
+        return false;
+    }
+    printf(">> Execution de la table (%d tranches, hyperperiode %lld) pendant %d hyperperiode(s)...\n\n",
+           table.nb_tranches, table.hyperperiode, options->cycles);
+    fflush(stdout);
+    bool reussi = table_executer(&table, systeme->parametres, systeme->nb_taches, options, &mesures);
+    if (reussi) {
+        mesures_afficher(&mesures, &table, options, stdout);
+        mesures_liberer(&mesures);
+    }
+    table_liberer(&table);
+    return reussi;
+}
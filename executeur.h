@@ -0,0 +1,73 @@
+#ifndef EXECUTEUR_H
+#define EXECUTEUR_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "tache.h"
+#include "metriques.h"
+#include "moteur-simulation.h"
+
+// Exécution réelle sous Linux d'un ordonnancement simulé : la simulation d'une
+// hyperpériode est compilée en table de tranches (qui exécute quoi, quand), puis
+// un répartiteur rejoue la table en boucle. Chaque tâche a son thread, qui
+// consomme en boucle active le temps processeur de ses tranches ; tous les
+// threads sont épinglés sur un même cœur, en SCHED_FIFO lorsque c'est permis.
+
+// Nombre maximal d'événements de la simulation compilée en table
+#define TAILLE_TABLE_MAX (1 << 20)
+
+// Tranche de la table : la tâche s'exécute de debut à debut + duree
+typedef struct {
+    temps_t debut;
+    temps_t duree;
+    int tache;
+    int instance;             // Numéro de l'instance dans l'hyperpériode (à partir de 1)
+    bool debut_instance;      // Première tranche de l'instance
+    bool fin_instance;        // Dernière tranche de l'instance
+} TrancheTable;
+
+// Table de répartition d'une hyperpériode (tranches par date croissante,
+// deux tranches consécutives d'une même instance sont fusionnées)
+typedef struct {
+    TrancheTable *tranches;
+    int nb_tranches;
+    temps_t hyperperiode;
+} TableRepartition;
+
+// Options d'exécution
+typedef struct {
+    long long unite_ns;       // Durée réelle d'une unité de temps
+    int cycles;               // Nombre d'hyperpériodes exécutées
+    int coeur;                // Cœur d'exécution (-1 : premier cœur autorisé)
+} OptionsExecution;
+
+// Mesures d'une tâche (durées en nanosecondes)
+typedef struct {
+    Histogramme latence;      // Début réel - début prévu de chaque tranche
+    long long instances;
+    long long echeances_manquees; // Fin réelle après l'échéance absolue
+    long long latence_debut_min; // Latence de la première tranche des instances
+    long long latence_debut_max; //   (leur écart est la gigue de démarrage)
+    long long ecart_fin_max;  // Plus grand écart fin réelle - fin prévue
+} MesuresTache;
+
+// Mesures d'une exécution
+typedef struct {
+    MesuresTache *taches;
+    int nb_taches;
+    int coeur;                // Cœur utilisé (-1 : épinglage refusé)
+    bool temps_reel;          // Threads en SCHED_FIFO
+} MesuresExecution;
+
+bool table_construire(TableRepartition *table, Systeme *systeme);
+void table_liberer(TableRepartition *table);
+
+bool table_executer(const TableRepartition *table, const ParametresTache *parametres, int nb_taches,
+                    const OptionsExecution *options, MesuresExecution *mesures);
+void mesures_afficher(const MesuresExecution *mesures, const TableRepartition *table,
+                      const OptionsExecution *options, FILE *sortie);
+void mesures_liberer(MesuresExecution *mesures);
+
+bool executer_plan(Systeme *systeme, const OptionsExecution *options);
+
+#endif
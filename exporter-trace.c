@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace.h"
+
+// Fonction pour afficher l'aide de la ligne de commande
+void afficher_usage(const char *programme) {
+    printf("Usage: %s TRACE [options]\n\n", programme);
+    printf("Convertit une trace binaire (--trace des simulateurs) hors ligne.\n\n");
+    printf("Options:\n");
+    printf("  --format texte|chrome  texte lisible ou JSON chrome://tracing / Perfetto (defaut: texte)\n");
+    printf("  --sortie FICHIER       fichier produit (defaut: sortie standard)\n");
+}
+
+int main(int argc, char **argv) {
+    const char *chemin = NULL;
+    const char *chemin_sortie = NULL;
+    bool chrome = false;
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(argv[0]);
+            return 0;
+        } else if (argv[i][0] != '-') {
+            chemin = argv[i];
+            continue;
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            return 1;
+        } else if (strcmp(argv[i], "--sortie") == 0) {
+            chemin_sortie = valeur;
+        } else if (strcmp(argv[i], "--format") == 0) {
+            chrome = strcmp(valeur, "chrome") == 0;
+            if (!chrome && strcmp(valeur, "texte") != 0) {
+                fprintf(stderr, "Format inconnu: %s\n", valeur);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    
+    if (chemin == NULL) {
+        afficher_usage(argv[0]);
+        return 1;
+    }
+    
+    Trace trace;
+    ParametresTache *parametres;
+    int nb_taches;
+    if (!trace_charger(&trace, chemin, &parametres, &nb_taches)) {
+        return 1;
+    }
+    
+    FILE *sortie = chemin_sortie != NULL ? fopen(chemin_sortie, "w") : stdout;
+    int code = 0;
+    if (sortie == NULL) {
+        perror(chemin_sortie);
+        code = 1;
+    } else {
+        if (chrome) {
+            trace_exporter_chrome(&trace, parametres, nb_taches, sortie);
+        } else {
+            trace_exporter_texte(&trace, parametres, nb_taches, sortie);
+        }
+        if (sortie != stdout && fclose(sortie) != 0) {
+            perror(chemin_sortie);
+            code = 1;
+        }
+    }
+    
+    trace_fermer(&trace);
+    free(parametres);
+    return code;
+}
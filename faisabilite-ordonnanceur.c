@@ -1,233 +1,264 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include "analyse.h"
+#include "decalages.h"
+#include "moteur-simulation.h"
+#include "executeur.h"
+#include "ligne-commande.h"
+#include "lot-taches.h"
 
-// Énumération pour les types d'algorithmes d'ordonnancement
-typedef enum {
-    HPF,  // Highest Priority First
-    RM,   // Rate Monotonic
-    DM    // Deadline Monotonic
-} TypeOrdonnanceur;
-
-// Structure pour représenter une tâche temps réel
-typedef struct {
-    int id;                    // Identifiant de la tâche
-    int duree_execution;       // Durée d'exécution (C)
-    int echeance;             // Échéance relative (D)
-    int periode;              // Période (T)
-    int priorite;             // Priorité (plus grand = haute priorité)
+// Fonction pour afficher l'analyse RTA et la comparer au résultat de la simulation
+// Si les tâches partagent des ressources, chaque temps de réponse inclut le
+// blocage B par des tâches moins prioritaires borné par le protocole ; le test
+// n'est alors que suffisant (la simulation synchrone n'est plus le pire cas,
+// et l'héritage accélère parfois une tâche). Il en va de même en préemption
+// limitée ou avec des commutations payantes (deux par instance dans l'analyse),
+// et avec des activations décalées (l'instant critique synchrone majore).
+void afficher_analyse_temps_reponse(Systeme *systeme, bool resultat_simulation) {
+    long long *temps_reponse = malloc(systeme->nb_taches * sizeof(long long));
+    long long *blocages = NULL;
+    bool limitee = systeme->preemption != PREEMPTION_TOTALE || systeme->commutation > 0;
+    bool faisable;
     
-    // Variables pour la simulation
-    int temps_restant;        // Temps d'exécution restant pour l'instance courante
-    int prochaine_activation; // Prochaine activation de la tâche
-    int prochaine_echeance;   // Prochaine échéance absolue
-} Tache;
-
-// Structure pour stocker l'état du système
-typedef struct {
-    Tache *taches;
-    int nb_taches;
-    TypeOrdonnanceur algorithme;
-} Systeme;
-
-// Fonction pour initialiser une tâche
-void initialiser_tache(Tache *tache, int id, int duree, int echeance, int periode, int priorite) {
-    tache->id = id;
-    tache->duree_execution = duree;
-    tache->echeance = echeance;
-    tache->periode = periode;
-    tache->priorite = priorite;
-    tache->temps_restant = 0;
-    tache->prochaine_activation = 0;
-    tache->prochaine_echeance = echeance;
-}
-
-// Fonction pour calculer les priorités selon Rate Monotonic (plus courte période = plus haute priorité)
-void calculer_priorites_rm(Systeme *systeme) {
-    // Trouver les périodes pour assigner les priorités
-    for (int i = 0; i < systeme->nb_taches; i++) {
-        int priorite = 1000; // Priorité de base élevée
-        for (int j = 0; j < systeme->nb_taches; j++) {
-            if (systeme->taches[j].periode < systeme->taches[i].periode) {
-                priorite--;
-            }
+    if (systeme->ressources != NULL) {
+        blocages = malloc((systeme->nb_taches > 0 ? systeme->nb_taches : 1) * sizeof(long long));
+        if (blocages == NULL) {
+            fprintf(stderr, "Memoire insuffisante pour l'analyse des blocages\n");
+            free(temps_reponse);
+            return;
         }
-        systeme->taches[i].priorite = priorite;
+        ressources_blocages(systeme->ressources, systeme->nb_taches, blocages);
     }
-}
-
-// Fonction pour calculer les priorités selon Deadline Monotonic (plus courte échéance = plus haute priorité)
-void calculer_priorites_dm(Systeme *systeme) {
-    // Trouver les échéances pour assigner les priorités
-    for (int i = 0; i < systeme->nb_taches; i++) {
-        int priorite = 1000; // Priorité de base élevée
-        for (int j = 0; j < systeme->nb_taches; j++) {
-            if (systeme->taches[j].echeance < systeme->taches[i].echeance) {
-                priorite--;
-            }
+    if (limitee) {
+        ParametresTache *parametres = parametres_avec_commutation(systeme->parametres, systeme->nb_taches,
+                                                                  systeme->commutation);
+        int *seuils = malloc((systeme->nb_taches > 0 ? systeme->nb_taches : 1) * sizeof(int));
+        if (parametres == NULL || seuils == NULL) {
+            fprintf(stderr, "Memoire insuffisante pour l'analyse en preemption limitee\n");
+            free(parametres);
+            free(seuils);
+            free(blocages);
+            free(temps_reponse);
+            return;
+        }
+        for (int i = 0; i < systeme->nb_taches; i++) {
+            seuils[i] = systeme->taches[i].seuil;
         }
-        systeme->taches[i].priorite = priorite;
+        faisable = systeme->preemption == PREEMPTION_TOTALE ?
+                   analyser_temps_reponse_blocage(parametres, systeme->nb_taches, blocages, temps_reponse) :
+                   analyser_preemption_limitee(parametres, systeme->nb_taches, systeme->preemption, seuils,
+                                               systeme->points, temps_reponse);
+        free(parametres);
+        free(seuils);
+    } else {
+        faisable = analyser_temps_reponse_blocage(systeme->parametres, systeme->nb_taches, blocages,
+                                                  temps_reponse);
     }
-}
-
-// Fonction pour trouver la tâche avec la plus haute priorité prête à s'exécuter (HPF, RM, DM)
-int trouver_tache_priorite_max(Systeme *systeme) {
-    int tache_selectionnee = -1;
-    int priorite_max = -1;
     
+    printf("+------------------------------------------------+\n");
+    printf("|      ANALYSE DES TEMPS DE REPONSE (RTA)        |\n");
+    printf("+------------------------------------------------+\n");
     for (int i = 0; i < systeme->nb_taches; i++) {
-        Tache *tache = &systeme->taches[i];
-        
-        // Vérifier si la tâche a du temps d'exécution restant
-        if (tache->temps_restant > 0) {
-            if (tache->priorite > priorite_max) {
-                priorite_max = tache->priorite;
-                tache_selectionnee = i;
-            }
+        const ParametresTache *tache = &systeme->parametres[i];
+        if (blocages != NULL && blocages[i] == BLOCAGE_NON_BORNE) {
+            printf("| Tache %-2d: blocage non borne -> MANQUEE         |\n", systeme->taches[i].id);
+            continue;
+        }
+        if (blocages != NULL) {
+            printf("| Tache %-2d: blocage B=%-6lld                     |\n", systeme->taches[i].id, blocages[i]);
+        }
+        if (temps_reponse[i] < 0) {
+            printf("| Tache %-2d: R non borne -> MANQUEE               |\n", systeme->taches[i].id);
+        } else if (temps_reponse[i] <= tache->echeance) {
+            printf("| Tache %-2d: R=%-6lld D=%-6lld -> respectee       |\n", 
+                   systeme->taches[i].id, temps_reponse[i], tache->echeance);
+        } else {
+            printf("| Tache %-2d: R>=%-5lld D=%-6lld -> MANQUEE         |\n", 
+                   systeme->taches[i].id, temps_reponse[i], tache->echeance);
         }
     }
+    printf("+------------------------------------------------+\n");
+    printf("| Verdict RTA: %-33s |\n", faisable ? "FAISABLE" : "NON FAISABLE");
+    printf("| Simulation : %-33s |\n", 
+           systeme->non_conclu ? "non concluante" :
+           faisable == resultat_simulation ? "concordante" :
+           (blocages != NULL || limitee || systeme->asynchrone) && !faisable ?
+           "favorable (test suffisant)" : "DIVERGENTE");
+    printf("+------------------------------------------------+\n\n");
     
-    return tache_selectionnee;
+    free(temps_reponse);
+    free(blocages);
 }
 
-// Fonction pour vérifier si toutes les tâches sont simultanément terminées
-bool toutes_taches_terminees_simultanement(Systeme *systeme) {
-    for (int i = 0; i < systeme->nb_taches; i++) {
-        if (systeme->taches[i].temps_restant > 0) {
-            return false;
-        }
+// Fonction pour afficher les sections critiques et le protocole d'accès
+void afficher_ressources(const JeuRessources *ressources) {
+    printf("| Ressources: %-3d  protocole: %-18s |\n", ressources->nb_ressources,
+           nom_protocole(ressources->protocole));
+    for (int s = 0; s < ressources->nb_sections; s++) {
+        const SectionCritique *section = &ressources->sections[s];
+        printf("|   T%-2d %-12s debut=%-6lld duree=%-6lld   |\n", section->tache + 1,
+               ressources->noms[section->ressource], section->debut, section->duree);
     }
-    return true;
 }
 
-// Fonction pour activer les tâches à un instant donné
-bool activer_taches(Systeme *systeme, int temps_actuel) {
-    bool aucune_echeance_manquee = true;
-    
-    for (int i = 0; i < systeme->nb_taches; i++) {
-        Tache *tache = &systeme->taches[i];
-        
-        // Vérifier si c'est le moment d'activer la tâche
-        if (temps_actuel == tache->prochaine_activation) {
-            // Vérifier si l'instance précédente n'est pas terminée (échéance manquée)
-            if (tache->temps_restant > 0) {
-                printf("  >> ECHEANCE MANQUEE pour la tache %d (temps restant: %d)\n", 
-                       tache->id, tache->temps_restant);
-                aucune_echeance_manquee = false;
-            }
-            
-            tache->temps_restant = tache->duree_execution;
-            printf("  -> Activation de la tache %d (echeance: %d)\n", 
-                   tache->id, tache->prochaine_echeance);
-            
-            // Programmer la prochaine activation et échéance
-            tache->prochaine_activation += tache->periode;
-            tache->prochaine_echeance += tache->periode;
+// Fonction pour afficher le mode de préemption, le coût des commutations et,
+// avec des seuils, le niveau et le seuil attribué à chaque tâche
+void afficher_preemption(const Systeme *systeme, bool seuils_faisables) {
+    printf("| Preemption: %-8s  commutation: %-11lld |\n", nom_mode_preemption(systeme->preemption),
+           systeme->commutation);
+    if (systeme->preemption == PREEMPTION_POINTS) {
+        printf("|   troncons non preemptibles: %-17lld |\n", systeme->points);
+    }
+    if (systeme->preemption == PREEMPTION_SEUILS) {
+        for (int i = 0; i < systeme->nb_taches; i++) {
+            printf("|   T%-2d niveau=%-3d seuil=%-3d                     |\n", systeme->taches[i].id,
+                   systeme->taches[i].niveau, systeme->taches[i].seuil);
         }
+        printf("|   seuils: %-36s |\n", seuils_faisables ? "minimisent les preemptions" :
+               "jeu non ordonnancable (niveaux)");
     }
-    
-    return aucune_echeance_manquee;
 }
 
-// Fonction pour obtenir le nom de l'algorithme
-const char* nom_algorithme(TypeOrdonnanceur algo) {
-    switch (algo) {
-        case HPF: return "HPF (Highest Priority First)";
-        case RM:  return "RM (Rate Monotonic)";
-        case DM:  return "DM (Deadline Monotonic)";
-        default:  return "Inconnu";
+// Fonction pour rechercher le pire décalage d'activation et afficher, pour
+// chaque tâche, le pire temps de réponse simulé et les décalages qui l'atteignent
+void afficher_pire_decalage(const Systeme *systeme, const OptionsDecalages *options) {
+    RechercheDecalages recherche;
+    EtatRecherche etat = lancer_recherche_decalages(&recherche, systeme, options);
+    
+    if (etat == RECHERCHE_IMPOSSIBLE) {
+        return;
     }
-}
-
-// Fonction principale de simulation adaptée à tous les algorithmes
-bool simuler_ordonnancement(Systeme *systeme) {
     printf("+------------------------------------------------+\n");
-    printf("|         SIMULATION %s               |\n", 
-           systeme->algorithme == HPF ? "HPF PREEMPTIF" :
-           systeme->algorithme == RM ? "RM PREEMPTIF " : "DM PREEMPTIF ");
-    printf("+------------------------------------------------+");
-    
-    int temps = 0;
+    printf("|          RECHERCHE DU PIRE DECALAGE            |\n");
+    printf("+------------------------------------------------+\n");
+    if (etat == RECHERCHE_TROP_LONGUE) {
+        char limite[48];
+        snprintf(limite, sizeof(limite), "plus de %lld (--pire-decalage)", options->recherche_max);
+        printf("| Combinaisons: %-32s |\n", limite);
+        printf("+------------------------------------------------+\n\n");
+        decalages_liberer(&recherche);
+        return;
+    }
+    if (etat == RECHERCHE_HORIZON) {
+        printf("| Horizon: %-37s |\n", "hyperperiode trop grande");
+        printf("+------------------------------------------------+\n\n");
+        decalages_liberer(&recherche);
+        return;
+    }
     
-    while (temps < 100) { // Protection contre boucle infinie
-        printf("\n[t = %d]\n", temps);
-        
-        // Étape 1: Activer les nouvelles instances de tâches
-        if (!activer_taches(systeme, temps)) {
-            printf("\n\t >> SIMULATION ARRETEE: Echeance manquee !\n");
-            return false;
-        }
-        
-        // Étape 2: Sélectionner la tâche selon l'algorithme (tous utilisent les priorités)
-        int tache_courante = trouver_tache_priorite_max(systeme);
-        
-        if (tache_courante != -1) {
-            Tache *tache = &systeme->taches[tache_courante];
-            tache->temps_restant--;
-            
-            printf("Execution tache %d (priorite=%d, temps restant=%d)", 
-                   tache->id, tache->priorite, tache->temps_restant);
-            
-            if (tache->temps_restant == 0) {
-                printf(" [TERMINEE]");
-            }
-            printf("\n");
+    printf("| Combinaisons: %-10lld pas: %-16lld |\n", recherche.combinaisons, recherche.pas);
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        if (recherche.reponse_max[i] < 0) {
+            printf("| Tache %-2d: aucune instance terminee             |\n", systeme->taches[i].id);
         } else {
-            printf("Processeur inactif\n");
+            printf("| Tache %-2d: Rmax=%-6lld D=%-6lld -> %-11s  |\n", systeme->taches[i].id,
+                   recherche.reponse_max[i], systeme->parametres[i].echeance,
+                   recherche.reponse_max[i] <= systeme->parametres[i].echeance ? "respectee" : "MANQUEE");
         }
-        
-        // Étape 3: Vérifier si toutes les tâches sont terminées simultanément
-        if (toutes_taches_terminees_simultanement(systeme)) {
-            printf("\n\t >> SUCCES: Toutes les taches sont terminees simultanement!\n");
-            return true;
+    }
+    printf("+------------------------------------------------+\n");
+    char verdict[48];
+    if (recherche.echecs == 0) {
+        snprintf(verdict, sizeof(verdict), "FAISABLE pour tous les decalages");
+    } else {
+        snprintf(verdict, sizeof(verdict), "NON FAISABLE (%lld combinaisons)", recherche.echecs);
+    }
+    printf("| Verdict: %-37s |\n", verdict);
+    printf("+------------------------------------------------+\n");
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        if (recherche.reponse_max[i] >= 0) {
+            printf(">> Pire cas de la tache %d: decalages ", systeme->taches[i].id);
+            ecrire_combinaison(&recherche, recherche.combinaison_max[i], stdout);
+            printf("\n");
         }
-        
-        temps++;
     }
-    
-    printf("       >> TIMEOUT: Simulation arretee apres 100 unites\n");
-    return false;
+    if (recherche.premier_echec >= 0) {
+        printf(">> Premiere combinaison en echec: decalages ");
+        ecrire_combinaison(&recherche, recherche.premier_echec, stdout);
+        printf("\n");
+    }
+    printf("\n");
+    decalages_liberer(&recherche);
 }
 
 // Fonction pour saisir les paramètres des tâches
-void saisir_taches(Systeme *systeme) {
+// Lit un entier au clavier ; un mot non numérique est consommé et rejeté
+static bool lire_entier(int *valeur) {
+    int lus = scanf("%d", valeur);
+    if (lus == 0) {
+        scanf("%*s");
+    }
+    return lus == 1;
+}
+
+// Saisie des tâches au clavier : chaque tâche est validée comme une ligne de
+// lot (C, D, T strictement positifs et bornés) avec en plus C <= D, et
+// redemandée en cas d'erreur ; false en fin d'entrée
+bool saisir_taches(Systeme *systeme) {
+    int nb_taches;
+    
     printf("\n+------------------------------------------------+\n");
     printf("|              SAISIE DES TACHES                 |\n");
     printf("+------------------------------------------------+\n");
     
     printf("Combien de taches voulez-vous saisir ? ");
-    scanf("%d", &systeme->nb_taches);
+    while (!lire_entier(&nb_taches) || nb_taches <= 0) {
+        if (feof(stdin)) {
+            return false;
+        }
+        printf(">> Nombre de taches invalide, recommencez : ");
+    }
     
-    systeme->taches = malloc(systeme->nb_taches * sizeof(Tache));
+    ParametresTache *parametres = malloc(nb_taches * sizeof(ParametresTache));
+    systeme->taches = malloc(nb_taches * sizeof(Tache));
     
-    for (int i = 0; i < systeme->nb_taches; i++) {
-        int c, d, t, p = 0;
-        
+    for (int i = 0; i < nb_taches; i++) {
         printf("\n--- Tache %d ---\n", i + 1);
-        printf("Duree d'execution (C) : ");
-        scanf("%d", &c);
-        printf("Echeance relative (D) : ");
-        scanf("%d", &d);
-        printf("Periode (T) : ");
-        scanf("%d", &t);
-        
-        // Pour HPF, demander la priorité
-        if (systeme->algorithme == HPF) {
-            printf("Priorite (P) [plus grand = plus prioritaire] : ");
-            scanf("%d", &p);
+        for (;;) {
+            temps_t c = 0, d = 0, t = 0;
+            int p = 0;
+            
+            // Les durées acceptent une unité accolée ("250us", "2ms")
+            printf("Duree d'execution (C) : ");
+            bool lue = lire_temps_fichier(stdin, &c);
+            printf("Echeance relative (D) : ");
+            lue = lire_temps_fichier(stdin, &d) && lue;
+            printf("Periode (T) : ");
+            lue = lire_temps_fichier(stdin, &t) && lue;
+            
+            // Pour HPF, demander la priorité
+            if (systeme->algorithme == HPF) {
+                printf("Priorite (P) [plus grand = plus prioritaire] : ");
+                lue = lire_entier(&p) && lue;
+            }
+            if (feof(stdin)) {
+                free(parametres);
+                free(systeme->taches);
+                systeme->taches = NULL;
+                return false;
+            }
+            
+            parametres[i] = (ParametresTache){ c, d, t, p, 0 };
+            if (lue && c <= d && lot_parametres_valides(&parametres[i], 1)) {
+                break;
+            }
+            printf(">> Tache invalide (entiers strictement positifs, au plus %lld, et C <= D) : recommencez\n",
+                   TEMPS_PARAMETRE_MAX);
         }
-        
-        initialiser_tache(&systeme->taches[i], i + 1, c, d, t, p);
     }
     
-    // Calculer les priorités pour RM et DM
+    // Les priorités RM, DM et OPA sont calculées à la configuration
+    configurer_systeme(systeme, parametres, nb_taches);
     if (systeme->algorithme == RM) {
-        calculer_priorites_rm(systeme);
         printf("\n>> Priorites calculees selon Rate Monotonic (periode plus courte = priorite plus haute)\n");
     } else if (systeme->algorithme == DM) {
-        calculer_priorites_dm(systeme);
         printf("\n>> Priorites calculees selon Deadline Monotonic (echeance plus courte = priorite plus haute)\n");
+    } else if (systeme->algorithme == OPA) {
+        printf("\n>> Priorites calculees par l'algorithme d'Audsley (ordre faisable s'il en existe un)\n");
     }
+    return true;
 }
 
 // Fonction pour choisir l'algorithme d'ordonnancement
@@ -240,8 +271,10 @@ TypeOrdonnanceur choisir_algorithme() {
     printf("| 1. HPF - Highest Priority First                |\n");
     printf("| 2. RM  - Rate Monotonic                        |\n");
     printf("| 3. DM  - Deadline Monotonic                    |\n");
+    printf("| 4. FIFO - First In First Out (non preemptif)   |\n");
+    printf("| 5. OPA - Affectation optimale (Audsley)        |\n");
     printf("+------------------------------------------------+\n");
-    printf("Votre choix (1-3) : ");
+    printf("Votre choix (1-5) : ");
     
     scanf("%d", &choix);
     
@@ -249,6 +282,8 @@ TypeOrdonnanceur choisir_algorithme() {
         case 1: return HPF;
         case 2: return RM;
         case 3: return DM;
+        case 4: return FIFO;
+        case 5: return OPA;
         default: 
             printf("Choix invalide, utilisation de HPF par defaut.\n");
             return HPF;
@@ -257,26 +292,39 @@ TypeOrdonnanceur choisir_algorithme() {
 
 // Fonction pour utiliser les données de l'exercice 1
 void utiliser_donnees_exercice1(Systeme *systeme) {
-    systeme->nb_taches = 3;
+    ParametresTache *parametres = malloc(3 * sizeof(ParametresTache));
     systeme->taches = malloc(3 * sizeof(Tache));
     
     // Données de l'exercice
-    initialiser_tache(&systeme->taches[0], 1, 2, 7, 7, 20);   // Thread 1
-    initialiser_tache(&systeme->taches[1], 2, 3, 11, 11, 15); // Thread 2  
-    initialiser_tache(&systeme->taches[2], 3, 5, 13, 13, 10); // Thread 3
+    parametres[0] = (ParametresTache){ 2, 7, 7, 20, 0 };    // Thread 1
+    parametres[1] = (ParametresTache){ 3, 11, 11, 15, 0 };  // Thread 2
+    parametres[2] = (ParametresTache){ 5, 13, 13, 10, 0 };  // Thread 3
     
     // Recalculer les priorités selon l'algorithme choisi
-    if (systeme->algorithme == RM) {
-        calculer_priorites_rm(systeme);
-    } else if (systeme->algorithme == DM) {
-        calculer_priorites_dm(systeme);
-    }
+    configurer_systeme(systeme, parametres, 3);
 }
 
-int main() {
+// Fonction pour le mode interactif
+// La simulation enregistre ses événements dans une trace binaire (en mémoire,
+// ou dans chemin_trace si fourni) qui est mise en forme une fois terminée.
+// Si chemin_metriques est fourni, les métriques de chaque instance y sont
+// agrégées par tâche (histogrammes des temps de réponse et de démarrage).
+// politique_echec (NULL : défaut) fixe le sort des instances en retard.
+// Si execution est fourni, le plan simulé est ensuite exécuté réellement.
+// Si ressources est fourni, les tâches partagent ces ressources selon son protocole.
+// Si preemption est fourni, il limite la préemption et fixe le coût des commutations
+// (les seuils de préemption sont alors calculés pour minimiser les préemptions).
+// Si decalages est fourni, il décale la première activation des tâches et/ou
+// demande la recherche du pire décalage après la simulation.
+int main_interactif(const char *chemin_trace, NiveauTrace niveau, const char *chemin_metriques,
+                    const PolitiqueEchec *politique_echec, const OptionsExecution *execution,
+                    JeuRessources *ressources, const OptionsPreemption *preemption,
+                    const OptionsDecalages *decalages) {
     printf("=== ORDONNANCEUR TEMPS REEL ===\n");
     
-    Systeme systeme;
+    Systeme systeme = { 0 };
+    Trace trace;
+    Metriques metriques;
     int mode;
     
     // Choix du mode
@@ -289,16 +337,40 @@ int main() {
     printf("Votre choix (1-2) : ");
     scanf("%d", &mode);
     
-    // Choix de l'algorithme
+    // Choix de l'algorithme (la simulation s'arrête dès que le verdict est connu,
+    // sauf si des métriques ou une politique d'échec sont demandées : tout
+    // l'horizon est alors simulé)
     systeme.algorithme = choisir_algorithme();
+    systeme.verdict_seul = chemin_metriques == NULL && politique_echec == NULL;
+    systeme.politique_echec = politique_echec != NULL ? *politique_echec : ECHEC_CONTINUER;
+    systeme.ressources = ressources;
+    if (preemption != NULL && systeme.algorithme != FIFO) {
+        systeme.preemption = preemption->mode;
+        systeme.points = preemption->points;
+    }
+    systeme.commutation = preemption != NULL ? preemption->commutation : 0;
     
     // Configuration des tâches
     if (mode == 1) {
         utiliser_donnees_exercice1(&systeme);
         printf("\n>> Utilisation des donnees de l'exercice 1\n");
-    } else {
-        saisir_taches(&systeme);
+    } else if (!saisir_taches(&systeme)) {
+        fprintf(stderr, "Saisie interrompue\n");
+        return 1;
+    }
+    if (decalages != NULL && decalages->decalages != NULL &&
+        (decalages->nb_decalages != systeme.nb_taches || !appliquer_decalages(&systeme, decalages->decalages))) {
+        fprintf(stderr, "Decalages: %d valeur(s) pour %d tache(s)\n", decalages->nb_decalages, systeme.nb_taches);
+        free(systeme.taches);
+        free(systeme.parametres);
+        return 1;
+    }
+    if (ressources != NULL && !ressources_preparer(ressources, systeme.parametres, systeme.nb_taches, false)) {
+        free(systeme.taches);
+        free(systeme.parametres);
+        return 1;
     }
+    bool seuils_faisables = systeme.preemption == PREEMPTION_SEUILS && attribuer_seuils(&systeme);
     
     // Affichage de la configuration
     printf("\n+------------------------------------------------+\n");
@@ -307,16 +379,64 @@ int main() {
     printf("| Algorithme: %-35s |\n", nom_algorithme(systeme.algorithme));
     printf("+------------------------------------------------+\n");
     
-    for (int i = 0; i < systeme.nb_taches; i++) {
-        printf("| Tache %-2d: C=%-2d, D=%-2d, T=%-2d, P=%-2d               |\n", 
-               systeme.taches[i].id, systeme.taches[i].duree_execution, 
-               systeme.taches[i].echeance, systeme.taches[i].periode, 
+    for (int i = 0; i < systeme.nb_taches && !systeme.asynchrone; i++) {
+        printf("| Tache %-2d: C=%-2lld, D=%-2lld, T=%-2lld, P=%-2d               |\n", 
+               systeme.taches[i].id, systeme.parametres[i].duree_execution, 
+               systeme.parametres[i].echeance, systeme.parametres[i].periode, 
                systeme.taches[i].priorite);
     }
+    for (int i = 0; i < systeme.nb_taches && systeme.asynchrone; i++) {
+        printf("| Tache %-2d: C=%-2lld, D=%-2lld, T=%-2lld, P=%-2d, O=%-2lld         |\n", 
+               systeme.taches[i].id, systeme.parametres[i].duree_execution, 
+               systeme.parametres[i].echeance, systeme.parametres[i].periode, 
+               systeme.taches[i].priorite, systeme.parametres[i].decalage);
+    }
+    printf("+------------------------------------------------+\n");
+    if (systeme.horizon >= 0) {
+        printf("| Horizon de simulation: %-23lld |\n", systeme.horizon);
+    } else {
+        printf("| Horizon de simulation: %-23s |\n", "non calculable");
+    }
+    if (politique_echec != NULL) {
+        printf("| Echeance manquee: %-28s |\n", nom_politique_echec(systeme.politique_echec));
+    }
+    if (ressources != NULL) {
+        afficher_ressources(ressources);
+    }
+    if (preemption != NULL) {
+        afficher_preemption(&systeme, seuils_faisables);
+    }
     printf("+------------------------------------------------+\n\n");
-
+    
     // Lancement de la simulation
-    bool resultat = simuler_ordonnancement(&systeme);
+    bool trace_creee = chemin_trace != NULL ?
+        trace_creer_fichier(&trace, niveau, TAILLE_TRACE, chemin_trace, systeme.parametres, systeme.nb_taches) :
+        trace_creer_anneau(&trace, niveau, TAILLE_TRACE);
+    systeme.trace = trace_creee ? &trace : NULL;
+    bool metriques_creees = chemin_metriques != NULL && metriques_creer(&metriques, systeme.nb_taches);
+    systeme.metriques = metriques_creees ? &metriques : NULL;
+    
+    printf("+------------------------------------------------+\n");
+    printf("|         SIMULATION %-13s               |\n", 
+           systeme.algorithme == HPF ? "HPF PREEMPTIF" :
+           systeme.algorithme == RM ? "RM PREEMPTIF" :
+           systeme.algorithme == DM ? "DM PREEMPTIF" :
+           systeme.algorithme == OPA ? "OPA PREEMPTIF" : "FIFO");
+    printf("+------------------------------------------------+\n");
+    
+    bool resultat = simuler_ordonnancement(&systeme, 0);
+    char nom_resultat[16];
+    snprintf(nom_resultat, sizeof(nom_resultat), "%s.", nom_court_algorithme(systeme.algorithme));
+    
+    if (trace_creee) {
+        afficher_trace(&trace, chemin_trace, systeme.parametres, systeme.nb_taches);
+    }
+    if (metriques_creees) {
+        if (metriques_enregistrer(&metriques, systeme.parametres, chemin_metriques)) {
+            printf("\n>> Metriques par tache enregistrees dans %s\n", chemin_metriques);
+        }
+        metriques_liberer(&metriques);
+    }
     
     // Affichage du résultat
     printf("\n\n+------------------------------------------------+\n");
@@ -324,21 +444,72 @@ int main() {
     printf("+------------------------------------------------+\n");
     if (resultat) {
         printf("| Status: FAISABLE                               |\n");
-        printf("| Toutes les taches peuvent etre terminees       |\n");
-        printf("| simultanement avec l'ordonnanceur %-12s |\n", 
-               systeme.algorithme == HPF ? "HPF." :
-               systeme.algorithme == RM ? "RM." : "DM.");
+        printf("| Aucune echeance manquee sur l'horizon de       |\n");
+        printf("| simulation avec l'ordonnanceur %-15s |\n", nom_resultat);
+    } else if (systeme.non_conclu) {
+        printf("| Status: NON CONCLUANT                          |\n");
+        printf("| Hyperperiode trop grande : horizon non         |\n");
+        printf("| calculable, aucune simulation effectuee        |\n");
     } else {
         printf("| Status: NON FAISABLE                           |\n");
-        printf("| Impossible de terminer toutes les taches       |\n");
-        printf("| simultanement avec l'ordonnanceur %-12s |\n",
-               systeme.algorithme == HPF ? "HPF." :
-               systeme.algorithme == RM ? "RM." : "DM.");
+        printf("| Echeance manquee sur l'horizon de simulation   |\n");
+        printf("| avec l'ordonnanceur %-26s |\n", nom_resultat);
     }
     printf("+------------------------------------------------+\n\n");
     
+    // Vérification croisée avec l'analyse analytique des temps de réponse
+    // (valable pour les priorités fixes préemptives uniquement)
+    if (systeme.algorithme != FIFO) {
+        afficher_analyse_temps_reponse(&systeme, resultat);
+    }
+    
+    // Recherche du pire décalage d'activation (toutes les combinaisons distinctes)
+    if (decalages != NULL && decalages->recherche_max > 0) {
+        afficher_pire_decalage(&systeme, decalages);
+    }
+    
+    // Exécution réelle du plan simulé (table de répartition d'une hyperpériode)
+    if (execution != NULL) {
+        executer_plan(&systeme, execution);
+    }
+    
     // Libération de la mémoire
     free(systeme.taches);
+    free(systeme.parametres);
+    liberer_files(&systeme);
     
     return 0;
-}
\ No newline at end of file
+}
+
+// Fonction pour le test analytique du mode lot : analyse des temps de réponse
+// (priorités calculées à la configuration)
+static bool tester_temps_reponse(const Systeme *systeme, long long *intervalle_violation) {
+    *intervalle_violation = 0;
+    return analyser_temps_reponse(systeme->parametres, systeme->nb_taches, NULL);
+}
+
+// Politiques évaluées en mode lot (FIFO, non préemptif, n'a pas de RTA)
+static const PolitiqueLot POLITIQUES[] = {
+    { "hpf", HPF, true, true },
+    { "rm", RM, true, true },
+    { "dm", DM, true, true },
+    { "opa", OPA, false, true },
+    { "fifo", FIFO, false, false }
+};
+
+static const ProgrammeLigneCommande PROGRAMME = {
+    .politiques = POLITIQUES,
+    .nb_politiques = sizeof(POLITIQUES) / sizeof(POLITIQUES[0]),
+    .analyse = "rta",
+    .tester = tester_temps_reponse,
+    .avec_conversion = true,
+    .aide_echec = "(defaut: continuer, arret au premier echec sans --metriques)",
+    .aide_protocole = "aucun|pip|pcp|srp\n"
+                      "                         acces aux ressources : verrous simples, heritage de priorite,\n"
+                      "                         priorite plafond ou Stack Resource Policy (defaut: aucun)",
+    .interactif = main_interactif
+};
+
+int main(int argc, char **argv) {
+    return main_ligne_commande(&PROGRAMME, argc, argv);
+}
@@ -0,0 +1,124 @@
+#include <math.h>
+#include "generateur-taches.h"
+
+// Fonction pour une étape de splitmix64 (dérivation de l'état initial)
+static uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Fonction pour une rotation à gauche sur 64 bits
+static inline uint64_t rotation(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// Fonction pour initialiser le générateur à partir d'une graine
+void alea_initialiser(GenerateurAleatoire *alea, uint64_t graine) {
+    for (int i = 0; i < 4; i++) {
+        alea->etat[i] = splitmix64(&graine);
+    }
+}
+
+// Fonction pour tirer 64 bits pseudo-aléatoires (xoshiro256**)
+uint64_t alea_suivant(GenerateurAleatoire *alea) {
+    uint64_t *s = alea->etat;
+    uint64_t resultat = rotation(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotation(s[3], 45);
+    return resultat;
+}
+
+// Fonction pour tirer un réel uniforme dans [0, 1)
+double alea_uniforme(GenerateurAleatoire *alea) {
+    return (alea_suivant(alea) >> 11) * 0x1.0p-53;
+}
+
+// Fonction pour répartir une utilisation totale entre n tâches (UUniFast, Bini & Buttazzo)
+// Les utilisations obtenues sont uniformément distribuées sur le simplexe Σ ui = U
+void uunifast(GenerateurAleatoire *alea, int nb_taches, double utilisation, double *utilisations) {
+    double reste = utilisation;
+    
+    for (int i = 0; i < nb_taches - 1; i++) {
+        double suivant = reste * pow(alea_uniforme(alea), 1.0 / (nb_taches - 1 - i));
+        utilisations[i] = reste - suivant;
+        reste = suivant;
+    }
+    if (nb_taches > 0) {
+        utilisations[nb_taches - 1] = reste;
+    }
+}
+
+// Fonction pour UUniFast-discard : rejeter les tirages où une tâche dépasse ui = 1
+// (nécessaire dès que U > 1, par exemple pour plusieurs processeurs)
+bool uunifast_rejet(GenerateurAleatoire *alea, int nb_taches, double utilisation, 
+                    double *utilisations, int essais_max) {
+    for (int essai = 0; essai < essais_max; essai++) {
+        bool valide = true;
+        
+        uunifast(alea, nb_taches, utilisation, utilisations);
+        for (int i = 0; i < nb_taches && valide; i++) {
+            valide = utilisations[i] <= 1.0;
+        }
+        if (valide) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Fonction pour générer un jeu de tâches (utilisations dans le tableau fourni,
+// de taille nb_taches). Les priorités HPF sont une permutation aléatoire de 1..n.
+// Renvoie faux si UUniFast-discard n'a pas trouvé de tirage valide.
+bool generer_jeu(GenerateurAleatoire *alea, const ParametresGeneration *generation, 
+                 ParametresTache *taches, double *utilisations) {
+    int n = generation->nb_taches;
+    
+    if (!uunifast_rejet(alea, n, generation->utilisation, utilisations, 1000)) {
+        return false;
+    }
+    
+    double log_min = log((double)generation->periode_min);
+    double log_max = log((double)generation->periode_max + 1.0);
+    
+    for (int i = 0; i < n; i++) {
+        // Période log-uniforme : autant de tâches par décade de périodes
+        temps_t periode = (temps_t)floor(exp(log_min + alea_uniforme(alea) * (log_max - log_min)));
+        if (periode < generation->periode_min) {
+            periode = generation->periode_min;
+        } else if (periode > generation->periode_max) {
+            periode = generation->periode_max;
+        }
+        
+        temps_t duree = llround(utilisations[i] * periode);
+        if (duree < 1) {
+            duree = 1;
+        }
+        
+        double ratio = generation->ratio_echeance_min + 
+                       alea_uniforme(alea) * (generation->ratio_echeance_max - generation->ratio_echeance_min);
+        temps_t echeance = llround(ratio * periode);
+        if (echeance < duree) {
+            echeance = duree;
+        }
+        
+        taches[i] = (ParametresTache){ duree, echeance, periode, i + 1, 0 };
+    }
+    
+    // Priorités HPF arbitraires : mélange de Fisher-Yates
+    for (int i = n - 1; i > 0; i--) {
+        int j = (int)(alea_suivant(alea) % (uint64_t)(i + 1));
+        int priorite = taches[i].priorite;
+        taches[i].priorite = taches[j].priorite;
+        taches[j].priorite = priorite;
+    }
+    
+    return true;
+}
@@ -0,0 +1,33 @@
+#ifndef GENERATEUR_TACHES_H
+#define GENERATEUR_TACHES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tache.h"
+
+// Générateur pseudo-aléatoire reproductible (xoshiro256**, graine via splitmix64)
+typedef struct {
+    uint64_t etat[4];
+} GenerateurAleatoire;
+
+// Paramètres de génération d'un jeu de tâches périodiques
+typedef struct {
+    int nb_taches;            // Nombre de tâches du jeu
+    double utilisation;       // Utilisation totale visée (Σ Ci/Ti)
+    temps_t periode_min;      // Périodes tirées selon une loi log-uniforme
+    temps_t periode_max;      //   dans [periode_min, periode_max] (au plus TEMPS_PARAMETRE_MAX)
+    double ratio_echeance_min; // Échéances tirées avec D/T uniforme
+    double ratio_echeance_max; //   dans [ratio_min, ratio_max] (D >= C)
+} ParametresGeneration;
+
+void alea_initialiser(GenerateurAleatoire *alea, uint64_t graine);
+uint64_t alea_suivant(GenerateurAleatoire *alea);
+double alea_uniforme(GenerateurAleatoire *alea);
+
+void uunifast(GenerateurAleatoire *alea, int nb_taches, double utilisation, double *utilisations);
+bool uunifast_rejet(GenerateurAleatoire *alea, int nb_taches, double utilisation, 
+                    double *utilisations, int essais_max);
+bool generer_jeu(GenerateurAleatoire *alea, const ParametresGeneration *generation, 
+                 ParametresTache *taches, double *utilisations);
+
+#endif
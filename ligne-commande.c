@@ -0,0 +1,617 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "lot-taches.h"
+#include "pool-travail.h"
+#include "ligne-commande.h"
+
+// Nombre de jeux lus d'un coup et répartis entre les ouvriers
+#define JEUX_PAR_BLOC 4096
+
+// Résultat de l'évaluation d'un couple (jeu, politique)
+typedef struct {
+    unsigned char analyse;
+    unsigned char simulation;
+    long long intervalle_violation;
+} ResultatLot;
+
+// Tampons propres à un ouvrier : aucun état modifiable n'est partagé
+typedef struct {
+    Systeme systeme;
+    ParametresTache *parametres; // Copie du jeu courant (priorités RM/DM/OPA)
+    int capacite;
+} ContexteOuvrier;
+
+// Description du travail d'un bloc, partagée en lecture seule par les ouvriers
+typedef struct {
+    const ProgrammeLigneCommande *programme;
+    const BlocLot *bloc;
+    const PolitiqueLot *politiques[NB_ORDONNANCEURS];
+    int nb_politiques;
+    bool avec_analyse;
+    bool avec_simulation;
+    temps_t duree_simulation;
+    ContexteOuvrier *ouvriers;
+    ResultatLot *resultats;   // Un résultat par couple, dans l'ordre du fichier
+} TravailLot;
+
+// Options lues sur la ligne de commande
+typedef struct {
+    const char *chemin;
+    const char *chemin_sortie;
+    const char *chemin_binaire;
+    bool politiques[NB_ORDONNANCEURS]; // Politiques évaluées, par indice dans le programme
+    bool avec_analyse;
+    bool avec_simulation;
+    temps_t duree_simulation;
+    int nb_threads;
+    const char *chemin_trace;
+    const char *chemin_metriques;
+    PolitiqueEchec politique_echec;
+    bool avec_politique;
+    OptionsExecution execution;
+    bool avec_execution;
+    NiveauTrace niveau_trace;
+    const char *chemin_ressources;
+    ProtocoleRessources protocole;
+    bool avec_protocole;
+    OptionsPreemption preemption;
+    bool avec_preemption;
+    OptionsDecalages decalages;
+    bool avec_decalages;
+} OptionsLigneCommande;
+
+// Fonction pour obtenir le texte d'un verdict (sorties CSV)
+const char* nom_verdict(Verdict verdict) {
+    switch (verdict) {
+        case FAISABLE:     return "faisable";
+        case NON_FAISABLE: return "non_faisable";
+        case NON_CONCLU:   return "non_conclu";
+        case INVALIDE:     return "invalide";
+        default:           return "-";
+    }
+}
+
+// Fonction exécutée par les ouvriers : évaluer les couples [debut, fin) d'un bloc
+// Le couple k correspond au jeu k / nb_politiques et à la politique k % nb_politiques
+static void evaluer_couples(void *contexte, int ouvrier, long debut, long fin) {
+    TravailLot *travail = contexte;
+    ContexteOuvrier *tampons = &travail->ouvriers[ouvrier];
+    Systeme *systeme = &tampons->systeme;
+    
+    for (long k = debut; k < fin; k++) {
+        long jeu = k / travail->nb_politiques;
+        const PolitiqueLot *politique = travail->politiques[k % travail->nb_politiques];
+        const ParametresTache *parametres = travail->bloc->parametres + travail->bloc->debut[jeu];
+        int n = (int)(travail->bloc->debut[jeu + 1] - travail->bloc->debut[jeu]);
+        ResultatLot *resultat = &travail->resultats[k];
+        
+        resultat->analyse = NON_DEMANDE;
+        resultat->simulation = NON_DEMANDE;
+        resultat->intervalle_violation = 0;
+        if (!lot_parametres_valides(parametres, n)) {
+            resultat->analyse = INVALIDE;
+            resultat->simulation = INVALIDE;
+            continue;
+        }
+        
+        // Les tampons ne sont réalloués que lorsqu'un jeu plus grand arrive
+        if (n > tampons->capacite) {
+            Tache *taches = realloc(systeme->taches, n * sizeof(Tache));
+            ParametresTache *copie = realloc(tampons->parametres, n * sizeof(ParametresTache));
+            if (taches != NULL) {
+                systeme->taches = taches;
+            }
+            if (copie != NULL) {
+                tampons->parametres = copie;
+            }
+            if (taches == NULL || copie == NULL) {
+                resultat->analyse = INVALIDE;
+                resultat->simulation = INVALIDE;
+                continue;
+            }
+            tampons->capacite = n;
+        }
+        
+        // Le bloc est partagé : les priorités sont calculées sur une copie
+        memcpy(tampons->parametres, parametres, n * sizeof(ParametresTache));
+        systeme->algorithme = politique->algorithme;
+        systeme->verdict_seul = true;
+        configurer_systeme(systeme, tampons->parametres, n);
+        
+        // Avec des décalages, l'instant critique synchrone n'est qu'un majorant :
+        // le test analytique est suffisant, son échec ne conclut pas
+        if (travail->avec_analyse && politique->analysable) {
+            bool faisable = travail->programme->tester(systeme, &resultat->intervalle_violation);
+            resultat->analyse = faisable ? FAISABLE : systeme->asynchrone ? NON_CONCLU : NON_FAISABLE;
+            if (resultat->analyse == NON_CONCLU) {
+                resultat->intervalle_violation = 0;
+            }
+        }
+        if (travail->avec_simulation) {
+            bool faisable = simuler_ordonnancement(systeme, travail->duree_simulation);
+            resultat->simulation = faisable ? FAISABLE : systeme->non_conclu ? NON_CONCLU : NON_FAISABLE;
+        }
+    }
+}
+
+// Fonction pour écrire l'en-tête CSV du mode lot
+static void ecrire_entete(const ProgrammeLigneCommande *programme, FILE *sortie) {
+    fprintf(sortie, "jeu,taches,%s%s,%ssimulation\n", programme->nb_politiques > 1 ? "algorithme," : "",
+            programme->analyse, programme->avec_intervalle ? "intervalle_violation," : "");
+}
+
+// Fonction pour écrire la ligne CSV d'un couple (jeu, politique)
+static void ecrire_resultat(const TravailLot *travail, long numero, int nb_taches, const PolitiqueLot *politique,
+                            const ResultatLot *resultat, FILE *sortie) {
+    fprintf(sortie, "%ld,%d,", numero, nb_taches);
+    if (travail->programme->nb_politiques > 1) {
+        fprintf(sortie, "%s,", nom_court_algorithme(politique->algorithme));
+    }
+    fprintf(sortie, "%s,", nom_verdict(resultat->analyse));
+    if (travail->programme->avec_intervalle && resultat->intervalle_violation > 0) {
+        fprintf(sortie, "%lld,", resultat->intervalle_violation);
+    } else if (travail->programme->avec_intervalle) {
+        fprintf(sortie, "-,");
+    }
+    fprintf(sortie, "%s\n", nom_verdict(resultat->simulation));
+}
+
+// Fonction pour évaluer sans interaction tous les jeux d'un fichier de lot
+// Les couples (jeu, politique) d'un bloc sont répartis sur le pool pendant que
+// le bloc suivant est lu ; une ligne CSV est écrite par couple, dans l'ordre du
+// fichier, quel que soit le nombre de threads.
+static int executer_lot(const ProgrammeLigneCommande *programme, const OptionsLigneCommande *options,
+                        FILE *sortie) {
+    LecteurLot lecteur;
+    BlocLot blocs[2] = { { 0 }, { 0 } };
+    ResultatLot *resultats[2] = { NULL, NULL };
+    TravailLot travail = { 0 };
+    int code = 0;
+    
+    travail.programme = programme;
+    for (int p = 0; p < programme->nb_politiques; p++) {
+        if (options->politiques[p]) {
+            travail.politiques[travail.nb_politiques++] = &programme->politiques[p];
+        }
+    }
+    travail.avec_analyse = options->avec_analyse;
+    travail.avec_simulation = options->avec_simulation;
+    travail.duree_simulation = options->duree_simulation;
+    
+    if (!lot_ouvrir(&lecteur, options->chemin)) {
+        return 1;
+    }
+    PoolTravail *pool = pool_creer(options->nb_threads);
+    resultats[0] = malloc(JEUX_PAR_BLOC * NB_ORDONNANCEURS * sizeof(ResultatLot));
+    resultats[1] = malloc(JEUX_PAR_BLOC * NB_ORDONNANCEURS * sizeof(ResultatLot));
+    travail.ouvriers = pool != NULL ? calloc(pool_nb_ouvriers(pool), sizeof(ContexteOuvrier)) : NULL;
+    if (pool == NULL || resultats[0] == NULL || resultats[1] == NULL || travail.ouvriers == NULL) {
+        fprintf(stderr, "Lot: impossible de demarrer les threads\n");
+        code = 1;
+    }
+    
+    ecrire_entete(programme, sortie);
+    int courant = 0;
+    int nb_jeux = code == 0 ? lot_lire_bloc(&lecteur, &blocs[courant], JEUX_PAR_BLOC) : 0;
+    
+    while (nb_jeux > 0) {
+        BlocLot *bloc = &blocs[courant];
+        ResultatLot *resultats_bloc = resultats[courant];
+        
+        travail.bloc = bloc;
+        travail.resultats = resultats_bloc;
+        pool_lancer(pool, (long)nb_jeux * travail.nb_politiques, 64, evaluer_couples, &travail);
+        
+        // Lecture du bloc suivant pendant l'évaluation du bloc courant
+        int suivant = lot_lire_bloc(&lecteur, &blocs[1 - courant], JEUX_PAR_BLOC);
+        pool_attendre(pool);
+        
+        for (int j = 0; j < nb_jeux; j++) {
+            int n = (int)(bloc->debut[j + 1] - bloc->debut[j]);
+            for (int p = 0; p < travail.nb_politiques; p++) {
+                ecrire_resultat(&travail, bloc->premier_numero + j, n, travail.politiques[p],
+                                &resultats_bloc[j * travail.nb_politiques + p], sortie);
+            }
+        }
+        
+        courant = 1 - courant;
+        nb_jeux = suivant;
+    }
+    if (lecteur.erreur) {
+        code = 1;
+    }
+    
+    if (travail.ouvriers != NULL) {
+        for (int i = 0; i < pool_nb_ouvriers(pool); i++) {
+            free(travail.ouvriers[i].systeme.taches);
+            free(travail.ouvriers[i].parametres);
+            liberer_files(&travail.ouvriers[i].systeme);
+        }
+        free(travail.ouvriers);
+    }
+    pool_detruire(pool);
+    free(resultats[0]);
+    free(resultats[1]);
+    lot_liberer_bloc(&blocs[0]);
+    lot_liberer_bloc(&blocs[1]);
+    lot_fermer(&lecteur);
+    return code;
+}
+
+// Fonction pour convertir un fichier de lot au format binaire compact
+static int convertir_lot(const char *chemin, const char *destination) {
+    LecteurLot lecteur;
+    int lu;
+    
+    if (!lot_ouvrir(&lecteur, chemin)) {
+        return 1;
+    }
+    FILE *fichier = fopen(destination, "wb");
+    if (fichier == NULL) {
+        perror(destination);
+        lot_fermer(&lecteur);
+        return 1;
+    }
+    
+    bool ecrit = lot_ecrire_entete_binaire(fichier);
+    while (ecrit && (lu = lot_lire_jeu(&lecteur)) == 1) {
+        ecrit = lot_ecrire_jeu_binaire(fichier, lecteur.parametres, lecteur.nb_taches);
+    }
+    
+    if (fclose(fichier) != 0 || !ecrit) {
+        fprintf(stderr, "%s: erreur d'ecriture (ou valeur hors du format binaire int32)\n", destination);
+        lu = -1;
+    }
+    lot_fermer(&lecteur);
+    return lu < 0 ? 1 : 0;
+}
+
+// Fonction pour afficher la trace d'une simulation puis la fermer
+// Une trace écrite dans un fichier est relue pour être affichée.
+void afficher_trace(Trace *trace, const char *chemin_trace, const ParametresTache *parametres, int nb_taches) {
+    if (chemin_trace == NULL) {
+        trace_exporter_texte(trace, parametres, nb_taches, stdout);
+        trace_fermer(trace);
+        return;
+    }
+    
+    if (!trace_fermer(trace)) {
+        fprintf(stderr, "%s: erreur d'ecriture de la trace\n", chemin_trace);
+        return;
+    }
+    ParametresTache *relus;
+    int n;
+    if (trace_charger(trace, chemin_trace, &relus, &n)) {
+        trace_exporter_texte(trace, relus, n, stdout);
+        printf("\n>> Trace binaire enregistree dans %s (%zu evenements)\n", chemin_trace, trace->nb);
+        trace_fermer(trace);
+        free(relus);
+    }
+}
+
+// Fonction pour préparer puis lancer la recherche du pire décalage d'un système
+// La recherche est à libérer (decalages_liberer) sauf si RECHERCHE_IMPOSSIBLE
+// est renvoyé ; chaque programme met ensuite le résultat en forme.
+EtatRecherche lancer_recherche_decalages(RechercheDecalages *recherche, const Systeme *systeme,
+                                         const OptionsDecalages *options) {
+    if (!decalages_preparer(recherche, systeme)) {
+        fprintf(stderr, "Memoire insuffisante pour la recherche du pire decalage\n");
+        return RECHERCHE_IMPOSSIBLE;
+    }
+    if (recherche->combinaisons < 0 || recherche->combinaisons > options->recherche_max) {
+        return RECHERCHE_TROP_LONGUE;
+    }
+    // Horizon de chaque combinaison : Omax + 2H, Omax < max Ti
+    if (systeme->hyperperiode == 0 || systeme->hyperperiode > (HORIZON_MAX - TEMPS_PARAMETRE_MAX) / 2) {
+        return RECHERCHE_HORIZON;
+    }
+    if (!rechercher_pire_decalage(recherche, systeme, options->nb_threads)) {
+        fprintf(stderr, "Memoire ou threads insuffisants pour la recherche du pire decalage\n");
+        decalages_liberer(recherche);
+        return RECHERCHE_IMPOSSIBLE;
+    }
+    return RECHERCHE_EFFECTUEE;
+}
+
+// Fonction pour afficher l'aide de la ligne de commande
+static void afficher_usage(const ProgrammeLigneCommande *programme, const char *nom) {
+    printf("Usage: %s                        (mode interactif)\n", nom);
+    printf("       %s [--trace FICHIER [--niveau-trace N]] [--metriques FICHIER] [--echec POLITIQUE]\n", nom);
+    printf("       %s [--executer US [--cycles N] [--coeur N]]\n", nom);
+    printf("       %s [--ressources FICHIER [--protocole PROTOCOLE]]\n", nom);
+    printf("       %s [--preemption MODE [--points DUREE]] [--commutation DUREE]\n", nom);
+    printf("       %s [--decalages LISTE] [--pire-decalage MAX [--threads N]]\n", nom);
+    printf("                                 (mode interactif, trace ou metriques enregistrees,\n");
+    printf("                                 plan execute reellement, ressources partagees,\n");
+    printf("                                 preemption limitee, activations decalees)\n");
+    printf("       %s --lot FICHIER [options]\n\n", nom);
+    printf("Options du mode lot:\n");
+    printf("  --lot FICHIER          jeux de taches a evaluer (texte ou binaire, - = entree standard)\n");
+    printf("                         texte: nombre de taches puis \"C D T [P [O]]\" par tache (O: decalage)\n");
+    if (programme->nb_politiques > 1) {
+        int nb_defaut = 0;
+        printf("  --algo ");
+        for (int p = 0; p < programme->nb_politiques; p++) {
+            printf("%s|", programme->politiques[p].nom);
+            nb_defaut += programme->politiques[p].par_defaut;
+        }
+        printf("tous\n                         algorithme(s) evalue(s) (defaut: tous = ");
+        for (int p = 0, k = 0; p < programme->nb_politiques; p++) {
+            if (programme->politiques[p].par_defaut) {
+                k++;
+                printf("%s%s", programme->politiques[p].nom, k == nb_defaut ? ")\n" :
+                       k == nb_defaut - 1 ? " et " : ", ");
+            }
+        }
+    }
+    printf("  --analyse %s|simulation|toutes\n", programme->analyse);
+    printf("                         analyse(s) effectuee(s) (defaut: toutes)\n");
+    printf("                         non_conclu : %s en defaut sur un jeu a decalages (O), ou le test\n",
+           programme->analyse);
+    printf("                         n'est que suffisant ; simulation sans horizon calculable (hyperperiode\n");
+    printf("                         trop grande, seule la premiere periode d'activite synchrone d'une\n");
+    printf("                         politique preemptive est simulee)\n");
+    if (programme->avec_duree) {
+        printf("  --duree N              duree de chaque simulation, unite facultative (defaut: 0 = horizon du jeu,\n");
+        printf("                         hyperperiode ou 2 x hyperperiode si D > T)\n");
+    }
+    printf("  --sortie FICHIER       resultats CSV (defaut: sortie standard)\n");
+    printf("  --threads N            nombre de threads (defaut: un par coeur)\n");
+    if (programme->avec_conversion) {
+        printf("  --convertir FICHIER    ecrire le lot au format binaire au lieu de l'evaluer\n");
+    }
+    printf("\nOptions du mode interactif:\n");
+    printf("  --trace FICHIER        trace binaire de la simulation (voir exporter-trace)\n");
+    printf("  --niveau-trace N       0 aucun, 1 echecs, 2 evenements, 3 complet (defaut: 3)\n");
+    printf("  --metriques FICHIER    metriques par tache : CSV, ou JSON si FICHIER finit par .json\n");
+    printf("  --echec continuer|abandonner|sauter\n");
+    printf("                         instance en retard : terminee avant les suivantes, abandonnee a son\n");
+    printf("                         echeance, ou terminee en sautant les activations pendant son retard\n");
+    printf("                         %s\n", programme->aide_echec);
+    printf("  --executer US          executer le plan simule sous Linux (un thread par tache, une unite\n");
+    printf("                         de temps = US microsecondes) : latence, gigue et echeances manquees\n");
+    printf("  --cycles N             hyperperiodes executees (defaut: 1)\n");
+    printf("  --coeur N              coeur d'execution (defaut: premier coeur autorise)\n");
+    printf("  --ressources FICHIER   sections critiques : lignes \"tache ressource debut duree\"\n");
+    printf("  --protocole %s\n", programme->aide_protocole);
+    printf("  --preemption totale|aucune|seuils|points\n");
+    printf("                         preemption des instances commencees : toujours, jamais, au-dessus de\n");
+    printf("                         seuils calcules pour minimiser les preemptions, ou a la fin des\n");
+    printf("                         troncons de --points unites d'execution (defaut: totale)\n");
+    printf("  --points DUREE         longueur des troncons non preemptibles (--preemption points)\n");
+    printf("  --commutation DUREE    cout d'une commutation de contexte, paye a chaque demarrage ou\n");
+    printf("                         reprise d'instance (defaut: 0)\n");
+    printf("  --decalages LISTE      date de premiere activation de chaque tache, separees par des\n");
+    printf("                         virgules (ex: 0,2ms,500us ; defaut: activations synchrones)\n");
+    printf("  --pire-decalage MAX    simuler toutes les combinaisons distinctes de decalages (au plus\n");
+    printf("                         MAX, 0 = %lld) et afficher le pire temps de reponse de chaque\n",
+           COMBINAISONS_MAX_DEFAUT);
+    printf("                         tache ; --threads fixe le nombre de threads de la recherche\n");
+}
+
+// Fonction pour lire l'option argv[i] de valeur valeur ; renvoie 0 si elle est
+// reconnue, 1 si elle est invalide (message affiché), -1 si elle est inconnue
+static int lire_option(const ProgrammeLigneCommande *programme, OptionsLigneCommande *options,
+                       const char *option, const char *valeur) {
+    if (strcmp(option, "--lot") == 0) {
+        options->chemin = valeur;
+    } else if (strcmp(option, "--sortie") == 0) {
+        options->chemin_sortie = valeur;
+    } else if (strcmp(option, "--convertir") == 0 && programme->avec_conversion) {
+        options->chemin_binaire = valeur;
+    } else if (strcmp(option, "--threads") == 0) {
+        options->nb_threads = atoi(valeur);
+    } else if (strcmp(option, "--trace") == 0) {
+        options->chemin_trace = valeur;
+    } else if (strcmp(option, "--metriques") == 0) {
+        options->chemin_metriques = valeur;
+    } else if (strcmp(option, "--echec") == 0) {
+        if (!lire_politique_echec(valeur, &options->politique_echec)) {
+            fprintf(stderr, "Politique d'echec inconnue: %s\n", valeur);
+            return 1;
+        }
+        options->avec_politique = true;
+    } else if (strcmp(option, "--executer") == 0) {
+        double unite_us = atof(valeur);
+        if (unite_us <= 0.0) {
+            fprintf(stderr, "Unite de temps invalide: %s\n", valeur);
+            return 1;
+        }
+        options->execution.unite_ns = (long long)(unite_us * 1000.0 + 0.5);
+        options->avec_execution = true;
+    } else if (strcmp(option, "--cycles") == 0) {
+        options->execution.cycles = atoi(valeur);
+        if (options->execution.cycles <= 0) {
+            fprintf(stderr, "Nombre d'hyperperiodes invalide: %s\n", valeur);
+            return 1;
+        }
+    } else if (strcmp(option, "--coeur") == 0) {
+        options->execution.coeur = atoi(valeur);
+    } else if (strcmp(option, "--ressources") == 0) {
+        options->chemin_ressources = valeur;
+    } else if (strcmp(option, "--protocole") == 0) {
+        if (!lire_protocole(valeur, &options->protocole)) {
+            fprintf(stderr, "Protocole inconnu: %s\n", valeur);
+            return 1;
+        }
+        options->avec_protocole = true;
+    } else if (strcmp(option, "--preemption") == 0) {
+        if (!lire_mode_preemption(valeur, &options->preemption.mode)) {
+            fprintf(stderr, "Mode de preemption inconnu: %s\n", valeur);
+            return 1;
+        }
+        options->avec_preemption = true;
+    } else if (strcmp(option, "--points") == 0 || strcmp(option, "--commutation") == 0) {
+        temps_t *duree = option[2] == 'p' ? &options->preemption.points : &options->preemption.commutation;
+        const char *fin;
+        if (!lire_temps(valeur, duree, &fin) || *fin != '\0' || *duree < 0 || *duree > TEMPS_PARAMETRE_MAX) {
+            fprintf(stderr, "Duree invalide: %s\n", valeur);
+            return 1;
+        }
+        options->avec_preemption = true;
+    } else if (strcmp(option, "--decalages") == 0) {
+        free(options->decalages.decalages);
+        if (!lire_decalages(valeur, &options->decalages.decalages, &options->decalages.nb_decalages)) {
+            fprintf(stderr, "Decalages invalides: %s\n", valeur);
+            return 1;
+        }
+        options->avec_decalages = true;
+    } else if (strcmp(option, "--pire-decalage") == 0) {
+        options->decalages.recherche_max = atoll(valeur);
+        if (options->decalages.recherche_max < 0) {
+            fprintf(stderr, "Nombre de combinaisons invalide: %s\n", valeur);
+            return 1;
+        }
+        options->decalages.recherche_max = options->decalages.recherche_max > 0 ?
+                                           options->decalages.recherche_max : COMBINAISONS_MAX_DEFAUT;
+        options->avec_decalages = true;
+    } else if (strcmp(option, "--niveau-trace") == 0) {
+        options->niveau_trace = (NiveauTrace)atoi(valeur);
+        if (options->niveau_trace < TRACE_AUCUN || options->niveau_trace > TRACE_COMPLET) {
+            fprintf(stderr, "Niveau de trace inconnu: %s\n", valeur);
+            return 1;
+        }
+    } else if (strcmp(option, "--duree") == 0 && programme->avec_duree) {
+        const char *fin;
+        if (!lire_temps(valeur, &options->duree_simulation, &fin) || *fin != '\0') {
+            fprintf(stderr, "Duree invalide: %s\n", valeur);
+            return 1;
+        }
+    } else if (strcmp(option, "--algo") == 0 && programme->nb_politiques > 1) {
+        bool tous = strcmp(valeur, "tous") == 0;
+        bool reconnu = false;
+        for (int p = 0; p < programme->nb_politiques; p++) {
+            options->politiques[p] = (tous && programme->politiques[p].par_defaut) ||
+                                     strcmp(valeur, programme->politiques[p].nom) == 0;
+            reconnu |= options->politiques[p];
+        }
+        if (!reconnu) {
+            fprintf(stderr, "Algorithme inconnu: %s\n", valeur);
+            return 1;
+        }
+    } else if (strcmp(option, "--analyse") == 0) {
+        bool toutes = strcmp(valeur, "toutes") == 0;
+        options->avec_analyse = toutes || strcmp(valeur, programme->analyse) == 0;
+        options->avec_simulation = toutes || strcmp(valeur, "simulation") == 0;
+        if (!options->avec_analyse && !options->avec_simulation) {
+            fprintf(stderr, "Analyse inconnue: %s\n", valeur);
+            return 1;
+        }
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+// Fonction pour lancer le mode interactif avec les options lues
+static int lancer_interactif(const ProgrammeLigneCommande *programme, OptionsLigneCommande *options) {
+    JeuRessources ressources;
+    
+    if (options->chemin_ressources != NULL &&
+        !ressources_charger(&ressources, options->chemin_ressources, options->protocole)) {
+        return 1;
+    }
+    int code = programme->interactif(options->chemin_trace, options->niveau_trace, options->chemin_metriques,
+                                     options->avec_politique ? &options->politique_echec : NULL,
+                                     options->avec_execution ? &options->execution : NULL,
+                                     options->chemin_ressources != NULL ? &ressources : NULL,
+                                     options->avec_preemption ? &options->preemption : NULL,
+                                     options->avec_decalages ? &options->decalages : NULL);
+    free(options->decalages.decalages);
+    if (options->chemin_ressources != NULL) {
+        ressources_liberer(&ressources);
+    }
+    return code;
+}
+
+// Fonction principale d'un programme : mode interactif sans argument, sinon
+// analyse des options puis mode interactif (options du mode interactif) ou
+// évaluation d'un fichier de lot
+int main_ligne_commande(const ProgrammeLigneCommande *programme, int argc, char **argv) {
+    OptionsLigneCommande options = {
+        .avec_analyse = true,
+        .avec_simulation = true,
+        .execution = { 1000000, 1, -1 },
+        .niveau_trace = TRACE_COMPLET,
+        .protocole = PROTOCOLE_AUCUN,
+        .preemption = { PREEMPTION_TOTALE, 0, 0 },
+        .decalages = { NULL, 0, 0, 0 }
+    };
+    
+    if (argc <= 1) {
+        return programme->interactif(NULL, TRACE_COMPLET, NULL, NULL, NULL, NULL, NULL, NULL);
+    }
+    for (int p = 0; p < programme->nb_politiques; p++) {
+        options.politiques[p] = programme->politiques[p].par_defaut;
+    }
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(programme, argv[0]);
+            free(options.decalages.decalages);
+            return 0;
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            free(options.decalages.decalages);
+            return 1;
+        }
+        int lu = lire_option(programme, &options, argv[i], valeur);
+        if (lu != 0) {
+            if (lu < 0) {
+                fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+                afficher_usage(programme, argv[0]);
+            }
+            free(options.decalages.decalages);
+            return 1;
+        }
+        i++;
+    }
+    
+    bool interactif = options.chemin_trace != NULL || options.chemin_metriques != NULL || options.avec_politique ||
+                      options.avec_execution || options.chemin_ressources != NULL || options.avec_preemption ||
+                      options.avec_decalages;
+    char erreur[192] = "";
+    options.decalages.nb_threads = options.nb_threads;
+    if (options.avec_protocole && options.chemin_ressources == NULL) {
+        snprintf(erreur, sizeof(erreur), "Option --protocole sans --ressources");
+    } else if (options.preemption.mode == PREEMPTION_POINTS && options.preemption.points == 0) {
+        snprintf(erreur, sizeof(erreur), "Option --preemption points sans --points");
+    } else if (options.preemption.mode != PREEMPTION_POINTS && options.preemption.points > 0) {
+        snprintf(erreur, sizeof(erreur), "Option --points sans --preemption points");
+    } else if (options.preemption.mode != PREEMPTION_TOTALE && options.chemin_ressources != NULL) {
+        snprintf(erreur, sizeof(erreur), "Preemption %s incompatible avec --ressources",
+                 nom_mode_preemption(options.preemption.mode));
+    } else if (options.chemin == NULL && !interactif) {
+        snprintf(erreur, sizeof(erreur), "Option --lot obligatoire hors du mode interactif");
+    } else if (options.chemin != NULL && interactif) {
+        snprintf(erreur, sizeof(erreur), "Options --trace, --metriques, --echec, --executer, --ressources, "
+                 "--preemption, --decalages et --pire-decalage disponibles en mode interactif uniquement");
+    }
+    if (erreur[0] != '\0') {
+        fprintf(stderr, "%s\n", erreur);
+        free(options.decalages.decalages);
+        return 1;
+    }
+    if (options.chemin == NULL) {
+        return lancer_interactif(programme, &options);
+    }
+    if (options.chemin_binaire != NULL) {
+        return convertir_lot(options.chemin, options.chemin_binaire);
+    }
+    
+    FILE *sortie = options.chemin_sortie != NULL ? fopen(options.chemin_sortie, "w") : stdout;
+    if (sortie == NULL) {
+        perror(options.chemin_sortie);
+        return 1;
+    }
+    int code = executer_lot(programme, &options, sortie);
+    if (sortie != stdout && fclose(sortie) != 0) {
+        perror(options.chemin_sortie);
+        code = 1;
+    }
+    return code;
+}
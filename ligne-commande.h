@@ -0,0 +1,73 @@
+#ifndef LIGNE_COMMANDE_H
+#define LIGNE_COMMANDE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "moteur-simulation.h"
+#include "executeur.h"
+#include "decalages.h"
+
+// Ligne de commande commune aux simulateurs (faisabilite-ordonnanceur,
+// simulation-EDF) : analyse des options, mode lot (évaluation parallèle d'un
+// fichier de jeux, résultats CSV) et affichages partagés du mode interactif.
+// Chaque programme se décrit par un ProgrammeLigneCommande : ses politiques,
+// son test analytique et son mode interactif.
+
+// Résultat d'une analyse en mode lot
+typedef enum {
+    NON_DEMANDE,
+    FAISABLE,
+    NON_FAISABLE,
+    NON_CONCLU,               // Test analytique suffisant seulement (décalages) en défaut,
+                              // ou simulation sans horizon calculable
+    INVALIDE
+} Verdict;
+
+// Politique évaluée en mode lot (valeur de --algo)
+typedef struct {
+    const char *nom;
+    TypeOrdonnanceur algorithme;
+    bool par_defaut;              // Évaluée sans --algo et avec --algo tous
+    bool analysable;              // Le test analytique du programme s'applique
+} PolitiqueLot;
+
+// Test analytique d'un système configuré ; intervalle_violation reçoit le
+// premier intervalle en défaut (0 : aucun)
+typedef bool (*TestAnalytique)(const Systeme *systeme, long long *intervalle_violation);
+
+// Mode interactif d'un programme (NULL : option non demandée)
+typedef int (*ModeInteractif)(const char *chemin_trace, NiveauTrace niveau, const char *chemin_metriques,
+                              const PolitiqueEchec *politique_echec, const OptionsExecution *execution,
+                              JeuRessources *ressources, const OptionsPreemption *preemption,
+                              const OptionsDecalages *decalages);
+
+// Description d'un programme
+typedef struct {
+    const PolitiqueLot *politiques; // Une seule : pas d'option --algo ni de colonne algorithme
+    int nb_politiques;
+    const char *analyse;          // Nom du test analytique (--analyse, colonne CSV)
+    TestAnalytique tester;
+    bool avec_intervalle;         // Colonne intervalle_violation
+    bool avec_duree;              // Option --duree
+    bool avec_conversion;         // Option --convertir
+    const char *aide_echec;       // Aide de --echec : comportement par défaut
+    const char *aide_protocole;   // Aide de --protocole : valeurs puis description
+    ModeInteractif interactif;
+} ProgrammeLigneCommande;
+
+// Résultat de la recherche du pire décalage du mode interactif
+typedef enum {
+    RECHERCHE_EFFECTUEE,
+    RECHERCHE_TROP_LONGUE,        // Plus de combinaisons que --pire-decalage
+    RECHERCHE_HORIZON,            // Hyperpériode trop grande
+    RECHERCHE_IMPOSSIBLE          // Mémoire ou threads insuffisants (signalé sur stderr)
+} EtatRecherche;
+
+int main_ligne_commande(const ProgrammeLigneCommande *programme, int argc, char **argv);
+const char* nom_verdict(Verdict verdict);
+
+void afficher_trace(Trace *trace, const char *chemin_trace, const ParametresTache *parametres, int nb_taches);
+EtatRecherche lancer_recherche_decalages(RechercheDecalages *recherche, const Systeme *systeme,
+                                         const OptionsDecalages *options);
+
+#endif
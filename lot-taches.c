@@ -0,0 +1,390 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include "lot-taches.h"
+
+#define MAGIC_BINAIRE "ORDB"
+#define VERSION_BINAIRE 2u          // Version écrite ; la version 1 (sans décalage) reste lue
+#define TAILLE_LIGNE 256
+#define TAILLE_TAMPON (1 << 16)
+
+// Fonction pour agrandir le tampon des paramètres si nécessaire
+static bool reserver(LecteurLot *lecteur, int nb_taches) {
+    if (nb_taches <= lecteur->capacite) {
+        return true;
+    }
+    
+    int capacite = lecteur->capacite > 0 ? lecteur->capacite : 16;
+    while (capacite < nb_taches) {
+        capacite *= 2;
+    }
+    ParametresTache *parametres = realloc(lecteur->parametres, capacite * sizeof(ParametresTache));
+    if (parametres == NULL) {
+        return false;
+    }
+    lecteur->parametres = parametres;
+    lecteur->capacite = capacite;
+    return true;
+}
+
+// Fonction pour recharger le tampon de lecture (renvoie le nombre d'octets disponibles)
+static size_t remplir(LecteurLot *lecteur) {
+    if (lecteur->debut < lecteur->fin) {
+        return lecteur->fin - lecteur->debut;
+    }
+    lecteur->debut = 0;
+    lecteur->fin = fread(lecteur->tampon, 1, TAILLE_TAMPON, lecteur->fichier);
+    return lecteur->fin;
+}
+
+// Fonction pour lire exactement n octets (renvoie le nombre d'octets lus)
+static size_t lire_octets(LecteurLot *lecteur, void *destination, size_t n) {
+    char *d = destination;
+    size_t lus = 0;
+    
+    while (lus < n && remplir(lecteur) > 0) {
+        size_t bloc = lecteur->fin - lecteur->debut;
+        if (bloc > n - lus) {
+            bloc = n - lus;
+        }
+        memcpy(d + lus, lecteur->tampon + lecteur->debut, bloc);
+        lecteur->debut += bloc;
+        lus += bloc;
+    }
+    return lus;
+}
+
+// Fonction pour lire une ligne (tronquée à TAILLE_LIGNE - 1 caractères)
+static bool lire_ligne(LecteurLot *lecteur, char *ligne) {
+    size_t longueur = 0;
+    bool lu = false;
+    
+    while (remplir(lecteur) > 0) {
+        char c = lecteur->tampon[lecteur->debut++];
+        lu = true;
+        if (c == '\n') {
+            break;
+        }
+        if (longueur < TAILLE_LIGNE - 1) {
+            ligne[longueur++] = c;
+        }
+    }
+    ligne[longueur] = '\0';
+    return lu;
+}
+
+// Fonction pour lire la prochaine ligne utile (ni vide, ni commentaire)
+static char *ligne_utile(LecteurLot *lecteur, char *ligne) {
+    while (lire_ligne(lecteur, ligne)) {
+        lecteur->ligne++;
+        char *p = ligne;
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p != '\0' && *p != '#') {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+// Fonction pour vérifier qu'il ne reste que des blancs ou un commentaire
+static bool fin_de_ligne(const char *p) {
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    return *p == '\0' || *p == '#';
+}
+
+// Fonction pour lire un jeu au format texte
+static int lire_jeu_texte(LecteurLot *lecteur) {
+    char tampon[TAILLE_LIGNE];
+    char *p = ligne_utile(lecteur, tampon);
+    char *fin;
+    
+    if (p == NULL) {
+        return 0;
+    }
+    
+    long n = strtol(p, &fin, 10);
+    if (fin == p || n < 0 || n > 100000000L) {
+        fprintf(stderr, "Lot: ligne %ld: nombre de taches attendu\n", lecteur->ligne);
+        return -1;
+    }
+    if (!reserver(lecteur, (int)n)) {
+        fprintf(stderr, "Lot: memoire insuffisante pour %ld taches\n", n);
+        return -1;
+    }
+    
+    for (int i = 0; i < n; i++) {
+        temps_t valeurs[3];
+        const char *q;
+        
+        p = ligne_utile(lecteur, tampon);
+        if (p == NULL) {
+            fprintf(stderr, "Lot: jeu %ld tronque (%d/%ld taches)\n", lecteur->numero + 1, i, n);
+            return -1;
+        }
+        // C, D, T et le décalage O acceptent une unité ("250us", "2ms"), la
+        // priorité est un entier. Une valeur négative est lue telle quelle : le
+        // jeu sera jugé invalide.
+        for (int k = 0; k < 3; k++) {
+            while (isspace((unsigned char)*p)) {
+                p++;
+            }
+            bool negatif = *p == '-';
+            if (!lire_temps(p + negatif, &valeurs[k], &q)) {
+                fprintf(stderr, "Lot: ligne %ld: \"C D T [P [O]]\" attendu (duree invalide ou trop grande)\n",
+                        lecteur->ligne);
+                return -1;
+            }
+            valeurs[k] = negatif ? -valeurs[k] : valeurs[k];
+            p = (char *)q;
+        }
+        // P et O sont facultatifs, mais un champ présent doit se lire en
+        // entier : "1 4 4 abc" est une erreur, pas une tâche sans priorité
+        long priorite = 0;
+        bool avec_priorite = !fin_de_ligne(p);
+        temps_t decalage = 0;
+        
+        if (avec_priorite) {
+            errno = 0;
+            priorite = strtol(p, &fin, 10);
+            if (fin == p || errno == ERANGE || priorite < INT_MIN || priorite > INT_MAX ||
+                !(isspace((unsigned char)*fin) || *fin == '\0' || *fin == '#')) {
+                fprintf(stderr, "Lot: ligne %ld: \"C D T [P [O]]\" attendu (priorite invalide)\n",
+                        lecteur->ligne);
+                return -1;
+            }
+            p = fin;
+        }
+        
+        // Décalage facultatif, après la priorité
+        if (avec_priorite && !fin_de_ligne(p)) {
+            while (isspace((unsigned char)*p)) {
+                p++;
+            }
+            bool negatif = *p == '-';
+            if (!lire_temps(p + negatif, &decalage, &q)) {
+                fprintf(stderr, "Lot: ligne %ld: \"C D T [P [O]]\" attendu (decalage invalide ou trop grand)\n",
+                        lecteur->ligne);
+                return -1;
+            }
+            decalage = negatif ? -decalage : decalage;
+            p = (char *)q;
+        }
+        if (!fin_de_ligne(p)) {
+            fprintf(stderr, "Lot: ligne %ld: \"C D T [P [O]]\" attendu (champ en trop)\n", lecteur->ligne);
+            return -1;
+        }
+        
+        lecteur->parametres[i].duree_execution = valeurs[0];
+        lecteur->parametres[i].echeance = valeurs[1];
+        lecteur->parametres[i].periode = valeurs[2];
+        lecteur->parametres[i].priorite = avec_priorite ? (int)priorite : 0;
+        lecteur->parametres[i].decalage = decalage;
+    }
+    
+    lecteur->nb_taches = (int)n;
+    return 1;
+}
+
+// Fonction pour lire un jeu au format binaire
+static int lire_jeu_binaire(LecteurLot *lecteur) {
+    uint32_t n;
+    
+    size_t lus = lire_octets(lecteur, &n, sizeof(n));
+    if (lus == 0) {
+        return 0;
+    }
+    if (lus != sizeof(n)) {
+        fprintf(stderr, "Lot: jeu %ld tronque\n", lecteur->numero + 1);
+        return -1;
+    }
+    if (n > 100000000u || !reserver(lecteur, (int)n)) {
+        fprintf(stderr, "Lot: jeu %ld: taille invalide (%u)\n", lecteur->numero + 1, n);
+        return -1;
+    }
+    
+    // Chaque tâche est un enregistrement de 5 int32 (C D T P O), élargi à la
+    // lecture ; en version 1, de 4 int32 sans décalage
+    size_t taille = (lecteur->version == 1 ? 4 : 5) * sizeof(int32_t);
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t enregistrement[5] = { 0 };
+        if (lire_octets(lecteur, enregistrement, taille) != taille) {
+            fprintf(stderr, "Lot: jeu %ld tronque\n", lecteur->numero + 1);
+            return -1;
+        }
+        lecteur->parametres[i] = (ParametresTache){ enregistrement[0], enregistrement[1],
+                                                    enregistrement[2], enregistrement[3], enregistrement[4] };
+    }
+    
+    lecteur->nb_taches = (int)n;
+    return 1;
+}
+
+// Fonction pour ouvrir un fichier de lot ("-" pour l'entrée standard)
+// Le format binaire est reconnu à son en-tête, sinon le fichier est lu comme du texte
+bool lot_ouvrir(LecteurLot *lecteur, const char *chemin) {
+    memset(lecteur, 0, sizeof(*lecteur));
+    lecteur->fichier = strcmp(chemin, "-") == 0 ? stdin : fopen(chemin, "rb");
+    if (lecteur->fichier == NULL) {
+        perror(chemin);
+        return false;
+    }
+    lecteur->tampon = malloc(TAILLE_TAMPON);
+    if (lecteur->tampon == NULL) {
+        lot_fermer(lecteur);
+        return false;
+    }
+    
+    // L'en-tête est examiné directement dans le tampon, sans le consommer
+    lecteur->format = FORMAT_TEXTE;
+    remplir(lecteur);
+    if (lecteur->fin >= 8 && memcmp(lecteur->tampon, MAGIC_BINAIRE, 4) == 0) {
+        uint32_t version;
+        memcpy(&version, lecteur->tampon + 4, sizeof(version));
+        if (version != 1 && version != VERSION_BINAIRE) {
+            fprintf(stderr, "%s: version de lot binaire non supportee\n", chemin);
+            lot_fermer(lecteur);
+            return false;
+        }
+        lecteur->debut = 8;
+        lecteur->format = FORMAT_BINAIRE;
+        lecteur->version = version;
+    }
+    
+    return true;
+}
+
+// Fonction pour lire le jeu suivant
+// Renvoie 1 si un jeu a été lu, 0 en fin de fichier, -1 en cas d'erreur
+int lot_lire_jeu(LecteurLot *lecteur) {
+    int resultat = lecteur->format == FORMAT_BINAIRE ?
+                   lire_jeu_binaire(lecteur) : lire_jeu_texte(lecteur);
+    
+    if (resultat == 1) {
+        lecteur->numero++;
+    } else if (resultat < 0) {
+        lecteur->erreur = true;
+    }
+    return resultat;
+}
+
+// Fonction pour lire jusqu'à max_jeux jeux dans un bloc (mémoire du bloc réutilisée)
+// Renvoie le nombre de jeux lus ; 0 en fin de fichier ou en cas d'erreur (voir lecteur->erreur)
+int lot_lire_bloc(LecteurLot *lecteur, BlocLot *bloc, int max_jeux) {
+    long nb_taches = 0;
+    
+    if (bloc->capacite_jeux < max_jeux) {
+        long *debut = realloc(bloc->debut, (max_jeux + 1) * sizeof(long));
+        if (debut == NULL) {
+            lecteur->erreur = true;
+            return 0;
+        }
+        bloc->debut = debut;
+        bloc->capacite_jeux = max_jeux;
+    }
+    
+    bloc->nb_jeux = 0;
+    bloc->premier_numero = lecteur->numero + 1;
+    bloc->debut[0] = 0;
+    
+    while (bloc->nb_jeux < max_jeux && lot_lire_jeu(lecteur) == 1) {
+        if (nb_taches + lecteur->nb_taches > bloc->capacite_taches) {
+            long capacite = bloc->capacite_taches > 0 ? bloc->capacite_taches : 1024;
+            while (capacite < nb_taches + lecteur->nb_taches) {
+                capacite *= 2;
+            }
+            ParametresTache *parametres = realloc(bloc->parametres, capacite * sizeof(ParametresTache));
+            if (parametres == NULL) {
+                lecteur->erreur = true;
+                break;
+            }
+            bloc->parametres = parametres;
+            bloc->capacite_taches = capacite;
+        }
+        
+        memcpy(bloc->parametres + nb_taches, lecteur->parametres, 
+               lecteur->nb_taches * sizeof(ParametresTache));
+        nb_taches += lecteur->nb_taches;
+        bloc->nb_jeux++;
+        bloc->debut[bloc->nb_jeux] = nb_taches;
+    }
+    
+    return bloc->nb_jeux;
+}
+
+// Fonction pour libérer la mémoire d'un bloc
+void lot_liberer_bloc(BlocLot *bloc) {
+    free(bloc->parametres);
+    free(bloc->debut);
+    bloc->parametres = NULL;
+    bloc->debut = NULL;
+    bloc->nb_jeux = 0;
+    bloc->capacite_taches = 0;
+    bloc->capacite_jeux = 0;
+}
+
+// Fonction pour fermer le fichier et libérer le tampon
+void lot_fermer(LecteurLot *lecteur) {
+    if (lecteur->fichier != NULL && lecteur->fichier != stdin) {
+        fclose(lecteur->fichier);
+    }
+    free(lecteur->parametres);
+    free(lecteur->tampon);
+    memset(lecteur, 0, sizeof(*lecteur));
+}
+
+// Fonction pour écrire l'en-tête d'un fichier de lot binaire
+bool lot_ecrire_entete_binaire(FILE *fichier) {
+    uint32_t version = VERSION_BINAIRE;
+    
+    return fwrite(MAGIC_BINAIRE, 1, 4, fichier) == 4 &&
+           fwrite(&version, sizeof(version), 1, fichier) == 1;
+}
+
+// Fonction pour écrire un jeu au format binaire
+// Renvoie false si une valeur ne tient pas dans un int32 (rien n'est alors écrit)
+bool lot_ecrire_jeu_binaire(FILE *fichier, const ParametresTache *parametres, int nb_taches) {
+    uint32_t n = (uint32_t)nb_taches;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (parametres[i].duree_execution < INT32_MIN || parametres[i].duree_execution > INT32_MAX ||
+            parametres[i].echeance < INT32_MIN || parametres[i].echeance > INT32_MAX ||
+            parametres[i].periode < INT32_MIN || parametres[i].periode > INT32_MAX ||
+            parametres[i].decalage < INT32_MIN || parametres[i].decalage > INT32_MAX) {
+            return false;
+        }
+    }
+    if (fwrite(&n, sizeof(n), 1, fichier) != 1) {
+        return false;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        int32_t enregistrement[5] = {
+            (int32_t)parametres[i].duree_execution, (int32_t)parametres[i].echeance,
+            (int32_t)parametres[i].periode, parametres[i].priorite, (int32_t)parametres[i].decalage
+        };
+        if (fwrite(enregistrement, sizeof(enregistrement), 1, fichier) != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Fonction pour vérifier que les paramètres d'un jeu sont exploitables
+// (strictement positifs et au plus TEMPS_PARAMETRE_MAX ; décalage positif ou nul)
+bool lot_parametres_valides(const ParametresTache *parametres, int nb_taches) {
+    for (int i = 0; i < nb_taches; i++) {
+        if (parametres[i].duree_execution <= 0 || parametres[i].echeance <= 0 ||
+            parametres[i].periode <= 0 || parametres[i].duree_execution > TEMPS_PARAMETRE_MAX ||
+            parametres[i].echeance > TEMPS_PARAMETRE_MAX || parametres[i].periode > TEMPS_PARAMETRE_MAX ||
+            parametres[i].decalage < 0 || parametres[i].decalage > TEMPS_PARAMETRE_MAX) {
+            return false;
+        }
+    }
+    return true;
+}
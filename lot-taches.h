@@ -0,0 +1,53 @@
+#ifndef LOT_TACHES_H
+#define LOT_TACHES_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "tache.h"
+
+// Formats de fichier de lot
+typedef enum {
+    FORMAT_TEXTE,             // Nombre de tâches puis une ligne "C D T [P [O]]" par tâche (C, D, T, O avec unité facultative)
+    FORMAT_BINAIRE            // En-tête "ORDB" + version, puis n (uint32) et n x 5 int32 "C D T P O" par jeu
+                              // (ticks ; version 1 : n x 4 int32, sans décalage)
+} FormatLot;
+
+// Lecteur séquentiel d'un fichier contenant une suite de jeux de tâches
+typedef struct {
+    FILE *fichier;
+    FormatLot format;
+    unsigned version;         // Version du format binaire
+    ParametresTache *parametres; // Tâches du jeu courant (tampon réutilisé)
+    int capacite;             // Taille allouée du tampon
+    int nb_taches;            // Nombre de tâches du jeu courant
+    long numero;              // Numéro du jeu courant (à partir de 1)
+    long ligne;               // Ligne courante (format texte)
+    bool erreur;              // Erreur de lecture rencontrée
+    
+    // Tampon de lecture interne (évite un appel système par ligne)
+    char *tampon;
+    size_t debut;             // Premier octet non consommé
+    size_t fin;               // Fin des octets valides
+} LecteurLot;
+
+// Bloc de jeux consécutifs copiés hors du lecteur (traitement en parallèle)
+typedef struct {
+    ParametresTache *parametres; // Tâches de tous les jeux, mises bout à bout
+    long *debut;              // Première tâche de chaque jeu (nb_jeux + 1 entrées)
+    long premier_numero;      // Numéro du premier jeu du bloc
+    int nb_jeux;
+    long capacite_taches;
+    int capacite_jeux;
+} BlocLot;
+
+bool lot_ouvrir(LecteurLot *lecteur, const char *chemin);
+int lot_lire_jeu(LecteurLot *lecteur);
+void lot_fermer(LecteurLot *lecteur);
+int lot_lire_bloc(LecteurLot *lecteur, BlocLot *bloc, int max_jeux);
+void lot_liberer_bloc(BlocLot *bloc);
+
+bool lot_ecrire_entete_binaire(FILE *fichier);
+bool lot_ecrire_jeu_binaire(FILE *fichier, const ParametresTache *parametres, int nb_taches);
+bool lot_parametres_valides(const ParametresTache *parametres, int nb_taches);
+
+#endif
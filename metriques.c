@@ -0,0 +1,196 @@
+#include <stdlib.h>
+#include <string.h>
+#include "metriques.h"
+
+// Fonction pour obtenir la plus petite valeur d'une case
+static long long histogramme_borne_basse(int indice) {
+    if (indice < 2 * HISTO_SOUS_CASES) {
+        return indice;
+    }
+    int decalage = indice / HISTO_SOUS_CASES - 1;
+    return (long long)(indice % HISTO_SOUS_CASES + HISTO_SOUS_CASES) << decalage;
+}
+
+// Fonction pour obtenir la plus grande valeur d'une case
+static long long histogramme_borne_haute(int indice) {
+    if (indice < 2 * HISTO_SOUS_CASES) {
+        return indice;
+    }
+    int decalage = indice / HISTO_SOUS_CASES - 1;
+    return histogramme_borne_basse(indice) + ((1LL << decalage) - 1);
+}
+
+// Fonction pour obtenir le quantile (0 à 1) des valeurs enregistrées
+// La valeur renvoyée est la borne haute de la case atteinte, ramenée dans
+// [min, max] : elle majore le quantile exact d'au plus 2^-PRECISION.
+long long histogramme_quantile(const Histogramme *histogramme, double quantile) {
+    if (histogramme->nombre == 0) {
+        return 0;
+    }
+    unsigned long long rang = (unsigned long long)(quantile * histogramme->nombre + 0.5);
+    unsigned long long cumul = 0;
+    
+    if (rang < 1) {
+        rang = 1;
+    }
+    for (int k = histogramme_case(histogramme->min); k < HISTO_NB_CASES; k++) {
+        cumul += histogramme->cases[k];
+        if (cumul >= rang) {
+            long long valeur = histogramme_borne_haute(k);
+            if (valeur > histogramme->max) {
+                valeur = histogramme->max;
+            }
+            return valeur < histogramme->min ? histogramme->min : valeur;
+        }
+    }
+    return histogramme->max;
+}
+
+// Fonction pour obtenir la moyenne exacte des valeurs enregistrées
+double histogramme_moyenne(const Histogramme *histogramme) {
+    return histogramme->nombre > 0 ? (double)histogramme->somme / histogramme->nombre : 0.0;
+}
+
+// Fonction pour créer les métriques d'un système de nb_taches tâches
+bool metriques_creer(Metriques *metriques, int nb_taches) {
+    metriques->taches = malloc((nb_taches > 0 ? nb_taches : 1) * sizeof(MetriquesTache));
+    metriques->nb_taches = nb_taches;
+    if (metriques->taches == NULL) {
+        return false;
+    }
+    metriques_reinitialiser(metriques);
+    return true;
+}
+
+// Fonction pour remettre les métriques à zéro (avant une nouvelle simulation)
+void metriques_reinitialiser(Metriques *metriques) {
+    memset(metriques->taches, 0, metriques->nb_taches * sizeof(MetriquesTache));
+    metriques->temps_inactif = 0;
+}
+
+// Fonction pour libérer les métriques
+void metriques_liberer(Metriques *metriques) {
+    free(metriques->taches);
+    metriques->taches = NULL;
+    metriques->nb_taches = 0;
+}
+
+// Fonction pour calculer la durée simulée (exécution, commutation et inactivité)
+static long long duree_simulee(const Metriques *metriques) {
+    long long duree = metriques->temps_inactif;
+    
+    for (int i = 0; i < metriques->nb_taches; i++) {
+        duree += metriques->taches[i].temps_execution + metriques->taches[i].temps_commutation;
+    }
+    return duree;
+}
+
+// Fonction pour exporter une ligne CSV par tâche
+// La gigue de démarrage est l'écart entre la plus grande et la plus petite
+// latence de démarrage ; les quantiles sont lus dans les histogrammes.
+void metriques_exporter_csv(const Metriques *metriques, const ParametresTache *parametres, FILE *sortie) {
+    long long duree = duree_simulee(metriques);
+    
+    fprintf(sortie, "tache,C,D,T,instances,echeances_manquees,abandons,preemptions,preemptions_max,"
+                    "inversions,blocage_total,blocage_max,reponse_min,reponse_moy,reponse_p50,reponse_p90,"
+                    "reponse_p99,reponse_max,retard_max,demarrage_min,demarrage_max,gigue_demarrage,"
+                    "commutations,temps_commutation,temps_execution,duree,temps_inactif\n");
+    for (int i = 0; i < metriques->nb_taches; i++) {
+        const MetriquesTache *m = &metriques->taches[i];
+        const Histogramme *reponse = &m->reponse;
+        const Histogramme *demarrage = &m->demarrage;
+        
+        fprintf(sortie, "%d,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%d,%lld,%lld,%lld,", i + 1,
+                parametres[i].duree_execution, parametres[i].echeance, parametres[i].periode, m->instances,
+                m->echeances_manquees, m->abandons, m->preemptions, m->preemptions_max, m->inversions,
+                m->blocage_total, m->blocage_max);
+        if (reponse->nombre > 0) {
+            fprintf(sortie, "%lld,%.3f,%lld,%lld,%lld,%lld,%lld,", reponse->min, histogramme_moyenne(reponse),
+                    histogramme_quantile(reponse, 0.5), histogramme_quantile(reponse, 0.9),
+                    histogramme_quantile(reponse, 0.99), reponse->max, m->retard_max);
+        } else {
+            fprintf(sortie, "-,-,-,-,-,-,-,");
+        }
+        if (demarrage->nombre > 0) {
+            fprintf(sortie, "%lld,%lld,%lld,", demarrage->min, demarrage->max, demarrage->max - demarrage->min);
+        } else {
+            fprintf(sortie, "-,-,-,");
+        }
+        fprintf(sortie, "%lld,%lld,%lld,%lld,%lld\n", m->commutations, m->temps_commutation, m->temps_execution,
+                duree, metriques->temps_inactif);
+    }
+}
+
+// Fonction pour exporter un histogramme en JSON (cases non vides : [min, max, nombre])
+static void exporter_histogramme_json(const Histogramme *histogramme, FILE *sortie) {
+    bool premiere = true;
+    
+    fprintf(sortie, "{\"nombre\": %llu", histogramme->nombre);
+    if (histogramme->nombre > 0) {
+        fprintf(sortie, ", \"min\": %lld, \"moyenne\": %.3f, \"p50\": %lld, \"p90\": %lld, \"p99\": %lld, "
+                        "\"p999\": %lld, \"max\": %lld", histogramme->min, histogramme_moyenne(histogramme),
+                histogramme_quantile(histogramme, 0.5), histogramme_quantile(histogramme, 0.9),
+                histogramme_quantile(histogramme, 0.99), histogramme_quantile(histogramme, 0.999),
+                histogramme->max);
+    }
+    fprintf(sortie, ", \"cases\": [");
+    for (int k = 0; histogramme->nombre > 0 && k < HISTO_NB_CASES; k++) {
+        if (histogramme->cases[k] > 0) {
+            fprintf(sortie, "%s[%lld, %lld, %llu]", premiere ? "" : ", ", histogramme_borne_basse(k),
+                    histogramme_borne_haute(k), histogramme->cases[k]);
+            premiere = false;
+        }
+    }
+    fprintf(sortie, "]}");
+}
+
+// Fonction pour exporter toutes les métriques en JSON, histogrammes compris
+void metriques_exporter_json(const Metriques *metriques, const ParametresTache *parametres, FILE *sortie) {
+    fprintf(sortie, "{\n  \"duree\": %lld,\n  \"temps_inactif\": %lld,\n  \"taches\": [\n",
+            duree_simulee(metriques), metriques->temps_inactif);
+    for (int i = 0; i < metriques->nb_taches; i++) {
+        const MetriquesTache *m = &metriques->taches[i];
+        
+        fprintf(sortie, "    {\"tache\": %d, \"C\": %lld, \"D\": %lld, \"T\": %lld, \"instances\": %lld, "
+                        "\"echeances_manquees\": %lld, \"abandons\": %lld, \"preemptions\": %lld, "
+                        "\"preemptions_max\": %d, \"inversions\": %lld, \"blocage_total\": %lld, "
+                        "\"blocage_max\": %lld, \"commutations\": %lld, \"temps_commutation\": %lld, "
+                        "\"temps_execution\": %lld, ", i + 1,
+                parametres[i].duree_execution, parametres[i].echeance, parametres[i].periode,
+                m->instances, m->echeances_manquees, m->abandons, m->preemptions, m->preemptions_max,
+                m->inversions, m->blocage_total, m->blocage_max, m->commutations, m->temps_commutation,
+                m->temps_execution);
+        if (m->instances > 0) {
+            fprintf(sortie, "\"retard_max\": %lld, ", m->retard_max);
+        }
+        fprintf(sortie, "\n     \"reponse\": ");
+        exporter_histogramme_json(&m->reponse, sortie);
+        fprintf(sortie, ",\n     \"demarrage\": ");
+        exporter_histogramme_json(&m->demarrage, sortie);
+        fprintf(sortie, "}%s\n", i + 1 < metriques->nb_taches ? "," : "");
+    }
+    fprintf(sortie, "  ]\n}\n");
+}
+
+// Fonction pour écrire les métriques dans un fichier : JSON si son nom se
+// termine par .json, CSV sinon (false en cas d'erreur)
+bool metriques_enregistrer(const Metriques *metriques, const ParametresTache *parametres, const char *chemin) {
+    size_t longueur = strlen(chemin);
+    FILE *fichier = fopen(chemin, "w");
+    
+    if (fichier == NULL) {
+        perror(chemin);
+        return false;
+    }
+    if (longueur >= 5 && strcmp(chemin + longueur - 5, ".json") == 0) {
+        metriques_exporter_json(metriques, parametres, fichier);
+    } else {
+        metriques_exporter_csv(metriques, parametres, fichier);
+    }
+    bool erreur = ferror(fichier) != 0;
+    if (fclose(fichier) != 0 || erreur) {
+        perror(chemin);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,168 @@
+#ifndef METRIQUES_H
+#define METRIQUES_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "tache.h"
+
+// Histogramme log-linéaire à mémoire fixe (à la manière de HdrHistogram) :
+// les valeurs inférieures à 2^(PRECISION+1) ont chacune leur case, au-delà
+// chaque puissance de deux est découpée en 2^PRECISION cases. L'erreur
+// relative d'une valeur lue est donc au plus 2^-PRECISION (environ 3 %).
+#define HISTO_PRECISION 5
+#define HISTO_SOUS_CASES (1 << HISTO_PRECISION)
+#define HISTO_NB_CASES ((64 - HISTO_PRECISION) * HISTO_SOUS_CASES) // Valeurs de 0 à LLONG_MAX
+
+typedef struct {
+    unsigned long long cases[HISTO_NB_CASES];
+    unsigned long long nombre;    // Valeurs enregistrées
+    long long somme;
+    long long min;
+    long long max;
+} Histogramme;
+
+// Métriques d'une tâche, cumulées sur toutes ses instances
+typedef struct {
+    long long instances;          // Instances terminées
+    long long echeances_manquees;
+    long long abandons;           // Instances abandonnées ou activations sautées (politique d'échec)
+    long long preemptions;
+    int preemptions_max;          // Plus grand nombre de préemptions d'une même instance
+    long long inversions;         // Inversions de priorité subies (ressources partagées)
+    long long blocage_total;      // Temps passé à attendre des tâches moins prioritaires
+    long long blocage_max;        // Plus long blocage d'une même instance
+    long long retard_max;         // Plus grand retard fin - échéance (négatif : en avance)
+    long long commutations;       // Commutations de contexte payées par la tâche
+    long long temps_commutation;
+    long long temps_execution;
+    Histogramme reponse;          // Temps de réponse : fin - activation
+    Histogramme demarrage;        // Latence de démarrage : début - activation
+} MetriquesTache;
+
+// Métriques d'une simulation (la durée simulée est la somme des temps
+// d'exécution, de commutation et d'inactivité)
+typedef struct {
+    MetriquesTache *taches;
+    int nb_taches;
+    long long temps_inactif;
+} Metriques;
+
+bool metriques_creer(Metriques *metriques, int nb_taches);
+void metriques_reinitialiser(Metriques *metriques);
+void metriques_liberer(Metriques *metriques);
+
+long long histogramme_quantile(const Histogramme *histogramme, double quantile);
+double histogramme_moyenne(const Histogramme *histogramme);
+
+void metriques_exporter_csv(const Metriques *metriques, const ParametresTache *parametres, FILE *sortie);
+void metriques_exporter_json(const Metriques *metriques, const ParametresTache *parametres, FILE *sortie);
+bool metriques_enregistrer(const Metriques *metriques, const ParametresTache *parametres, const char *chemin);
+
+// Fonction pour obtenir la case d'une valeur positive ou nulle
+static inline int histogramme_case(long long valeur) {
+    if (valeur < 2 * HISTO_SOUS_CASES) {
+        return (int)valeur;
+    }
+    int decalage = 63 - __builtin_clzll((unsigned long long)valeur) - HISTO_PRECISION;
+    return (decalage + 1) * HISTO_SOUS_CASES + (int)(valeur >> decalage) - HISTO_SOUS_CASES;
+}
+
+// Fonction pour enregistrer une valeur (en O(1), sans allocation)
+static inline void histogramme_ajouter(Histogramme *histogramme, long long valeur) {
+    if (valeur < 0) {
+        valeur = 0;
+    }
+    histogramme->cases[histogramme_case(valeur)]++;
+    if (histogramme->nombre == 0 || valeur < histogramme->min) {
+        histogramme->min = valeur;
+    }
+    if (histogramme->nombre == 0 || valeur > histogramme->max) {
+        histogramme->max = valeur;
+    }
+    histogramme->nombre++;
+    histogramme->somme += valeur;
+}
+
+// Points d'enregistrement appelés par le moteur de simulation : comme pour la
+// trace, ils sont sans effet lorsque les métriques sont désactivées (NULL)
+
+// Fonction appelée à la première exécution d'une instance (latence : début - activation)
+static inline void metriques_demarrage(Metriques *metriques, int tache, temps_t latence) {
+    if (metriques != NULL) {
+        histogramme_ajouter(&metriques->taches[tache].demarrage, latence);
+    }
+}
+
+// Fonction appelée pour chaque segment d'exécution
+static inline void metriques_execution(Metriques *metriques, int tache, temps_t duree) {
+    if (metriques != NULL) {
+        metriques->taches[tache].temps_execution += duree;
+    }
+}
+
+// Fonction appelée pour chaque segment de commutation de contexte
+static inline void metriques_commutation(Metriques *metriques, int tache, temps_t duree) {
+    if (metriques != NULL) {
+        metriques->taches[tache].commutations++;
+        metriques->taches[tache].temps_commutation += duree;
+    }
+}
+
+// Fonction appelée lorsqu'une instance est interrompue avant sa terminaison
+static inline void metriques_preemption(Metriques *metriques, int tache) {
+    if (metriques != NULL) {
+        metriques->taches[tache].preemptions++;
+    }
+}
+
+// Fonction appelée à la terminaison d'une instance (retard : fin - échéance,
+// preemptions et blocage : préemptions et blocage subis par l'instance)
+static inline void metriques_terminaison(Metriques *metriques, int tache, temps_t reponse, temps_t retard,
+                                         int preemptions, temps_t blocage) {
+    if (metriques == NULL) {
+        return;
+    }
+    MetriquesTache *m = &metriques->taches[tache];
+    histogramme_ajouter(&m->reponse, reponse);
+    if (m->instances == 0 || retard > m->retard_max) {
+        m->retard_max = retard;
+    }
+    if (preemptions > m->preemptions_max) {
+        m->preemptions_max = preemptions;
+    }
+    if (blocage > m->blocage_max) {
+        m->blocage_max = blocage;
+    }
+    m->blocage_total += blocage;
+    m->instances++;
+}
+
+// Fonction appelée au début d'une inversion de priorité subie par une instance
+static inline void metriques_inversion(Metriques *metriques, int tache) {
+    if (metriques != NULL) {
+        metriques->taches[tache].inversions++;
+    }
+}
+
+// Fonction appelée pour chaque instance abandonnée ou activation sautée
+static inline void metriques_abandon(Metriques *metriques, int tache) {
+    if (metriques != NULL) {
+        metriques->taches[tache].abandons++;
+    }
+}
+
+// Fonction appelée pour chaque échéance manquée
+static inline void metriques_echeance_manquee(Metriques *metriques, int tache) {
+    if (metriques != NULL) {
+        metriques->taches[tache].echeances_manquees++;
+    }
+}
+
+// Fonction appelée pour chaque période d'inactivité du processeur
+static inline void metriques_inactif(Metriques *metriques, temps_t duree) {
+    if (metriques != NULL) {
+        metriques->temps_inactif += duree;
+    }
+}
+
+#endif
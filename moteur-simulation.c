@@ -0,0 +1,950 @@
+#include <stdlib.h>
+#include <string.h>
+#include "analyse.h"
+#include "moteur-simulation.h"
+
+// Clé d'une tâche dans la file des prêts, calculée sur sa première instance en
+// attente : la plus petite clé est élue, le plus petit indice départage
+typedef long long (*CleFile)(const Tache *tache, const Instance *instance);
+
+// Fonction pour initialiser une tâche
+void initialiser_tache(Tache *tache, int id, temps_t duree, temps_t echeance, temps_t periode, int priorite,
+                       temps_t decalage) {
+    tache->id = id;
+    tache->duree_execution = duree;
+    tache->echeance = echeance;
+    tache->periode = periode;
+    tache->decalage = decalage;
+    tache->priorite = priorite;
+    tache->prochaine_activation = decalage;
+    tache->instance = 0;
+    tache->premiere = -1;
+    tache->derniere = -1;
+    tache->surveillee = -1;
+    tache->en_attente = 0;
+}
+
+// Fonction pour configurer le système à partir des paramètres d'un jeu
+// Les priorités RM/DM/OPA sont écrites dans parametres, qui reste associé au système
+// (le tableau des tâches doit pouvoir contenir nb_taches éléments).
+// Au-delà de HORIZON_MAX, l'hyperpériode vaut 0 et l'horizon -1 (non calculable).
+// Les durées des tâches (et des sections critiques, des tronçons et des
+// commutations de contexte) sont divisées par le PGCD de tous les paramètres :
+// des paramètres en nanosecondes multiples de la milliseconde sont simulés en
+// millisecondes, sans rien changer à l'ordonnancement.
+void configurer_systeme(Systeme *systeme, ParametresTache *parametres, int nb_taches) {
+    long long hyperperiode_jeu;
+    long long horizon = horizon_simulation(parametres, nb_taches);
+    temps_t echelle = 0;
+    
+    // Calculer les priorités pour RM, DM et OPA (sans ordre faisable, OPA
+    // garde l'ordre DM : le verdict sera négatif)
+    if (systeme->algorithme == RM) {
+        calculer_priorites_rm(parametres, nb_taches);
+    } else if (systeme->algorithme == DM) {
+        calculer_priorites_dm(parametres, nb_taches);
+    } else if (systeme->algorithme == OPA && !calculer_priorites_audsley(parametres, nb_taches)) {
+        calculer_priorites_dm(parametres, nb_taches);
+    }
+    
+    systeme->parametres = parametres;
+    systeme->nb_taches = nb_taches;
+    systeme->hyperperiode = hyperperiode(parametres, nb_taches, &hyperperiode_jeu) &&
+                            hyperperiode_jeu <= HORIZON_MAX ? hyperperiode_jeu : 0;
+    systeme->horizon = horizon < 0 || horizon > HORIZON_MAX ? -1 : horizon;
+    systeme->surcharge = facteur_utilisation(parametres, nb_taches) > 1.0 + 1e-12;
+    systeme->asynchrone = false;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        echelle = pgcd_temps(echelle, parametres[i].duree_execution);
+        echelle = pgcd_temps(echelle, parametres[i].echeance);
+        echelle = pgcd_temps(echelle, parametres[i].periode);
+        echelle = pgcd_temps(echelle, parametres[i].decalage);
+        systeme->asynchrone |= parametres[i].decalage > 0;
+    }
+    for (int s = 0; systeme->ressources != NULL && s < systeme->ressources->nb_sections; s++) {
+        echelle = pgcd_temps(echelle, systeme->ressources->sections[s].debut);
+        echelle = pgcd_temps(echelle, systeme->ressources->sections[s].duree);
+    }
+    if (systeme->preemption == PREEMPTION_POINTS) {
+        echelle = pgcd_temps(echelle, systeme->points);
+    }
+    echelle = pgcd_temps(echelle, systeme->commutation);
+    systeme->echelle = echelle > 0 ? echelle : 1;
+    for (int i = 0; i < nb_taches; i++) {
+        initialiser_tache(&systeme->taches[i], i + 1, parametres[i].duree_execution / systeme->echelle,
+                          parametres[i].echeance / systeme->echelle, parametres[i].periode / systeme->echelle,
+                          parametres[i].priorite, parametres[i].decalage / systeme->echelle);
+    }
+    
+    // Seuils de préemption par défaut égaux aux niveaux (préemption totale)
+    for (int i = 0; systeme->preemption == PREEMPTION_SEUILS && i < nb_taches; i++) {
+        systeme->taches[i].niveau = niveau_preemption(parametres, nb_taches, systeme->algorithme == EDF, i);
+        systeme->taches[i].seuil = systeme->taches[i].niveau;
+    }
+}
+
+// Fonction pour fixer le décalage de chaque tâche d'un système configuré puis
+// le reconfigurer (horizon, échelle) ; false si un décalage est hors limites
+bool appliquer_decalages(Systeme *systeme, const temps_t *decalages) {
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        if (decalages[i] < 0 || decalages[i] > TEMPS_PARAMETRE_MAX) {
+            return false;
+        }
+    }
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        systeme->parametres[i].decalage = decalages[i];
+    }
+    configurer_systeme(systeme, systeme->parametres, systeme->nb_taches);
+    return true;
+}
+
+// Fonction pour attribuer aux tâches d'un système configuré (PREEMPTION_SEUILS)
+// les seuils de calculer_seuils_preemption, coût des commutations compris.
+// Renvoie false (seuils = niveaux) si le jeu n'est pas ordonnançable même avec
+// la préemption totale, ou si la mémoire manque.
+bool attribuer_seuils(Systeme *systeme) {
+    int *seuils = malloc((systeme->nb_taches > 0 ? systeme->nb_taches : 1) * sizeof(int));
+    ParametresTache *parametres = parametres_avec_commutation(systeme->parametres, systeme->nb_taches,
+                                                              systeme->commutation);
+    bool faisable = false;
+    
+    if (seuils != NULL && parametres != NULL) {
+        faisable = calculer_seuils_preemption(parametres, systeme->nb_taches, systeme->algorithme == EDF, seuils);
+        for (int i = 0; i < systeme->nb_taches; i++) {
+            systeme->taches[i].seuil = seuils[i];
+        }
+    }
+    free(seuils);
+    free(parametres);
+    return faisable;
+}
+
+// Fonction pour rendre libres toutes les instances de la réserve et lui donner
+// au moins capacite instances
+static bool reserve_preparer(ReserveInstances *reserve, int capacite) {
+    if (capacite > reserve->capacite || reserve->instances == NULL) {
+        int nouvelle = capacite > 0 ? capacite : 1;
+        Instance *instances = realloc(reserve->instances, nouvelle * sizeof(Instance));
+        if (instances == NULL) {
+            return false;
+        }
+        reserve->instances = instances;
+        reserve->capacite = nouvelle;
+    }
+    for (int k = 0; k < reserve->capacite; k++) {
+        reserve->instances[k].suivante = k + 1 < reserve->capacite ? k + 1 : -1;
+    }
+    reserve->libre = 0;
+    return true;
+}
+
+// Fonction pour prendre une instance libre dans la réserve (-1 si mémoire insuffisante)
+// La réserve double lorsqu'elle est épuisée : le coût est amorti sur les activations.
+static int reserve_prendre(ReserveInstances *reserve) {
+    if (reserve->libre == -1) {
+        int nouvelle = 2 * reserve->capacite;
+        Instance *instances = realloc(reserve->instances, nouvelle * sizeof(Instance));
+        if (instances == NULL) {
+            return -1;
+        }
+        for (int k = reserve->capacite; k < nouvelle; k++) {
+            instances[k].suivante = k + 1 < nouvelle ? k + 1 : -1;
+        }
+        reserve->instances = instances;
+        reserve->libre = reserve->capacite;
+        reserve->capacite = nouvelle;
+    }
+    int k = reserve->libre;
+    reserve->libre = reserve->instances[k].suivante;
+    return k;
+}
+
+// Fonction pour rendre une instance à la réserve
+static inline void reserve_rendre(ReserveInstances *reserve, int k) {
+    reserve->instances[k].suivante = reserve->libre;
+    reserve->libre = k;
+}
+
+// Fonction pour préparer les files de la simulation
+// La mémoire des files et de la réserve est conservée d'une simulation à
+// l'autre ; la réserve commence avec une instance par tâche (D <= T sans retard).
+static bool initialiser_files(Systeme *systeme) {
+    if (!tas_preparer(&systeme->pret, systeme->nb_taches) ||
+        !tas_preparer(&systeme->activations, systeme->nb_taches) ||
+        !tas_preparer(&systeme->echeances, systeme->nb_taches) ||
+        !reserve_preparer(&systeme->reserve, systeme->nb_taches)) {
+        return false;
+    }
+    
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        Tache *tache = &systeme->taches[i];
+        tache->premiere = -1;
+        tache->derniere = -1;
+        tache->surveillee = -1;
+        tache->en_attente = 0;
+        tas_inserer(&systeme->activations, i, tache->prochaine_activation);
+    }
+    for (int r = 0; systeme->ressources != NULL && r < systeme->ressources->nb_ressources; r++) {
+        systeme->ressources->detenteur[r] = -1;
+    }
+    systeme->taille_etat = -1;
+    return true;
+}
+
+// Fonction pour libérer les files de la simulation
+void liberer_files(Systeme *systeme) {
+    tas_liberer(&systeme->pret);
+    tas_liberer(&systeme->activations);
+    tas_liberer(&systeme->echeances);
+    free(systeme->reserve.instances);
+    systeme->reserve.instances = NULL;
+    systeme->reserve.capacite = 0;
+    free(systeme->etat);
+    systeme->etat = NULL;
+    systeme->capacite_etat = 0;
+}
+
+// Fonction pour replacer une tâche dans la file des prêts selon sa première instance
+static inline __attribute__((always_inline))
+void actualiser_pret(Systeme *systeme, int i, CleFile cle) {
+    Tache *tache = &systeme->taches[i];
+    
+    if (tache->premiere == -1) {
+        if (tas_contient(&systeme->pret, i)) {
+            tas_retirer(&systeme->pret, i);
+        }
+    } else if (tas_contient(&systeme->pret, i)) {
+        tas_modifier(&systeme->pret, i, cle(tache, &systeme->reserve.instances[tache->premiere]));
+    } else {
+        tas_inserer(&systeme->pret, i, cle(tache, &systeme->reserve.instances[tache->premiere]));
+    }
+}
+
+// Fonction pour surveiller l'échéance suivante d'une tâche (instance surveillee retirée du tas)
+static void surveiller_suivante(Systeme *systeme, int i) {
+    Tache *tache = &systeme->taches[i];
+    
+    tache->surveillee = systeme->reserve.instances[tache->surveillee].suivante;
+    if (tache->surveillee != -1) {
+        tas_inserer(&systeme->echeances, i, systeme->reserve.instances[tache->surveillee].echeance_absolue);
+    }
+}
+
+// Fonction pour retirer la première instance en attente d'une tâche (terminée
+// ou abandonnée) et la rendre à la réserve
+static inline __attribute__((always_inline))
+void retirer_premiere(Systeme *systeme, int i, CleFile cle) {
+    Tache *tache = &systeme->taches[i];
+    int k = tache->premiere;
+    
+    if (tache->surveillee == k) {
+        tas_retirer(&systeme->echeances, i);
+        surveiller_suivante(systeme, i);
+    }
+    tache->premiere = systeme->reserve.instances[k].suivante;
+    if (tache->premiere == -1) {
+        tache->derniere = -1;
+    }
+    tache->en_attente--;
+    reserve_rendre(&systeme->reserve, k);
+    actualiser_pret(systeme, i, cle);
+}
+
+// Fonction pour libérer les ressources détenues par la tâche i (instance abandonnée)
+static void liberer_ressources(Systeme *systeme, int i, temps_t temps) {
+    JeuRessources *ressources = systeme->ressources;
+    
+    for (int r = 0; r < ressources->nb_ressources; r++) {
+        if (ressources->detenteur[r] == i) {
+            ressources->detenteur[r] = -1;
+            trace_evenement(systeme->trace, EVT_LIBERATION, temps * systeme->echelle, i,
+                            systeme->reserve.instances[systeme->taches[i].premiere].numero, r);
+        }
+    }
+}
+
+// Fonction pour vérifier les échéances atteintes à un instant donné
+// L'instance surveillée d'une tâche n'est pas terminée : son échéance est
+// manquée, la politique d'échec décide de son sort.
+static inline __attribute__((always_inline))
+bool verifier_echeances(Systeme *systeme, temps_t temps_actuel, CleFile cle) {
+    bool aucune_echeance_manquee = true;
+    temps_t echelle = systeme->echelle;
+    
+    while (!tas_vide(&systeme->echeances) && tas_cle_sommet(&systeme->echeances) <= temps_actuel) {
+        int i = tas_extraire(&systeme->echeances);
+        Tache *tache = &systeme->taches[i];
+        Instance *instance = &systeme->reserve.instances[tache->surveillee];
+        
+        trace_evenement(systeme->trace, EVT_ECHEANCE_MANQUEE, temps_actuel * echelle, i,
+                        instance->numero, instance->temps_restant * echelle);
+        metriques_echeance_manquee(systeme->metriques, i);
+        aucune_echeance_manquee = false;
+        
+        surveiller_suivante(systeme, i);
+        
+        // Les instances plus anciennes ont été abandonnées : c'est la première
+        if (systeme->politique_echec == ECHEC_ABANDONNER) {
+            trace_evenement(systeme->trace, EVT_ABANDON, temps_actuel * echelle, i,
+                            instance->numero, instance->temps_restant * echelle);
+            metriques_abandon(systeme->metriques, i);
+            if (systeme->ressources != NULL) {
+                liberer_ressources(systeme, i, temps_actuel);
+            }
+            retirer_premiere(systeme, i, cle);
+        }
+    }
+    
+    return aucune_echeance_manquee;
+}
+
+// Fonction pour activer les tâches à un instant donné
+// Chaque activation ajoute une instance à la suite de celles en attente ;
+// renvoie false si la réserve d'instances ne peut pas grandir.
+static inline __attribute__((always_inline))
+bool activer_taches(Systeme *systeme, temps_t temps_actuel, CleFile cle) {
+    temps_t echelle = systeme->echelle;
+    
+    while (!tas_vide(&systeme->activations) && tas_cle_sommet(&systeme->activations) == temps_actuel) {
+        int i = tas_sommet(&systeme->activations);
+        Tache *tache = &systeme->taches[i];
+        
+        tache->instance++;
+        tache->prochaine_activation += tache->periode;
+        tas_modifier(&systeme->activations, i, tache->prochaine_activation);
+        
+        // Politique de saut : pas de nouvelle instance tant que la première est en retard
+        if (systeme->politique_echec == ECHEC_SAUTER && tache->premiere != -1 &&
+            systeme->reserve.instances[tache->premiere].echeance_absolue <= temps_actuel) {
+            trace_evenement(systeme->trace, EVT_ABANDON, temps_actuel * echelle, i, tache->instance, -1);
+            metriques_abandon(systeme->metriques, i);
+            continue;
+        }
+        trace_evenement(systeme->trace, EVT_ACTIVATION, temps_actuel * echelle, i,
+                        tache->instance, tache->echeance * echelle);
+        if (tache->duree_execution == 0) {
+            continue;
+        }
+        
+        int k = reserve_prendre(&systeme->reserve);
+        if (k == -1) {
+            return false;
+        }
+        Instance *instance = &systeme->reserve.instances[k];
+        instance->activation = temps_actuel;
+        instance->echeance_absolue = temps_actuel + tache->echeance;
+        instance->temps_restant = tache->duree_execution;
+        instance->numero = tache->instance;
+        instance->debut = -1;
+        instance->preemptions = 0;
+        instance->section = systeme->ressources != NULL ? systeme->ressources->premiere_section[i] : 0;
+        instance->blocage = 0;
+        instance->bloquante = -1;
+        instance->commutation = 0;
+        instance->suivante = -1;
+        
+        if (tache->derniere != -1) {
+            systeme->reserve.instances[tache->derniere].suivante = k;
+        }
+        tache->derniere = k;
+        tache->en_attente++;
+        if (tache->surveillee == -1) {
+            tache->surveillee = k;
+            tas_inserer(&systeme->echeances, i, instance->echeance_absolue);
+        }
+        if (tache->premiere == -1) {
+            tache->premiere = k;
+            actualiser_pret(systeme, i, cle);
+        }
+    }
+    
+    return true;
+}
+
+// Fonction pour trouver la date du prochain événement (activation ou échéance)
+static temps_t prochain_evenement(Systeme *systeme, temps_t horizon) {
+    temps_t prochain = horizon;
+    
+    if (!tas_vide(&systeme->activations) && tas_cle_sommet(&systeme->activations) < prochain) {
+        prochain = tas_cle_sommet(&systeme->activations);
+    }
+    if (!tas_vide(&systeme->echeances) && tas_cle_sommet(&systeme->echeances) < prochain) {
+        prochain = tas_cle_sommet(&systeme->echeances);
+    }
+    
+    return prochain;
+}
+
+// Fonction pour savoir si une instance donnée est toujours la première en attente de sa tâche
+static inline bool instance_en_cours(const Systeme *systeme, int i, int numero) {
+    const Tache *tache = &systeme->taches[i];
+    return tache->premiere != -1 && systeme->reserve.instances[tache->premiere].numero == numero;
+}
+
+// Fonction pour trouver la ressource de plus haut plafond détenue par une autre
+// tâche que i (-1 : aucune), qui fixe le plafond du système vu de i
+static int ressource_plafond(const JeuRessources *ressources, int i) {
+    int plus_haute = -1;
+    
+    for (int r = 0; r < ressources->nb_ressources; r++) {
+        if (ressources->detenteur[r] != -1 && ressources->detenteur[r] != i &&
+            (plus_haute == -1 || ressources->plafond[r] > ressources->plafond[plus_haute])) {
+            plus_haute = r;
+        }
+    }
+    return plus_haute;
+}
+
+// Fonction pour trouver la tâche qui empêche la première instance de la tâche i
+// de s'exécuter (-1 : aucune), selon le protocole :
+// - ressource demandée détenue par une autre tâche (tous les protocoles) ;
+// - PCP : verrouillage sans niveau supérieur au plafond du système ;
+// - SRP : démarrage sans niveau supérieur au plafond du système.
+static int tache_bloquante(const Systeme *systeme, int i) {
+    const JeuRessources *ressources = systeme->ressources;
+    const Tache *tache = &systeme->taches[i];
+    const Instance *instance = &systeme->reserve.instances[tache->premiere];
+    int s = instance->section;
+    
+    if (ressources->protocole == PROTOCOLE_SRP && instance->debut < 0) {
+        int r = ressource_plafond(ressources, i);
+        return r != -1 && ressources->plafond[r] >= ressources->niveau[i] ? ressources->detenteur[r] : -1;
+    }
+    if (s == ressources->premiere_section[i + 1] ||
+        tache->duree_execution - instance->temps_restant != ressources->sections[s].debut / systeme->echelle) {
+        return -1;
+    }
+    int r = ressources->sections[s].ressource;
+    if (ressources->detenteur[r] != -1 && ressources->detenteur[r] != i) {
+        return ressources->detenteur[r];
+    }
+    if (ressources->protocole == PROTOCOLE_PCP && ressources->detenteur[r] == -1) {
+        int plafond = ressource_plafond(ressources, i);
+        if (plafond != -1 && ressources->plafond[plafond] >= ressources->niveau[i]) {
+            return ressources->detenteur[plafond];
+        }
+    }
+    return -1;
+}
+
+// Fonction pour élire la tâche à exécuter lorsque les tâches partagent des
+// ressources (parcours des tâches en attente au lieu du sommet de la file)
+// Une instance bloquée ne s'exécute pas ; avec héritage (PIP, PCP), la tâche
+// qui la bloque s'exécute à sa place avec sa clé.
+static inline __attribute__((always_inline))
+int elire_avec_ressources(Systeme *systeme, CleFile cle) {
+    bool heritage = systeme->ressources->protocole == PROTOCOLE_PIP ||
+                    systeme->ressources->protocole == PROTOCOLE_PCP;
+    int elue = -1;
+    int rang_elue = 0;
+    long long cle_elue = 0;
+    
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        const Tache *tache = &systeme->taches[i];
+        if (tache->premiere == -1) {
+            continue;
+        }
+        long long cle_i = cle(tache, &systeme->reserve.instances[tache->premiere]);
+        int candidate = tache_bloquante(systeme, i);
+        if (candidate == -1) {
+            candidate = i;
+        } else if (!heritage) {
+            continue;
+        }
+        if (elue == -1 || cle_i < cle_elue || (cle_i == cle_elue && i < rang_elue)) {
+            elue = candidate;
+            cle_elue = cle_i;
+            rang_elue = i;
+        }
+    }
+    return elue;
+}
+
+// Fonction pour faire entrer l'instance élue dans sa section critique si elle
+// y arrive, puis borner la fin de son exécution à la prochaine entrée ou sortie
+// de section (ce sont des événements de l'ordonnancement)
+static temps_t entrer_section(Systeme *systeme, int i, temps_t temps, temps_t fin) {
+    JeuRessources *ressources = systeme->ressources;
+    const Tache *tache = &systeme->taches[i];
+    const Instance *instance = &systeme->reserve.instances[tache->premiere];
+    temps_t echelle = systeme->echelle;
+    int s = instance->section;
+    
+    if (s == ressources->premiere_section[i + 1]) {
+        return fin;
+    }
+    const SectionCritique *section = &ressources->sections[s];
+    temps_t avancement = tache->duree_execution - instance->temps_restant;
+    temps_t limite = section->debut / echelle;
+    
+    if (avancement == limite && ressources->detenteur[section->ressource] == -1) {
+        ressources->detenteur[section->ressource] = i;
+        trace_evenement(systeme->trace, EVT_VERROUILLAGE, temps * echelle, i, instance->numero, section->ressource);
+    }
+    if (ressources->detenteur[section->ressource] == i) {
+        limite += section->duree / echelle;
+    }
+    return temps + limite - avancement < fin ? temps + limite - avancement : fin;
+}
+
+// Fonction pour faire sortir l'instance élue de sa section critique à sa fin
+static void sortir_section(Systeme *systeme, int i, temps_t temps) {
+    JeuRessources *ressources = systeme->ressources;
+    const Tache *tache = &systeme->taches[i];
+    Instance *instance = &systeme->reserve.instances[tache->premiere];
+    int s = instance->section;
+    
+    if (s == ressources->premiere_section[i + 1] || ressources->detenteur[ressources->sections[s].ressource] != i) {
+        return;
+    }
+    const SectionCritique *section = &ressources->sections[s];
+    if (tache->duree_execution - instance->temps_restant == (section->debut + section->duree) / systeme->echelle) {
+        ressources->detenteur[section->ressource] = -1;
+        instance->section++;
+        trace_evenement(systeme->trace, EVT_LIBERATION, temps * systeme->echelle, i, instance->numero,
+                        section->ressource);
+    }
+}
+
+// Fonction pour comptabiliser les blocages pendant que la tâche élue s'exécute
+// de temps à fin : toute instance en attente dont la clé passe avant celle de
+// l'élue subit une inversion de priorité. Une inversion commence lorsque la
+// tâche qui s'exécute à sa place change.
+static inline __attribute__((always_inline))
+void comptabiliser_blocages(Systeme *systeme, int elue, temps_t temps, temps_t fin, CleFile cle) {
+    const Tache *tache_elue = &systeme->taches[elue];
+    long long cle_elue = cle(tache_elue, &systeme->reserve.instances[tache_elue->premiere]);
+    temps_t echelle = systeme->echelle;
+    
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        const Tache *tache = &systeme->taches[i];
+        if (tache->premiere == -1) {
+            continue;
+        }
+        Instance *instance = &systeme->reserve.instances[tache->premiere];
+        long long cle_i = cle(tache, instance);
+        if (i == elue || cle_i > cle_elue || (cle_i == cle_elue && i > elue)) {
+            instance->bloquante = -1;
+            continue;
+        }
+        if (instance->bloquante != elue) {
+            instance->bloquante = elue;
+            trace_evenement(systeme->trace, EVT_INVERSION, temps * echelle, i, instance->numero, elue);
+            metriques_inversion(systeme->metriques, i);
+        }
+        instance->blocage += fin - temps;
+        trace_evenement(systeme->trace, EVT_BLOCAGE, temps * echelle, i, instance->numero, (fin - temps) * echelle);
+    }
+}
+
+// Fonction pour savoir si l'instance en cours de la tâche i peut être
+// interrompue (politique préemptive) : jamais pendant une commutation de
+// contexte ni sans préemption, et seulement à la fin d'un tronçon avec des
+// points de préemption (les seuils sont appliqués à l'élection)
+static inline bool interruption_permise(const Systeme *systeme, int i) {
+    const Tache *tache = &systeme->taches[i];
+    const Instance *instance = &systeme->reserve.instances[tache->premiere];
+    
+    switch (systeme->preemption) {
+        case PREEMPTION_AUCUNE:
+            return false;
+        case PREEMPTION_POINTS:
+            return instance->commutation == 0 &&
+                   (tache->duree_execution - instance->temps_restant) % (systeme->points / systeme->echelle) == 0;
+        default:
+            return instance->commutation == 0;
+    }
+}
+
+// Fonction pour élire la tâche à exécuter avec des seuils de préemption : une
+// instance n'est éligible que si son niveau dépasse le seuil de toutes les
+// instances commencées des autres tâches. La dernière instance préemptée
+// reprend donc avant les tâches que son seuil exclut.
+static inline __attribute__((always_inline))
+int elire_avec_seuils(Systeme *systeme, CleFile cle) {
+    int seuil_max = -1;
+    int seuil_second = -1;
+    int tache_max = -1;
+    int elue = -1;
+    long long cle_elue = 0;
+    
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        const Tache *tache = &systeme->taches[i];
+        if (tache->premiere == -1 || systeme->reserve.instances[tache->premiere].debut < 0) {
+            continue;
+        }
+        if (tache->seuil > seuil_max) {
+            seuil_second = seuil_max;
+            seuil_max = tache->seuil;
+            tache_max = i;
+        } else if (tache->seuil > seuil_second) {
+            seuil_second = tache->seuil;
+        }
+    }
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        const Tache *tache = &systeme->taches[i];
+        if (tache->premiere == -1 || tache->niveau <= (i == tache_max ? seuil_second : seuil_max)) {
+            continue;
+        }
+        long long cle_i = cle(tache, &systeme->reserve.instances[tache->premiere]);
+        if (elue == -1 || cle_i < cle_elue) {
+            elue = i;
+            cle_elue = cle_i;
+        }
+    }
+    return elue != -1 ? elue : tache_max;
+}
+
+// Fonction pour payer la commutation de contexte de l'instance élue de temps
+// à fin au plus ; renvoie la fin du segment de commutation
+static temps_t commuter(Systeme *systeme, int i, temps_t temps, temps_t fin) {
+    Instance *instance = &systeme->reserve.instances[systeme->taches[i].premiere];
+    temps_t echelle = systeme->echelle;
+    
+    if (temps + instance->commutation < fin) {
+        fin = temps + instance->commutation;
+    }
+    instance->commutation -= fin - temps;
+    trace_evenement(systeme->trace, EVT_COMMUTATION, temps * echelle, i, instance->numero, (fin - temps) * echelle);
+    if (instance->debut < 0) {
+        instance->debut = temps;
+        metriques_demarrage(systeme->metriques, i, (temps - instance->activation) * echelle);
+    }
+    metriques_commutation(systeme->metriques, i, (fin - temps) * echelle);
+    return fin;
+}
+
+// Fonction pour comparer l'état du système à celui mémorisé une hyperpériode
+// plus tôt, puis le mémoriser. Les activations se répétant à l'identique d'une
+// hyperpériode à l'autre, deux états égaux impliquent que l'ordonnancement
+// est désormais périodique : la suite n'apporte plus rien.
+// L'état est la tâche dont l'instance est en cours (en_cours, -1 : aucune),
+// puis, pour chaque tâche, le délai avant sa prochaine activation et, pour
+// chaque instance en attente, son temps restant, son activation et son
+// échéance relatives à l'instant courant et sa commutation restante.
+static bool etat_repete(Systeme *systeme, temps_t temps, int en_cours) {
+    int taille = 1;
+    
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        taille += 2 + 4 * systeme->taches[i].en_attente;
+    }
+    if (taille > systeme->capacite_etat) {
+        temps_t *etat = realloc(systeme->etat, taille * sizeof(temps_t));
+        if (etat == NULL) {
+            systeme->taille_etat = -1;
+            return false;
+        }
+        systeme->etat = etat;
+        systeme->capacite_etat = taille;
+    }
+    
+    bool identique = taille == systeme->taille_etat && systeme->etat[0] == en_cours;
+    temps_t *etat = systeme->etat;
+    int n = 1;
+    etat[0] = en_cours;
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        const Tache *tache = &systeme->taches[i];
+        temps_t valeurs[4] = { tache->prochaine_activation - temps, tache->en_attente, 0, 0 };
+        
+        for (int v = 0; v < 2; v++, n++) {
+            identique = identique && etat[n] == valeurs[v];
+            etat[n] = valeurs[v];
+        }
+        for (int k = tache->premiere; k != -1; k = systeme->reserve.instances[k].suivante) {
+            const Instance *instance = &systeme->reserve.instances[k];
+            valeurs[0] = instance->temps_restant;
+            valeurs[1] = instance->activation - temps;
+            valeurs[2] = instance->echeance_absolue - temps;
+            valeurs[3] = instance->commutation;
+            for (int v = 0; v < 4; v++, n++) {
+                identique = identique && etat[n] == valeurs[v];
+                etat[n] = valeurs[v];
+            }
+        }
+    }
+    systeme->taille_etat = taille;
+    return identique;
+}
+
+// Fonction pour savoir si la première période d'activité synchrone est le pire
+// cas : politique préemptive, activations synchrones, tâches indépendantes,
+// préemption totale et commutations gratuites
+static inline bool periode_activite_suffit(const Systeme *systeme, bool preemptif) {
+    return preemptif && !systeme->asynchrone && systeme->ressources == NULL &&
+           systeme->preemption == PREEMPTION_TOTALE && systeme->commutation == 0;
+}
+
+// Moteur de simulation commun à toutes les politiques
+// Il n'est jamais appelé directement : chaque politique en obtient une copie
+// spécialisée (DEFINIR_POLITIQUE) où la clé est intégrée, sans appel indirect.
+// Les files du système (initialisé à zéro) sont réutilisées d'un appel à l'autre.
+// La simulation est dirigée par les événements : entre deux événements
+// (activation, terminaison, échéance) la tâche élue ne change pas, le temps
+// avance donc directement jusqu'au prochain d'entre eux.
+// La durée est dans l'unité des paramètres, comme les dates et durées de la
+// trace et des métriques ; seule la boucle avance en ticks de systeme->echelle.
+// Une durée nulle simule l'horizon du système. À chaque multiple de
+// l'hyperpériode, la simulation s'arrête si l'état s'est répété.
+// Une échéance manquée est traitée selon la politique d'échec du système.
+// En mode verdict seul, elle s'arrête aussi à la première échéance manquée et,
+// pour une politique préemptive, à la fin de la première période d'activité :
+// si les activations sont synchrones, c'est le pire cas.
+// L'horizon du système ne suffit que si U <= 1 : au-delà, les instances en
+// attente s'accumulent (D > T) et une échéance finit par être manquée.
+// Si l'horizon n'est pas calculable (hyperpériode hors capacité), seule la
+// première période d'activité synchrone, lorsqu'elle est le pire cas, est
+// simulée ; sinon rien n'est simulé : le verdict est négatif si U > 1, et
+// systeme->non_conclu est levé dans les autres cas.
+static inline __attribute__((always_inline))
+bool simuler_politique(Systeme *systeme, temps_t duree_simulation, CleFile cle, const bool preemptif) {
+    temps_t temps = 0;
+    bool simulation_reussie = true;
+    int tache_precedente = -1;
+    int instance_precedente = 0;
+    temps_t echelle = systeme->echelle;
+    
+    systeme->non_conclu = false;
+    if (duree_simulation <= 0) {
+        duree_simulation = systeme->horizon;
+    }
+    if (duree_simulation < 0 && !systeme->surcharge && periode_activite_suffit(systeme, preemptif)) {
+        duree_simulation = periode_activite_synchrone(systeme->parametres, systeme->nb_taches, HORIZON_MAX);
+    }
+    if (duree_simulation < 0) {
+        systeme->non_conclu = !systeme->surcharge;
+        trace_evenement(systeme->trace, EVT_FIN, temps, -1, 0, FIN_NON_CONCLU);
+        return false;
+    }
+    // Durée et hyperpériode en ticks (l'hyperpériode est multiple de l'échelle) ;
+    // l'état mémorisé ne décrit pas les sections critiques : pas de détection
+    // de cycle lorsque des ressources sont partagées
+    temps_t fin_simulation = (duree_simulation + echelle - 1) / echelle;
+    temps_t hyperperiode = systeme->ressources == NULL ? systeme->hyperperiode / echelle : 0;
+    temps_t controle = hyperperiode > 0 && hyperperiode < fin_simulation ? hyperperiode : fin_simulation;
+    
+    if (!initialiser_files(systeme)) {
+        trace_evenement(systeme->trace, EVT_FIN, temps, -1, 0, FIN_MEMOIRE);
+        return false;
+    }
+    if (hyperperiode > 0) {
+        etat_repete(systeme, temps, -1);
+    }
+    
+    while (temps < fin_simulation) {
+        // Contrôle de cycle (avant de traiter les événements de cet instant)
+        if (temps == controle && hyperperiode > 0) {
+            int en_cours = tache_precedente != -1 && instance_en_cours(systeme, tache_precedente, instance_precedente) ?
+                           tache_precedente : -1;
+            if (etat_repete(systeme, temps, en_cours)) {
+                trace_evenement(systeme->trace, EVT_FIN, temps * echelle, -1, 0, FIN_CYCLE);
+                return simulation_reussie;
+            }
+            controle = fin_simulation - temps > hyperperiode ? temps + hyperperiode : fin_simulation;
+        }
+        
+        // Étape 1: Vérifier les échéances puis activer les nouvelles instances
+        bool echeances_respectees = verifier_echeances(systeme, temps, cle);
+        if (!activer_taches(systeme, temps, cle)) {
+            trace_evenement(systeme->trace, EVT_FIN, temps * echelle, -1, 0, FIN_MEMOIRE);
+            return false;
+        }
+        if (!echeances_respectees) {
+            simulation_reussie = false;
+            if (systeme->verdict_seul) {
+                trace_evenement(systeme->trace, EVT_FIN, temps * echelle, -1, 0, FIN_ECHEC);
+                return false;
+            }
+        }
+        
+        // Étape 2: Élire la tâche de plus petite clé (non bloquée, si des
+        // ressources sont partagées ; au-dessus des seuils des instances
+        // commencées, avec des seuils de préemption) ; l'instance en cours
+        // garde le processeur si elle ne peut pas être interrompue
+        int tache_courante = preemptif && systeme->preemption == PREEMPTION_SEUILS ?
+                             elire_avec_seuils(systeme, cle) :
+                             systeme->ressources == NULL ? tas_sommet(&systeme->pret) :
+                             elire_avec_ressources(systeme, cle);
+        bool precedente_en_cours = tache_precedente != -1 &&
+                                   instance_en_cours(systeme, tache_precedente, instance_precedente);
+        if (precedente_en_cours && (!preemptif || !interruption_permise(systeme, tache_precedente))) {
+            tache_courante = tache_precedente;
+        }
+        
+        // Préemption : l'instance précédente n'est pas terminée
+        if (precedente_en_cours && tache_courante != tache_precedente && tache_courante != -1) {
+            trace_evenement(systeme->trace, EVT_PREEMPTION, temps * echelle, tache_precedente,
+                            instance_precedente, tache_courante);
+            metriques_preemption(systeme->metriques, tache_precedente);
+            systeme->reserve.instances[systeme->taches[tache_precedente].premiere].preemptions++;
+        }
+        
+        // Étape 3: Exécuter la première instance de la tâche élue jusqu'à sa
+        // terminaison ou au prochain événement
+        temps_t fin = prochain_evenement(systeme, controle);
+        
+        // Commutation de contexte : l'instance élue n'est pas celle qui vient
+        // de s'exécuter (démarrage, reprise après une préemption ou une inactivité)
+        if (tache_courante != -1 && systeme->commutation > 0 &&
+            (tache_courante != tache_precedente || !precedente_en_cours)) {
+            systeme->reserve.instances[systeme->taches[tache_courante].premiere].commutation =
+                systeme->commutation / echelle;
+        }
+        
+        if (tache_courante != -1 &&
+            systeme->reserve.instances[systeme->taches[tache_courante].premiere].commutation > 0) {
+            fin = commuter(systeme, tache_courante, temps, fin);
+            instance_precedente = systeme->reserve.instances[systeme->taches[tache_courante].premiere].numero;
+        } else if (tache_courante != -1) {
+            Instance *instance = &systeme->reserve.instances[systeme->taches[tache_courante].premiere];
+            if (temps + instance->temps_restant < fin) {
+                fin = temps + instance->temps_restant;
+            }
+            if (preemptif && systeme->preemption == PREEMPTION_POINTS) {
+                // Prochain point de préemption : fin du tronçon en cours
+                temps_t troncon = systeme->points / echelle;
+                temps_t point = temps + troncon -
+                                (systeme->taches[tache_courante].duree_execution - instance->temps_restant) % troncon;
+                if (point < fin) {
+                    fin = point;
+                }
+            }
+            if (systeme->ressources != NULL) {
+                fin = entrer_section(systeme, tache_courante, temps, fin);
+                comptabiliser_blocages(systeme, tache_courante, temps, fin, cle);
+            }
+            instance->temps_restant -= fin - temps;
+            trace_evenement(systeme->trace, EVT_EXECUTION, temps * echelle, tache_courante,
+                            instance->numero, (fin - temps) * echelle);
+            if (instance->debut < 0) {
+                instance->debut = temps;
+                metriques_demarrage(systeme->metriques, tache_courante,
+                                    (temps - instance->activation) * echelle);
+            }
+            metriques_execution(systeme->metriques, tache_courante, (fin - temps) * echelle);
+            instance_precedente = instance->numero;
+            if (systeme->ressources != NULL) {
+                sortir_section(systeme, tache_courante, fin);
+            }
+            
+            if (instance->temps_restant == 0) {
+                trace_evenement(systeme->trace, EVT_TERMINAISON, fin * echelle, tache_courante,
+                                instance->numero, 0);
+                metriques_terminaison(systeme->metriques, tache_courante, (fin - instance->activation) * echelle,
+                                      (fin - instance->echeance_absolue) * echelle, instance->preemptions,
+                                      instance->blocage * echelle);
+                retirer_premiere(systeme, tache_courante, cle);
+            }
+        } else {
+            trace_evenement(systeme->trace, EVT_INACTIF, temps * echelle, -1, 0, (fin - temps) * echelle);
+            metriques_inactif(systeme->metriques, (fin - temps) * echelle);
+        }
+        
+        tache_precedente = tache_courante;
+        temps = fin;
+        
+        // Étape 4: Fin de la première période d'activité (toutes les instances
+        // terminées) ; avec des décalages, des ressources partagées, une
+        // préemption limitée ou des commutations payantes, cette période n'est
+        // plus le pire cas et la simulation continue
+        if (systeme->verdict_seul && periode_activite_suffit(systeme, preemptif) && tas_vide(&systeme->pret)) {
+            trace_evenement(systeme->trace, EVT_FIN, temps * echelle, -1, 0, FIN_TERMINEE);
+            return true;
+        }
+    }
+    
+    trace_evenement(systeme->trace, EVT_FIN, duree_simulation, -1, 0, FIN_HORIZON);
+    return simulation_reussie && !(systeme->surcharge && duree_simulation >= systeme->horizon);
+}
+
+// Une politique est une fonction de clé et un indicateur de préemption ;
+// DEFINIR_POLITIQUE en instancie la simulation spécialisée simuler_<nom>.
+// La clé d'une tâche ne dépend que de son instance en tête et n'est recalculée
+// que lorsque celle-ci change : une politique à clé statique par instance
+// (priorité, échéance, date d'activation...) s'ajoute en écrivant sa clé et une
+// ligne ici. Une clé qui évolue avec le temps (laxité de LLF) ne peut pas
+// s'exprimer ainsi.
+#define DEFINIR_POLITIQUE(nom, fonction_cle, preemptif)                          \
+    bool simuler_##nom(Systeme *systeme, temps_t duree_simulation) {              \
+        return simuler_politique(systeme, duree_simulation, fonction_cle, preemptif); \
+    }
+
+// Priorités fixes (HPF, RM, DM) : priorité décroissante
+static inline long long cle_priorites_fixes(const Tache *tache, const Instance *instance) {
+    (void)instance;
+    return -(long long)tache->priorite;
+}
+
+// EDF : échéance absolue la plus proche
+static inline long long cle_edf(const Tache *tache, const Instance *instance) {
+    (void)tache;
+    return instance->echeance_absolue;
+}
+
+// FIFO : ordre d'activation, puis indice
+static inline long long cle_fifo(const Tache *tache, const Instance *instance) {
+    (void)tache;
+    return instance->activation;
+}
+
+DEFINIR_POLITIQUE(priorites_fixes, cle_priorites_fixes, true)
+DEFINIR_POLITIQUE(edf, cle_edf, true)
+DEFINIR_POLITIQUE(fifo, cle_fifo, false)
+
+// Fonction principale de simulation adaptée à tous les algorithmes
+// Le choix de la politique est fait une fois, hors de la boucle de simulation.
+bool simuler_ordonnancement(Systeme *systeme, temps_t duree_simulation) {
+    switch (systeme->algorithme) {
+        case EDF:  return simuler_edf(systeme, duree_simulation);
+        case FIFO: return simuler_fifo(systeme, duree_simulation);
+        default:   return simuler_priorites_fixes(systeme, duree_simulation);
+    }
+}
+
+// Fonction pour obtenir le nom de l'algorithme
+const char* nom_algorithme(TypeOrdonnanceur algo) {
+    switch (algo) {
+        case HPF:  return "HPF (Highest Priority First)";
+        case RM:   return "RM (Rate Monotonic)";
+        case DM:   return "DM (Deadline Monotonic)";
+        case OPA:  return "OPA (Audsley)";
+        case EDF:  return "EDF (Earliest Deadline First)";
+        case FIFO: return "FIFO (First In First Out)";
+        default:   return "Inconnu";
+    }
+}
+
+// Fonction pour obtenir le nom court d'un algorithme (sorties du mode lot)
+const char* nom_court_algorithme(TypeOrdonnanceur algo) {
+    switch (algo) {
+        case HPF:  return "HPF";
+        case RM:   return "RM";
+        case DM:   return "DM";
+        case OPA:  return "OPA";
+        case EDF:  return "EDF";
+        case FIFO: return "FIFO";
+        default:   return "?";
+    }
+}
+
+
+// Fonction pour obtenir le nom d'une politique d'échec (options et affichages)
+const char* nom_politique_echec(PolitiqueEchec politique) {
+    switch (politique) {
+        case ECHEC_CONTINUER:  return "continuer";
+        case ECHEC_ABANDONNER: return "abandonner";
+        case ECHEC_SAUTER:     return "sauter";
+        default:               return "?";
+    }
+}
+
+// Fonction pour lire une politique d'échec à partir de son nom (false si inconnu)
+bool lire_politique_echec(const char *nom, PolitiqueEchec *politique) {
+    for (int p = 0; p < NB_POLITIQUES_ECHEC; p++) {
+        if (strcmp(nom, nom_politique_echec((PolitiqueEchec)p)) == 0) {
+            *politique = (PolitiqueEchec)p;
+            return true;
+        }
+    }
+    return false;
+}
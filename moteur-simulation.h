@@ -0,0 +1,142 @@
+#ifndef MOTEUR_SIMULATION_H
+#define MOTEUR_SIMULATION_H
+
+#include <stdbool.h>
+#include <limits.h>
+#include "tache.h"
+#include "tas.h"
+#include "trace.h"
+#include "metriques.h"
+#include "ressources.h"
+#include "preemption.h"
+
+// Énumération pour les types d'algorithmes d'ordonnancement
+typedef enum {
+    HPF,  // Highest Priority First
+    RM,   // Rate Monotonic
+    DM,   // Deadline Monotonic
+    OPA,  // Affectation optimale des priorités (Audsley)
+    EDF,  // Earliest Deadline First
+    FIFO, // First In First Out (non préemptif)
+    NB_ORDONNANCEURS
+} TypeOrdonnanceur;
+
+// Politique appliquée à une instance qui manque son échéance (la simulation
+// continue ; en mode verdict seul elle s'arrête à la première échéance manquée)
+typedef enum {
+    ECHEC_CONTINUER,          // L'instance en retard termine, les suivantes attendent derrière elle
+    ECHEC_ABANDONNER,         // L'instance est abandonnée à son échéance
+    ECHEC_SAUTER,             // L'instance termine, les activations survenant pendant son retard sont sautées
+    NB_POLITIQUES_ECHEC
+} PolitiqueEchec;
+
+// Instance (job) d'une tâche : une tâche peut avoir plusieurs instances en
+// attente (échéance supérieure à la période, retard), exécutées dans l'ordre
+// de leur activation
+typedef struct {
+    temps_t activation;       // Date d'activation
+    temps_t echeance_absolue; // Échéance absolue
+    temps_t temps_restant;    // Temps d'exécution restant
+    int numero;               // Numéro de l'instance (à partir de 1)
+    temps_t debut;            // Première exécution (-1 : pas encore élue)
+    int preemptions;          // Préemptions subies
+    int section;              // Section critique en cours ou suivante (ressources partagées)
+    temps_t blocage;          // Temps passé à attendre une tâche moins prioritaire
+    int bloquante;            // Tâche moins prioritaire en cours d'exécution (-1 : aucune)
+    temps_t commutation;      // Commutation de contexte restant à payer avant d'exécuter l'instance
+    int suivante;             // Instance suivante de la tâche, ou instance libre suivante (-1 : aucune)
+} Instance;
+
+// Réserve d'instances : les instances terminées sont chaînées dans une liste
+// libre et réutilisées, le tableau ne grandit (par doublement) que si plus
+// d'instances sont en attente simultanément qu'auparavant. Une simulation,
+// aussi longue soit-elle, ne fait donc aucune allocation par activation.
+// Les instances sont désignées par leur indice (le tableau peut être déplacé).
+typedef struct {
+    Instance *instances;
+    int capacite;
+    int libre;                // Première instance libre (-1 : aucune)
+} ReserveInstances;
+
+// Structure pour représenter une tâche temps réel
+// (paramètres et dates en ticks de simulation, voir echelle du système)
+typedef struct {
+    int id;                    // Identifiant de la tâche
+    temps_t duree_execution;  // Durée d'exécution (C)
+    temps_t echeance;         // Échéance relative (D)
+    temps_t periode;          // Période (T)
+    temps_t decalage;         // Date de la première activation (O)
+    int priorite;             // Priorité (plus grand = haute priorité)
+    int niveau;               // Niveau de préemption (PREEMPTION_SEUILS : rang de priorité, ou d'échéance en EDF)
+    int seuil;                // Seuil de préemption : seules les tâches de niveau supérieur interrompent
+                              // une instance commencée (PREEMPTION_SEUILS)
+    
+    // Variables pour la simulation
+    temps_t prochaine_activation; // Prochaine activation de la tâche
+    int instance;             // Numéro de la dernière instance activée
+    int premiere;             // Plus ancienne instance en attente, seule exécutable (-1 : aucune)
+    int derniere;             // Plus récente instance en attente (-1 : aucune)
+    int surveillee;           // Première instance dont l'échéance n'est pas passée (-1 : aucune)
+    int en_attente;           // Nombre d'instances en attente
+} Tache;
+
+// Structure pour stocker l'état du système
+typedef struct {
+    Tache *taches;
+    ParametresTache *parametres; // Paramètres statiques des tâches (analyses)
+    int nb_taches;
+    TypeOrdonnanceur algorithme;
+    temps_t hyperperiode;     // PPCM des périodes (0 si hors capacité)
+    temps_t horizon;          // Durée de simulation suffisante pour conclure (-1 : non calculable)
+    temps_t echelle;          // PGCD des paramètres : durée d'un tick de simulation
+    bool surcharge;           // U > 1 : une échéance sera manquée, même au-delà de l'horizon
+    bool asynchrone;          // Au moins une tâche a un décalage non nul
+    bool verdict_seul;        // Arrêt dès que le verdict est connu
+    bool non_conclu;          // Dernière simulation sans verdict (horizon non calculable)
+    PolitiqueEchec politique_echec;
+    Trace *trace;             // Trace de la simulation (NULL : désactivée)
+    Metriques *metriques;     // Métriques par instance (NULL : désactivées)
+    JeuRessources *ressources; // Sections critiques et protocole (NULL : tâches indépendantes)
+    ModePreemption preemption; // Préemption des instances commencées (politiques préemptives)
+    temps_t points;           // Longueur des tronçons non préemptibles (PREEMPTION_POINTS)
+    temps_t commutation;      // Coût d'une commutation de contexte (0 : gratuite)
+    
+    // Files de la simulation (O(log n) par événement), indexées par tâche
+    Tas pret;                 // Tâches ayant une instance en attente, par clé de sa première instance
+    Tas activations;          // Prochaines activations, par date
+    Tas echeances;            // Prochaine échéance à surveiller de chaque tâche, par date
+    ReserveInstances reserve; // Instances en attente (mémoire conservée d'une simulation à l'autre)
+    
+    // État mémorisé au dernier multiple de l'hyperpériode (détection de cycle)
+    temps_t *etat;
+    int taille_etat;          // Entiers mémorisés (-1 : aucun état)
+    int capacite_etat;
+} Systeme;
+
+// Capacité du tampon de trace en mode interactif (événements)
+#define TAILLE_TRACE (1 << 16)
+
+// Horizon maximal (marge pour que temps + durée ne déborde pas de temps_t) : au-delà,
+// l'horizon est non calculable
+#define HORIZON_MAX (TEMPS_MAX / 4)
+
+void initialiser_tache(Tache *tache, int id, temps_t duree, temps_t echeance, temps_t periode, int priorite,
+                       temps_t decalage);
+void configurer_systeme(Systeme *systeme, ParametresTache *parametres, int nb_taches);
+bool appliquer_decalages(Systeme *systeme, const temps_t *decalages);
+bool attribuer_seuils(Systeme *systeme);
+void liberer_files(Systeme *systeme);
+
+// Une simulation spécialisée par politique, et un point d'entrée qui choisit
+// la spécialisation selon systeme->algorithme (une fois par simulation)
+bool simuler_priorites_fixes(Systeme *systeme, temps_t duree_simulation);
+bool simuler_edf(Systeme *systeme, temps_t duree_simulation);
+bool simuler_fifo(Systeme *systeme, temps_t duree_simulation);
+bool simuler_ordonnancement(Systeme *systeme, temps_t duree_simulation);
+
+const char* nom_algorithme(TypeOrdonnanceur algo);
+const char* nom_court_algorithme(TypeOrdonnanceur algo);
+const char* nom_politique_echec(PolitiqueEchec politique);
+bool lire_politique_echec(const char *nom, PolitiqueEchec *politique);
+
+#endif
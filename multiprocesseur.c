@@ -0,0 +1,340 @@
+#include <stdlib.h>
+#include <string.h>
+#include "tas.h"
+#include "analyse.h"
+#include "multiprocesseur.h"
+
+// Tolérance sur les sommes d'utilisations (erreurs d'arrondi)
+#define EPSILON_UTILISATION 1e-9
+
+// État d'une tâche pendant la simulation globale
+typedef struct {
+    long long temps_restant;
+    long long prochaine_activation;
+    long long echeance_absolue;
+    int coeur;                // Cœur qui exécute l'instance (-1 si aucun)
+    int dernier_coeur;        // Cœur où l'instance a été interrompue (-1 sinon)
+    bool elue;                // Parmi les m instances élues à l'instant courant
+} EtatTache;
+
+// Fonction pour obtenir la clé d'une instance dans la file des prêts
+static long long cle_pret(const ParametresTache *taches, const EtatTache *etats, int i,
+                          PolitiqueMultiprocesseur politique) {
+    return politique == POLITIQUE_EDF ? etats[i].echeance_absolue : -(long long)taches[i].priorite;
+}
+
+// Fonction pour simuler l'ordonnancement global sur nb_coeurs cœurs identiques
+// À chaque événement, les nb_coeurs instances prêtes les plus prioritaires
+// s'exécutent ; une instance qui reste élue garde son cœur, une instance
+// reprise sur un autre cœur que celui où elle a été interrompue compte comme
+// une migration. La simulation s'arrête à la première échéance manquée.
+// Contrairement au cas monoprocesseur, l'activation synchrone n'est pas le
+// pire cas en global : l'absence d'échec sur l'horizon n'est pas une preuve.
+bool simuler_global(const ParametresTache *taches, int nb_taches, int nb_coeurs,
+                    PolitiqueMultiprocesseur politique, long long horizon,
+                    StatistiquesGlobales *statistiques, double *charge) {
+    EtatTache *etats = calloc(nb_taches, sizeof(EtatTache));
+    int *occupant = malloc(nb_coeurs * sizeof(int)); // Tâche exécutée par chaque cœur (-1 : libre)
+    int *elues = malloc(nb_coeurs * sizeof(int));
+    Tas pret = { 0 }, activations = { 0 }, echeances = { 0 };
+    StatistiquesGlobales stats = { 0 };
+    bool faisable = true;
+    long long temps = 0;
+    long long periode_cycle;
+    
+    if (etats == NULL || occupant == NULL || elues == NULL ||
+        !tas_initialiser(&pret, nb_taches) || !tas_initialiser(&activations, nb_taches) ||
+        !tas_initialiser(&echeances, nb_taches)) {
+        faisable = false;
+        horizon = 0;
+    }
+    if (charge != NULL) {
+        memset(charge, 0, nb_coeurs * sizeof(double));
+    }
+    
+    // Contrôle de cycle aux multiples de l'hyperpériode
+    if (!hyperperiode(taches, nb_taches, &periode_cycle) || periode_cycle > horizon) {
+        periode_cycle = horizon;
+    }
+    long long controle = periode_cycle;
+    
+    for (int i = 0; i < nb_taches && faisable; i++) {
+        etats[i].coeur = -1;
+        etats[i].dernier_coeur = -1;
+        tas_inserer(&activations, i, 0);
+    }
+    for (int c = 0; c < nb_coeurs && faisable; c++) {
+        occupant[c] = -1;
+    }
+    
+    while (temps < horizon) {
+        // Aucune instance en attente à un multiple de l'hyperpériode : l'état
+        // est celui de t = 0, l'ordonnancement se répète à l'identique
+        if (temps == controle) {
+            if (tas_vide(&pret)) {
+                break;
+            }
+            controle = horizon - temps > periode_cycle ? temps + periode_cycle : horizon;
+        }
+        
+        // Échéance atteinte par une instance non terminée
+        if (!tas_vide(&echeances) && tas_cle_sommet(&echeances) <= temps) {
+            faisable = false;
+            break;
+        }
+        
+        // Activations (une instance écrasée avant son échéance est un échec)
+        while (!tas_vide(&activations) && tas_cle_sommet(&activations) == temps) {
+            int i = tas_sommet(&activations);
+            if (tas_contient(&echeances, i)) {
+                faisable = false;
+                break;
+            }
+            etats[i].temps_restant = taches[i].duree_execution;
+            etats[i].echeance_absolue = temps + taches[i].echeance;
+            tas_inserer(&pret, i, cle_pret(taches, etats, i, politique));
+            tas_inserer(&echeances, i, etats[i].echeance_absolue);
+            etats[i].prochaine_activation += taches[i].periode;
+            tas_modifier(&activations, i, etats[i].prochaine_activation);
+        }
+        if (!faisable) {
+            break;
+        }
+        
+        // Élection des instances les plus prioritaires (extraites puis réinsérées)
+        int nb_elues = 0;
+        while (nb_elues < nb_coeurs && !tas_vide(&pret)) {
+            elues[nb_elues] = tas_extraire(&pret);
+            etats[elues[nb_elues]].elue = true;
+            nb_elues++;
+        }
+        for (int k = 0; k < nb_elues; k++) {
+            tas_inserer(&pret, elues[k], cle_pret(taches, etats, elues[k], politique));
+        }
+        
+        // Les occupants qui ne sont plus élus sont préemptés
+        for (int c = 0; c < nb_coeurs; c++) {
+            int i = occupant[c];
+            if (i != -1 && !etats[i].elue) {
+                etats[i].coeur = -1;
+                etats[i].dernier_coeur = c;
+                occupant[c] = -1;
+                stats.preemptions++;
+            }
+        }
+        
+        // Les nouvelles élues reprennent leur cœur s'il est libre, sinon le premier libre
+        for (int k = 0; k < nb_elues; k++) {
+            EtatTache *etat = &etats[elues[k]];
+            if (etat->coeur != -1) {
+                continue;
+            }
+            int coeur = etat->dernier_coeur;
+            if (coeur == -1 || occupant[coeur] != -1) {
+                coeur = 0;
+                while (occupant[coeur] != -1) {
+                    coeur++;
+                }
+            }
+            if (etat->dernier_coeur != -1 && etat->dernier_coeur != coeur) {
+                stats.migrations++;
+            }
+            etat->dernier_coeur = -1;
+            etat->coeur = coeur;
+            occupant[coeur] = elues[k];
+        }
+        
+        // Prochain événement : activation, échéance, contrôle ou terminaison
+        long long fin = controle;
+        if (!tas_vide(&activations) && tas_cle_sommet(&activations) < fin) {
+            fin = tas_cle_sommet(&activations);
+        }
+        if (!tas_vide(&echeances) && tas_cle_sommet(&echeances) < fin) {
+            fin = tas_cle_sommet(&echeances);
+        }
+        for (int k = 0; k < nb_elues; k++) {
+            if (temps + etats[elues[k]].temps_restant < fin) {
+                fin = temps + etats[elues[k]].temps_restant;
+            }
+        }
+        
+        // Exécution des élues jusqu'au prochain événement
+        for (int k = 0; k < nb_elues; k++) {
+            int i = elues[k];
+            EtatTache *etat = &etats[i];
+            etat->temps_restant -= fin - temps;
+            etat->elue = false;
+            if (charge != NULL) {
+                charge[etat->coeur] += fin - temps;
+            }
+            if (etat->temps_restant == 0) {
+                tas_retirer(&pret, i);
+                if (tas_contient(&echeances, i)) {
+                    tas_retirer(&echeances, i);
+                }
+                occupant[etat->coeur] = -1;
+                etat->coeur = -1;
+            }
+        }
+        temps = fin;
+    }
+    
+    stats.duree = temps;
+    if (charge != NULL) {
+        for (int c = 0; c < nb_coeurs; c++) {
+            charge[c] = temps > 0 ? charge[c] / temps : 0.0;
+        }
+    }
+    if (statistiques != NULL) {
+        *statistiques = stats;
+    }
+    
+    tas_liberer(&pret);
+    tas_liberer(&activations);
+    tas_liberer(&echeances);
+    free(etats);
+    free(occupant);
+    free(elues);
+    return faisable;
+}
+
+// Tâche ou cœur associé à une clé de tri (tri par clé décroissante puis indice)
+typedef struct {
+    double cle;
+    int indice;
+} ElementTri;
+
+// Fonction de comparaison pour qsort : clé décroissante, puis indice croissant
+static int comparer_decroissant(const void *a, const void *b) {
+    const ElementTri *x = a;
+    const ElementTri *y = b;
+    
+    if (x->cle != y->cle) {
+        return x->cle > y->cle ? -1 : 1;
+    }
+    return x->indice - y->indice;
+}
+
+// Fonction pour vérifier qu'un cœur reste ordonnançable si on lui ajoute une
+// tâche : test exact de la politique locale (QPA pour EDF, RTA sinon) sur les
+// tâches du cœur, gardées dans l'ordre de leurs indices (même départage)
+static bool coeur_accepte(const ParametresTache *taches, int nb_taches, const int *affectation,
+                          int coeur, int candidate, PolitiqueMultiprocesseur politique,
+                          ParametresTache *sous_jeu) {
+    int k = 0;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (affectation[i] == coeur || i == candidate) {
+            sous_jeu[k++] = taches[i];
+        }
+    }
+    return politique == POLITIQUE_EDF ? analyser_qpa(sous_jeu, k, NULL) :
+                                        analyser_temps_reponse(sous_jeu, k, NULL);
+}
+
+// Fonction pour répartir les tâches sur nb_coeurs cœurs (ordonnancement partitionné)
+// Les tâches sont placées par utilisation décroissante ; les cœurs sont
+// essayés dans l'ordre de l'heuristique (indice, charge décroissante ou
+// croissante) et le premier qui reste ordonnançable est retenu. affectation
+// (nb_taches cœurs, -1 si non placée) et charge (utilisation de chaque cœur)
+// peuvent être NULL. Renvoie false si une tâche n'a pu être placée.
+bool partitionner(const ParametresTache *taches, int nb_taches, int nb_coeurs,
+                  PolitiqueMultiprocesseur politique, HeuristiquePlacement heuristique,
+                  int *affectation, double *charge) {
+    ElementTri *ordre = malloc(nb_taches * sizeof(ElementTri));
+    ElementTri *coeurs = malloc(nb_coeurs * sizeof(ElementTri));
+    ParametresTache *sous_jeu = malloc(nb_taches * sizeof(ParametresTache));
+    int *placement = malloc(nb_taches * sizeof(int));
+    double *utilisation = calloc(nb_coeurs, sizeof(double));
+    bool reussi = ordre != NULL && coeurs != NULL && sous_jeu != NULL &&
+                  placement != NULL && utilisation != NULL;
+    
+    for (int i = 0; reussi && i < nb_taches; i++) {
+        ordre[i].cle = (double)taches[i].duree_execution / taches[i].periode;
+        ordre[i].indice = i;
+        placement[i] = -1;
+    }
+    if (reussi) {
+        qsort(ordre, nb_taches, sizeof(ElementTri), comparer_decroissant);
+    }
+    
+    for (int k = 0; reussi && k < nb_taches; k++) {
+        int i = ordre[k].indice;
+        double u = ordre[k].cle;
+        
+        // Ordre d'essai des cœurs selon l'heuristique
+        for (int c = 0; c < nb_coeurs; c++) {
+            coeurs[c].cle = heuristique == PLACEMENT_BFD ? utilisation[c] :
+                            heuristique == PLACEMENT_WFD ? -utilisation[c] : 0.0;
+            coeurs[c].indice = c;
+        }
+        if (heuristique != PLACEMENT_FFD) {
+            qsort(coeurs, nb_coeurs, sizeof(ElementTri), comparer_decroissant);
+        }
+        
+        int choisi = -1;
+        for (int j = 0; j < nb_coeurs && choisi == -1; j++) {
+            int c = coeurs[j].indice;
+            // U <= 1 est nécessaire : le test exact n'est lancé que s'il est respecté
+            if (utilisation[c] + u <= 1.0 + EPSILON_UTILISATION &&
+                coeur_accepte(taches, nb_taches, placement, c, i, politique, sous_jeu)) {
+                choisi = c;
+            }
+        }
+        if (choisi == -1) {
+            reussi = false;
+            break;
+        }
+        placement[i] = choisi;
+        utilisation[choisi] += u;
+    }
+    
+    if (affectation != NULL && placement != NULL) {
+        memcpy(affectation, placement, nb_taches * sizeof(int));
+    }
+    if (charge != NULL && utilisation != NULL) {
+        memcpy(charge, utilisation, nb_coeurs * sizeof(double));
+    }
+    free(ordre);
+    free(coeurs);
+    free(sous_jeu);
+    free(placement);
+    free(utilisation);
+    return reussi;
+}
+
+// Fonction pour obtenir le premier nombre de cœurs à essayer : ⌈U⌉, au moins 1
+static int coeurs_necessaires(const ParametresTache *taches, int nb_taches) {
+    double u = facteur_utilisation(taches, nb_taches) - EPSILON_UTILISATION;
+    int m = (int)u;
+    
+    if (m < u) {
+        m++;
+    }
+    return m > 0 ? m : 1;
+}
+
+// Fonction pour trouver le plus petit nombre de cœurs sans échec en global
+// (-1 si aucun jusqu'à un cœur par tâche, où seul C > D peut échouer)
+int coeurs_minimum_global(const ParametresTache *taches, int nb_taches,
+                          PolitiqueMultiprocesseur politique, long long horizon) {
+    for (int m = coeurs_necessaires(taches, nb_taches); m <= nb_taches; m++) {
+        if (simuler_global(taches, nb_taches, m, politique, horizon, NULL, NULL)) {
+            return m;
+        }
+    }
+    return -1;
+}
+
+// Fonction pour trouver le plus petit nombre de cœurs pour lequel
+// l'heuristique réussit à partitionner le jeu (-1 si aucun)
+// Le balayage est linéaire : BFD et WFD ne sont pas monotones en m.
+int coeurs_minimum_partitionne(const ParametresTache *taches, int nb_taches,
+                               PolitiqueMultiprocesseur politique, HeuristiquePlacement heuristique) {
+    for (int m = coeurs_necessaires(taches, nb_taches); m <= nb_taches; m++) {
+        if (partitionner(taches, nb_taches, m, politique, heuristique, NULL, NULL)) {
+            return m;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,39 @@
+#ifndef MULTIPROCESSEUR_H
+#define MULTIPROCESSEUR_H
+
+#include <stdbool.h>
+#include "tache.h"
+
+// Politique d'ordonnancement (globale, ou locale à chaque cœur en partitionné)
+typedef enum {
+    POLITIQUE_EDF,            // Échéance absolue la plus proche
+    POLITIQUE_PRIORITES_FIXES // Champ priorite des paramètres (RM, DM, HPF)
+} PolitiqueMultiprocesseur;
+
+// Heuristiques de placement, les tâches étant triées par utilisation décroissante
+typedef enum {
+    PLACEMENT_FFD,            // First-Fit Decreasing : premier cœur qui accepte
+    PLACEMENT_BFD,            // Best-Fit Decreasing : cœur accepteur le plus chargé
+    PLACEMENT_WFD             // Worst-Fit Decreasing : cœur accepteur le moins chargé
+} HeuristiquePlacement;
+
+// Statistiques d'une simulation globale
+typedef struct {
+    long long duree;          // Durée effectivement simulée
+    long long preemptions;    // Instances interrompues avant leur terminaison
+    long long migrations;     // Instances reprises sur un autre cœur
+} StatistiquesGlobales;
+
+bool simuler_global(const ParametresTache *taches, int nb_taches, int nb_coeurs,
+                    PolitiqueMultiprocesseur politique, long long horizon,
+                    StatistiquesGlobales *statistiques, double *charge);
+bool partitionner(const ParametresTache *taches, int nb_taches, int nb_coeurs,
+                  PolitiqueMultiprocesseur politique, HeuristiquePlacement heuristique,
+                  int *affectation, double *charge);
+
+int coeurs_minimum_global(const ParametresTache *taches, int nb_taches,
+                          PolitiqueMultiprocesseur politique, long long horizon);
+int coeurs_minimum_partitionne(const ParametresTache *taches, int nb_taches,
+                               PolitiqueMultiprocesseur politique, HeuristiquePlacement heuristique);
+
+#endif
@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "tache.h"
+#include "analyse.h"
+#include "lot-taches.h"
+#include "multiprocesseur.h"
+
+// Horizon maximal par défaut d'une simulation globale
+#define DUREE_MAX_DEFAUT 100000LL
+
+// Attribution des priorités évaluée
+typedef enum {
+    ATTRIBUTION_EDF,
+    ATTRIBUTION_RM,
+    ATTRIBUTION_DM,
+    NB_ATTRIBUTIONS
+} Attribution;
+
+static const char *noms_attributions[NB_ATTRIBUTIONS] = { "edf", "rm", "dm" };
+static const char *noms_placements[] = { "ffd", "bfd", "wfd" };
+
+// Fonction pour écrire une ligne CSV : charges et affectation séparées par ';'
+static void ecrire_ligne(FILE *sortie, long numero, int nb_taches, double utilisation,
+                         const char *attribution, const char *strategie, int nb_coeurs,
+                         bool faisable, int coeurs_min, const StatistiquesGlobales *statistiques,
+                         const double *charge, const int *affectation) {
+    fprintf(sortie, "%ld,%d,%.4f,%s-%s,%d,%s,", numero, nb_taches, utilisation, attribution,
+            strategie, nb_coeurs, faisable ? "faisable" : "non_faisable");
+    if (coeurs_min > 0) {
+        fprintf(sortie, "%d,", coeurs_min);
+    } else {
+        fprintf(sortie, "-,");
+    }
+    if (statistiques != NULL) {
+        fprintf(sortie, "%lld,%lld,", statistiques->migrations, statistiques->preemptions);
+    } else {
+        fprintf(sortie, "0,-,");
+    }
+    for (int c = 0; c < nb_coeurs; c++) {
+        fprintf(sortie, "%s%.4f", c > 0 ? ";" : "", charge[c]);
+    }
+    fprintf(sortie, ",");
+    if (affectation == NULL) {
+        fprintf(sortie, "-");
+    }
+    for (int i = 0; affectation != NULL && i < nb_taches; i++) {
+        if (affectation[i] >= 0) {
+            fprintf(sortie, "%s%d", i > 0 ? ";" : "", affectation[i]);
+        } else {
+            fprintf(sortie, "%s-", i > 0 ? ";" : "");
+        }
+    }
+    fprintf(sortie, "\n");
+}
+
+// Fonction pour évaluer un jeu avec toutes les stratégies sur nb_coeurs cœurs
+// Global : simulation depuis l'activation synchrone jusqu'à l'hyperpériode
+// (bornée par duree_max). Partitionné : placement puis test exact par cœur.
+static bool evaluer_jeu(FILE *sortie, long numero, const ParametresTache *jeu, int n,
+                        int nb_coeurs, long long duree_max, ParametresTache *copie,
+                        double *charge, int *affectation) {
+    double utilisation = facteur_utilisation(jeu, n);
+    long long horizon = horizon_simulation(jeu, n);
+    
+    if (horizon < 0 || horizon > duree_max) {
+        horizon = duree_max;
+    }
+    
+    for (int a = 0; a < NB_ATTRIBUTIONS; a++) {
+        PolitiqueMultiprocesseur politique = a == ATTRIBUTION_EDF ? POLITIQUE_EDF : POLITIQUE_PRIORITES_FIXES;
+        StatistiquesGlobales statistiques;
+        
+        memcpy(copie, jeu, n * sizeof(ParametresTache));
+        if (a == ATTRIBUTION_RM) {
+            calculer_priorites_rm(copie, n);
+        } else if (a == ATTRIBUTION_DM) {
+            calculer_priorites_dm(copie, n);
+        }
+        
+        bool faisable = simuler_global(copie, n, nb_coeurs, politique, horizon, &statistiques, charge);
+        ecrire_ligne(sortie, numero, n, utilisation, noms_attributions[a], "global", nb_coeurs, faisable,
+                     coeurs_minimum_global(copie, n, politique, horizon), &statistiques, charge, NULL);
+        
+        for (int h = PLACEMENT_FFD; h <= PLACEMENT_WFD; h++) {
+            faisable = partitionner(copie, n, nb_coeurs, politique, (HeuristiquePlacement)h, affectation, charge);
+            ecrire_ligne(sortie, numero, n, utilisation, noms_attributions[a], noms_placements[h], nb_coeurs,
+                         faisable, coeurs_minimum_partitionne(copie, n, politique, (HeuristiquePlacement)h),
+                         NULL, charge, affectation);
+        }
+    }
+    return !ferror(sortie);
+}
+
+// Fonction pour afficher l'aide de la ligne de commande
+static void afficher_usage(const char *programme) {
+    printf("Usage: %s --lot FICHIER [options]\n\n", programme);
+    printf("Evalue chaque jeu du lot sur M coeurs identiques : EDF, RM et DM globaux\n");
+    printf("(simulation) et partitionnes (placement FFD, BFD, WFD puis test exact par coeur).\n\n");
+    printf("  --lot FICHIER            jeux de taches (format texte ou binaire)\n");
+    printf("  --coeurs M               nombre de coeurs (defaut: 4)\n");
+    printf("  --duree-max N            horizon maximal des simulations globales (defaut: %lld)\n",
+           DUREE_MAX_DEFAUT);
+    printf("  --sortie FICHIER         ecrire le CSV dans un fichier (defaut: sortie standard)\n\n");
+    printf("Colonnes : jeu,taches,utilisation,strategie,coeurs,verdict,coeurs_min,migrations,\n");
+    printf("preemptions,charges,affectation (charges et affectation separees par ';').\n");
+}
+
+int main(int argc, char **argv) {
+    const char *chemin_lot = NULL;
+    const char *chemin_sortie = NULL;
+    int nb_coeurs = 4;
+    long long duree_max = DUREE_MAX_DEFAUT;
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(argv[0]);
+            return 0;
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            return 1;
+        } else if (strcmp(argv[i], "--lot") == 0) {
+            chemin_lot = valeur;
+        } else if (strcmp(argv[i], "--coeurs") == 0) {
+            nb_coeurs = atoi(valeur);
+        } else if (strcmp(argv[i], "--duree-max") == 0) {
+            duree_max = atoll(valeur);
+        } else if (strcmp(argv[i], "--sortie") == 0) {
+            chemin_sortie = valeur;
+        } else {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    
+    if (chemin_lot == NULL || nb_coeurs <= 0 || duree_max <= 0) {
+        afficher_usage(argv[0]);
+        return 1;
+    }
+    
+    LecteurLot lecteur;
+    if (!lot_ouvrir(&lecteur, chemin_lot)) {
+        return 1;
+    }
+    FILE *sortie = chemin_sortie != NULL ? fopen(chemin_sortie, "w") : stdout;
+    if (sortie == NULL) {
+        perror(chemin_sortie);
+        lot_fermer(&lecteur);
+        return 1;
+    }
+    
+    ParametresTache *copie = NULL;
+    int *affectation = NULL;
+    double *charge = malloc(nb_coeurs * sizeof(double));
+    int capacite = 0;
+    int code = charge != NULL ? 0 : 1;
+    int lu;
+    
+    fprintf(sortie, "jeu,taches,utilisation,strategie,coeurs,verdict,coeurs_min,migrations,"
+                    "preemptions,charges,affectation\n");
+    while (code == 0 && (lu = lot_lire_jeu(&lecteur)) == 1) {
+        int n = lecteur.nb_taches;
+        
+        if (!lot_parametres_valides(lecteur.parametres, n)) {
+            fprintf(sortie, "%ld,%d,-,-,%d,invalide,-,-,-,-,-\n", lecteur.numero, n, nb_coeurs);
+            continue;
+        }
+        // Les tampons ne sont réalloués que lorsqu'un jeu plus grand arrive
+        if (n > capacite) {
+            ParametresTache *nouvelle_copie = realloc(copie, n * sizeof(ParametresTache));
+            int *nouvelle_affectation = realloc(affectation, n * sizeof(int));
+            if (nouvelle_copie != NULL) {
+                copie = nouvelle_copie;
+            }
+            if (nouvelle_affectation != NULL) {
+                affectation = nouvelle_affectation;
+            }
+            if (nouvelle_copie == NULL || nouvelle_affectation == NULL) {
+                code = 1;
+                break;
+            }
+            capacite = n;
+        }
+        if (!evaluer_jeu(sortie, lecteur.numero, lecteur.parametres, n, nb_coeurs, duree_max,
+                         copie, charge, affectation)) {
+            code = 1;
+        }
+    }
+    if (code != 0) {
+        fprintf(stderr, "Memoire insuffisante ou erreur d'ecriture\n");
+    }
+    if (lecteur.erreur) {
+        code = 1;
+    }
+    
+    if (sortie != stdout && fclose(sortie) != 0) {
+        perror(chemin_sortie);
+        code = 1;
+    }
+    lot_fermer(&lecteur);
+    free(copie);
+    free(affectation);
+    free(charge);
+    return code;
+}
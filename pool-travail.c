@@ -0,0 +1,237 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "pool-travail.h"
+
+// Plage d'éléments restant à traiter par un ouvrier (une ligne de cache chacune)
+typedef struct {
+    pthread_mutex_t verrou;
+    long debut;
+    long fin;
+} __attribute__((aligned(64))) PlageOuvrier;
+
+// Paramètres de démarrage d'un thread ouvrier
+typedef struct {
+    PoolTravail *pool;
+    int numero;
+} Ouvrier;
+
+struct PoolTravail {
+    int nb_ouvriers;
+    pthread_t *threads;
+    Ouvrier *ouvriers;
+    PlageOuvrier *plages;
+    
+    // Synchronisation entre le thread appelant et les ouvriers
+    pthread_mutex_t verrou;
+    pthread_cond_t travail_disponible;
+    pthread_cond_t travail_termine;
+    unsigned long generation;  // Incrémentée à chaque lancement
+    int actifs;                // Ouvriers n'ayant pas encore terminé le lancement courant
+    bool arret;
+    
+    // Travail courant
+    FonctionTravail fonction;
+    void *contexte;
+    long grain;
+};
+
+// Fonction pour prendre le prochain paquet de sa propre plage
+static bool prendre_paquet(PoolTravail *pool, int numero, long *debut, long *fin) {
+    PlageOuvrier *plage = &pool->plages[numero];
+    bool trouve = false;
+    
+    pthread_mutex_lock(&plage->verrou);
+    if (plage->debut < plage->fin) {
+        *debut = plage->debut;
+        *fin = plage->debut + pool->grain < plage->fin ? plage->debut + pool->grain : plage->fin;
+        plage->debut = *fin;
+        trouve = true;
+    }
+    pthread_mutex_unlock(&plage->verrou);
+    return trouve;
+}
+
+// Fonction pour voler la seconde moitié de la plage d'un autre ouvrier
+static bool voler(PoolTravail *pool, int numero) {
+    for (int k = 1; k < pool->nb_ouvriers; k++) {
+        PlageOuvrier *victime = &pool->plages[(numero + k) % pool->nb_ouvriers];
+        long debut = 0;
+        long fin = 0;
+        
+        pthread_mutex_lock(&victime->verrou);
+        long restant = victime->fin - victime->debut;
+        if (restant > 0) {
+            fin = victime->fin;
+            debut = fin - (restant + 1) / 2;
+            victime->fin = debut;
+        }
+        pthread_mutex_unlock(&victime->verrou);
+        
+        if (fin > debut) {
+            PlageOuvrier *plage = &pool->plages[numero];
+            pthread_mutex_lock(&plage->verrou);
+            plage->debut = debut;
+            plage->fin = fin;
+            pthread_mutex_unlock(&plage->verrou);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Boucle principale d'un thread ouvrier
+static void *boucle_ouvrier(void *argument) {
+    Ouvrier *ouvrier = argument;
+    PoolTravail *pool = ouvrier->pool;
+    unsigned long generation_vue = 0;
+    
+    for (;;) {
+        pthread_mutex_lock(&pool->verrou);
+        while (!pool->arret && pool->generation == generation_vue) {
+            pthread_cond_wait(&pool->travail_disponible, &pool->verrou);
+        }
+        if (pool->arret) {
+            pthread_mutex_unlock(&pool->verrou);
+            return NULL;
+        }
+        generation_vue = pool->generation;
+        pthread_mutex_unlock(&pool->verrou);
+        
+        // Consommer sa plage puis voler tant qu'il reste du travail quelque part
+        long debut, fin;
+        do {
+            while (prendre_paquet(pool, ouvrier->numero, &debut, &fin)) {
+                pool->fonction(pool->contexte, ouvrier->numero, debut, fin);
+            }
+        } while (voler(pool, ouvrier->numero));
+        
+        pthread_mutex_lock(&pool->verrou);
+        if (--pool->actifs == 0) {
+            pthread_cond_signal(&pool->travail_termine);
+        }
+        pthread_mutex_unlock(&pool->verrou);
+    }
+}
+
+// Fonction pour connaître le nombre de cœurs disponibles
+int pool_nb_coeurs(void) {
+    long coeurs = sysconf(_SC_NPROCESSORS_ONLN);
+    return coeurs > 0 ? (int)coeurs : 1;
+}
+
+// Fonction pour créer un pool (nb_ouvriers <= 0 : un ouvrier par cœur)
+PoolTravail *pool_creer(int nb_ouvriers) {
+    PoolTravail *pool = calloc(1, sizeof(PoolTravail));
+    if (pool == NULL) {
+        return NULL;
+    }
+    
+    pool->nb_ouvriers = nb_ouvriers > 0 ? nb_ouvriers : pool_nb_coeurs();
+    pool->threads = calloc(pool->nb_ouvriers, sizeof(pthread_t));
+    pool->ouvriers = calloc(pool->nb_ouvriers, sizeof(Ouvrier));
+    pool->plages = aligned_alloc(64, pool->nb_ouvriers * sizeof(PlageOuvrier));
+    if (pool->threads == NULL || pool->ouvriers == NULL || pool->plages == NULL) {
+        free(pool->threads);
+        free(pool->ouvriers);
+        free(pool->plages);
+        free(pool);
+        return NULL;
+    }
+    
+    pthread_mutex_init(&pool->verrou, NULL);
+    pthread_cond_init(&pool->travail_disponible, NULL);
+    pthread_cond_init(&pool->travail_termine, NULL);
+    
+    for (int i = 0; i < pool->nb_ouvriers; i++) {
+        pthread_mutex_init(&pool->plages[i].verrou, NULL);
+        pool->plages[i].debut = 0;
+        pool->plages[i].fin = 0;
+        pool->ouvriers[i].pool = pool;
+        pool->ouvriers[i].numero = i;
+    }
+    for (int i = 0; i < pool->nb_ouvriers; i++) {
+        if (pthread_create(&pool->threads[i], NULL, boucle_ouvrier, &pool->ouvriers[i]) != 0) {
+            // Continuer avec les ouvriers déjà démarrés
+            pool->nb_ouvriers = i;
+            break;
+        }
+    }
+    if (pool->nb_ouvriers == 0) {
+        pool_detruire(pool);
+        return NULL;
+    }
+    
+    return pool;
+}
+
+// Fonction pour arrêter les ouvriers et libérer le pool
+void pool_detruire(PoolTravail *pool) {
+    if (pool == NULL) {
+        return;
+    }
+    
+    pthread_mutex_lock(&pool->verrou);
+    pool->arret = true;
+    pthread_cond_broadcast(&pool->travail_disponible);
+    pthread_mutex_unlock(&pool->verrou);
+    
+    for (int i = 0; i < pool->nb_ouvriers; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    for (int i = 0; i < pool->nb_ouvriers; i++) {
+        pthread_mutex_destroy(&pool->plages[i].verrou);
+    }
+    pthread_mutex_destroy(&pool->verrou);
+    pthread_cond_destroy(&pool->travail_disponible);
+    pthread_cond_destroy(&pool->travail_termine);
+    
+    free(pool->threads);
+    free(pool->ouvriers);
+    free(pool->plages);
+    free(pool);
+}
+
+// Fonction pour connaître le nombre d'ouvriers du pool
+int pool_nb_ouvriers(const PoolTravail *pool) {
+    return pool->nb_ouvriers;
+}
+
+// Fonction pour lancer le traitement des éléments [0, nb_elements) sans attendre
+// Les éléments sont répartis en plages contiguës égales, traitées par paquets de grain
+void pool_lancer(PoolTravail *pool, long nb_elements, long grain, 
+                 FonctionTravail fonction, void *contexte) {
+    pthread_mutex_lock(&pool->verrou);
+    
+    pool->fonction = fonction;
+    pool->contexte = contexte;
+    pool->grain = grain > 0 ? grain : 1;
+    for (int i = 0; i < pool->nb_ouvriers; i++) {
+        pthread_mutex_lock(&pool->plages[i].verrou);
+        pool->plages[i].debut = nb_elements * i / pool->nb_ouvriers;
+        pool->plages[i].fin = nb_elements * (i + 1) / pool->nb_ouvriers;
+        pthread_mutex_unlock(&pool->plages[i].verrou);
+    }
+    
+    pool->actifs = pool->nb_ouvriers;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->travail_disponible);
+    pthread_mutex_unlock(&pool->verrou);
+}
+
+// Fonction pour attendre la fin du dernier lancement
+void pool_attendre(PoolTravail *pool) {
+    pthread_mutex_lock(&pool->verrou);
+    while (pool->actifs > 0) {
+        pthread_cond_wait(&pool->travail_termine, &pool->verrou);
+    }
+    pthread_mutex_unlock(&pool->verrou);
+}
+
+// Fonction pour traiter les éléments [0, nb_elements) et attendre la fin
+void pool_executer(PoolTravail *pool, long nb_elements, long grain, 
+                   FonctionTravail fonction, void *contexte) {
+    pool_lancer(pool, nb_elements, grain, fonction, contexte);
+    pool_attendre(pool);
+}
@@ -0,0 +1,24 @@
+#ifndef POOL_TRAVAIL_H
+#define POOL_TRAVAIL_H
+
+// Traitement des éléments [debut, fin) par l'ouvrier numéro ouvrier
+// (l'ouvrier permet d'utiliser des tampons propres à chaque thread)
+typedef void (*FonctionTravail)(void *contexte, int ouvrier, long debut, long fin);
+
+// Pool de threads à vol de travail : chaque ouvrier consomme sa propre plage
+// d'éléments par paquets, puis vole la moitié de la plage restante d'un autre
+typedef struct PoolTravail PoolTravail;
+
+PoolTravail *pool_creer(int nb_ouvriers);
+void pool_detruire(PoolTravail *pool);
+int pool_nb_ouvriers(const PoolTravail *pool);
+int pool_nb_coeurs(void);
+
+// pool_attendre doit être appelé avant tout nouveau lancement
+void pool_lancer(PoolTravail *pool, long nb_elements, long grain, 
+                 FonctionTravail fonction, void *contexte);
+void pool_attendre(PoolTravail *pool);
+void pool_executer(PoolTravail *pool, long nb_elements, long grain, 
+                   FonctionTravail fonction, void *contexte);
+
+#endif
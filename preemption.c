@@ -0,0 +1,388 @@
+#include <stdlib.h>
+#include <string.h>
+#include "analyse.h"
+#include "preemption.h"
+
+// Fonction pour obtenir le niveau de préemption de la tâche i : nombre de
+// tâches qu'elle précède, par priorité (à priorité égale, le plus petit indice,
+// comme dans la simulation) ou par échéance relative (EDF), deux échéances
+// égales donnant le même niveau
+int niveau_preemption(const ParametresTache *taches, int nb_taches, bool par_echeance, int i) {
+    int niveau = 0;
+    
+    for (int j = 0; j < nb_taches; j++) {
+        niveau += par_echeance ? taches[i].echeance < taches[j].echeance :
+                  taches[i].priorite > taches[j].priorite ||
+                  (taches[i].priorite == taches[j].priorite && i < j);
+    }
+    return niveau;
+}
+
+// Fonction pour calculer les niveaux de préemption et les seuils effectifs
+// d'un mode : le niveau de la tâche (préemption totale), le plus haut niveau
+// (aucune préemption) ou les seuils fournis. Renvoie false si la mémoire manque.
+static bool preparer_niveaux(const ParametresTache *taches, int nb_taches, bool par_echeance, ModePreemption mode,
+                             const int *seuils, int **niveaux, int **effectifs) {
+    int taille = nb_taches > 0 ? nb_taches : 1;
+    
+    *niveaux = malloc(taille * sizeof(int));
+    *effectifs = malloc(taille * sizeof(int));
+    if (*niveaux == NULL || *effectifs == NULL) {
+        free(*niveaux);
+        free(*effectifs);
+        return false;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        (*niveaux)[i] = niveau_preemption(taches, nb_taches, par_echeance, i);
+        (*effectifs)[i] = mode == PREEMPTION_AUCUNE ? nb_taches - 1 :
+                          mode == PREEMPTION_SEUILS && seuils != NULL ? seuils[i] : (*niveaux)[i];
+    }
+    return true;
+}
+
+// Fonction pour calculer la longueur de la période d'activité de niveau i :
+// point fixe de L = B + Σ⌈L/Tj⌉Cj sur les tâches de niveau au moins celui de i.
+// Renvoie -1 si elle n'est pas bornée (utilisation de ces tâches >= 1 avec un
+// blocage, ou > 1).
+static long long periode_activite_niveau(const ParametresTache *taches, int nb_taches, const int *niveaux,
+                                         int i, long long blocage) {
+    double utilisation = 0.0;
+    long long l = blocage;
+    
+    for (int j = 0; j < nb_taches; j++) {
+        if (niveaux[j] >= niveaux[i]) {
+            utilisation += (double)taches[j].duree_execution / taches[j].periode;
+            l += taches[j].duree_execution;
+        }
+    }
+    if (utilisation > 1.0 + 1e-12 || (blocage > 0 && utilisation > 1.0 - 1e-12)) {
+        return -1;
+    }
+    for (;;) {
+        long long total = blocage;
+        for (int j = 0; j < nb_taches; j++) {
+            if (niveaux[j] >= niveaux[i]) {
+                total += ((l + taches[j].periode - 1) / taches[j].periode) * taches[j].duree_execution;
+            }
+        }
+        if (total == l) {
+            return l;
+        }
+        l = total;
+    }
+}
+
+// Fonction pour calculer la date de démarrage au plus tard de l'instance q de
+// la tâche i, relative au début de la période d'activité : point fixe de
+// S = B + qC + avance + Σ(⌊S/Tj⌋+1)Cj sur les tâches plus prioritaires
+// (avance : part de l'instance exécutée avant sa dernière région non préemptible)
+static long long demarrage_instance(const ParametresTache *taches, int nb_taches, const int *niveaux, int i,
+                                    long long q, long long blocage, long long avance) {
+    long long base = blocage + q * taches[i].duree_execution + avance;
+    long long s = base;
+    
+    for (;;) {
+        long long total = base;
+        for (int j = 0; j < nb_taches; j++) {
+            if (niveaux[j] > niveaux[i]) {
+                total += (s / taches[j].periode + 1) * taches[j].duree_execution;
+            }
+        }
+        if (total == s || total - q * taches[i].periode > taches[i].echeance) {
+            return total;
+        }
+        s = total;
+    }
+}
+
+// Fonction pour calculer le pire temps de réponse de la tâche i avec des seuils
+// de préemption (priorités fixes, Wang et Saksena corrigé par Regehr) :
+// - blocage B par une instance moins prioritaire dont le seuil atteint le niveau de i ;
+// - démarrage S de chaque instance q de la période d'activité de niveau i ;
+// - fin F = S + C + Σ(⌈F/Tj⌉ - ⌊S/Tj⌋ - 1)Cj, seules les tâches de niveau
+//   supérieur au seuil de i interrompant l'instance commencée.
+// Comme temps_reponse_tache, le calcul s'arrête dès que l'échéance est dépassée.
+static long long reponse_seuils(const ParametresTache *taches, int nb_taches, const int *niveaux,
+                                const int *seuils, int i) {
+    const ParametresTache *tache = &taches[i];
+    long long blocage = 0;
+    long long pire = 0;
+    
+    for (int j = 0; j < nb_taches; j++) {
+        if (niveaux[j] < niveaux[i] && seuils[j] >= niveaux[i] && taches[j].duree_execution > blocage) {
+            blocage = taches[j].duree_execution;
+        }
+    }
+    long long activite = periode_activite_niveau(taches, nb_taches, niveaux, i, blocage);
+    if (activite < 0) {
+        return tache->echeance + 1;
+    }
+    
+    for (long long q = 0; q == 0 || q * tache->periode < activite; q++) {
+        long long s = demarrage_instance(taches, nb_taches, niveaux, i, q, blocage, 0);
+        long long f = s + tache->duree_execution;
+        for (;;) {
+            long long total = s + tache->duree_execution;
+            for (int j = 0; j < nb_taches; j++) {
+                if (niveaux[j] > seuils[i]) {
+                    total += ((f + taches[j].periode - 1) / taches[j].periode - s / taches[j].periode - 1) *
+                             taches[j].duree_execution;
+                }
+            }
+            if (total - q * tache->periode > tache->echeance) {
+                return total - q * tache->periode;
+            }
+            if (total == f) {
+                break;
+            }
+            f = total;
+        }
+        if (f - q * tache->periode > pire) {
+            pire = f - q * tache->periode;
+        }
+    }
+    return pire;
+}
+
+// Fonction pour calculer le pire temps de réponse de la tâche i avec des points
+// de préemption fixes tous les points unités d'exécution (priorités fixes,
+// préemption différée de Bril et al.) : une instance moins prioritaire bloque
+// au plus un tronçon, et le dernier tronçon de i s'exécute sans interruption.
+static long long reponse_points(const ParametresTache *taches, int nb_taches, const int *niveaux,
+                                long long points, int i) {
+    const ParametresTache *tache = &taches[i];
+    long long dernier = tache->duree_execution - ((tache->duree_execution - 1) / points) * points;
+    long long blocage = 0;
+    long long pire = 0;
+    
+    for (int j = 0; j < nb_taches; j++) {
+        long long troncon = taches[j].duree_execution < points ? taches[j].duree_execution : points;
+        if (niveaux[j] < niveaux[i] && troncon > blocage) {
+            blocage = troncon;
+        }
+    }
+    long long activite = periode_activite_niveau(taches, nb_taches, niveaux, i, blocage);
+    if (activite < 0) {
+        return tache->echeance + 1;
+    }
+    
+    for (long long q = 0; q == 0 || q * tache->periode < activite; q++) {
+        long long s = demarrage_instance(taches, nb_taches, niveaux, i, q, blocage,
+                                         tache->duree_execution - dernier);
+        long long f = s + dernier;
+        if (f - q * tache->periode > tache->echeance) {
+            return f - q * tache->periode;
+        }
+        if (f - q * tache->periode > pire) {
+            pire = f - q * tache->periode;
+        }
+    }
+    return pire;
+}
+
+// Fonction pour calculer le pire temps de réponse d'une tâche avec des seuils de préemption
+long long temps_reponse_seuils(const ParametresTache *taches, int nb_taches, const int *seuils, int i) {
+    int *niveaux;
+    int *effectifs;
+    
+    if (!preparer_niveaux(taches, nb_taches, false, PREEMPTION_SEUILS, seuils, &niveaux, &effectifs)) {
+        return -1;
+    }
+    long long r = reponse_seuils(taches, nb_taches, niveaux, effectifs, i);
+    free(niveaux);
+    free(effectifs);
+    return r;
+}
+
+// Fonction pour calculer le pire temps de réponse d'une tâche avec des points de préemption
+long long temps_reponse_points(const ParametresTache *taches, int nb_taches, long long points, int i) {
+    int *niveaux;
+    int *effectifs;
+    
+    if (!preparer_niveaux(taches, nb_taches, false, PREEMPTION_POINTS, NULL, &niveaux, &effectifs)) {
+        return -1;
+    }
+    long long r = reponse_points(taches, nb_taches, niveaux, points, i);
+    free(niveaux);
+    free(effectifs);
+    return r;
+}
+
+// Fonction pour l'analyse des temps de réponse en préemption limitée (priorités fixes)
+// La préemption totale et l'absence de préemption sont des cas particuliers des
+// seuils (seuil = niveau de la tâche, ou plus haut niveau). Même convention que
+// analyser_temps_reponse : si temps_reponse vaut NULL, arrêt au premier échec.
+bool analyser_preemption_limitee(const ParametresTache *taches, int nb_taches, ModePreemption mode,
+                                 const int *seuils, long long points, long long *temps_reponse) {
+    int *niveaux;
+    int *effectifs;
+    bool faisable = true;
+    
+    if (!preparer_niveaux(taches, nb_taches, false, mode, seuils, &niveaux, &effectifs)) {
+        return false;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        long long r = mode == PREEMPTION_POINTS ? reponse_points(taches, nb_taches, niveaux, points, i) :
+                      reponse_seuils(taches, nb_taches, niveaux, effectifs, i);
+        if (temps_reponse != NULL) {
+            temps_reponse[i] = r;
+        }
+        if (r > taches[i].echeance) {
+            faisable = false;
+            if (temps_reponse == NULL) {
+                break;
+            }
+        }
+    }
+    
+    free(niveaux);
+    free(effectifs);
+    return faisable;
+}
+
+// Description du blocage d'un test EDF en préemption limitée
+typedef struct {
+    ModePreemption mode;
+    const int *niveaux;       // Niveaux par échéance relative
+    const int *seuils;        // Seuils effectifs
+    long long points;
+} BlocageLimite;
+
+// Fonction pour calculer le blocage B(t) en EDF : plus longue région non
+// préemptible d'une tâche d'échéance relative supérieure à t qui peut retarder
+// une tâche d'échéance relative au plus t (seuil atteignant son niveau, ou
+// tronçon de points unités au plus)
+static long long blocage_limite(const void *contexte, const ParametresTache *taches, int nb_taches, long long t) {
+    const BlocageLimite *limite = contexte;
+    int niveau = -1;
+    long long blocage = 0;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].echeance <= t && (niveau == -1 || limite->niveaux[i] < niveau)) {
+            niveau = limite->niveaux[i];
+        }
+    }
+    for (int j = 0; niveau != -1 && j < nb_taches; j++) {
+        long long region = taches[j].duree_execution;
+        if (taches[j].echeance <= t) {
+            continue;
+        }
+        if (limite->mode == PREEMPTION_POINTS) {
+            region = region < limite->points ? region : limite->points;
+        } else if (limite->seuils[j] < niveau) {
+            continue;
+        }
+        if (region > blocage) {
+            blocage = region;
+        }
+    }
+    return blocage;
+}
+
+// Fonction pour le test EDF en préemption limitée : h(t) + B(t) <= t, B(t)
+// étant nul à partir de la plus grande échéance relative (voir analyser_qpa_blocage)
+bool analyser_demande_limitee(const ParametresTache *taches, int nb_taches, ModePreemption mode,
+                              const int *seuils, long long points, long long *intervalle_violation) {
+    int *niveaux;
+    int *effectifs;
+    
+    if (mode == PREEMPTION_TOTALE) {
+        return analyser_qpa(taches, nb_taches, intervalle_violation);
+    }
+    if (!preparer_niveaux(taches, nb_taches, true, mode, seuils, &niveaux, &effectifs)) {
+        return false;
+    }
+    BlocageLimite limite = { mode, niveaux, effectifs, points };
+    bool faisable = analyser_qpa_blocage(taches, nb_taches, blocage_limite, &limite, intervalle_violation);
+    free(niveaux);
+    free(effectifs);
+    return faisable;
+}
+
+// Fonction pour tester un jeu de seuils selon la politique
+static bool seuils_faisables(const ParametresTache *taches, int nb_taches, bool edf, const int *seuils) {
+    return edf ? analyser_demande_limitee(taches, nb_taches, PREEMPTION_SEUILS, seuils, 0, NULL) :
+                 analyser_preemption_limitee(taches, nb_taches, PREEMPTION_SEUILS, seuils, 0, NULL);
+}
+
+// Fonction pour attribuer les seuils de préemption les plus hauts qui gardent
+// le jeu ordonnançable (Saksena et Wang) : en partant des seuils égaux aux
+// niveaux, le seuil de chaque tâche, de la plus prioritaire à la moins
+// prioritaire, est relevé tant que l'analyse reste favorable. Un seuil plus
+// haut protège davantage l'instance commencée : moins de préemptions, au prix
+// du blocage des tâches intermédiaires. Renvoie false (seuils = niveaux) si
+// le jeu n'est pas ordonnançable même avec la préemption totale.
+bool calculer_seuils_preemption(const ParametresTache *taches, int nb_taches, bool edf, int *seuils) {
+    int *niveaux;
+    int *effectifs;
+    int niveau_max = 0;
+    
+    if (!preparer_niveaux(taches, nb_taches, edf, PREEMPTION_TOTALE, NULL, &niveaux, &effectifs)) {
+        return false;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        seuils[i] = niveaux[i];
+        if (niveaux[i] > niveau_max) {
+            niveau_max = niveaux[i];
+        }
+    }
+    bool faisable = seuils_faisables(taches, nb_taches, edf, seuils);
+    
+    for (int niveau = niveau_max; faisable && niveau >= 0; niveau--) {
+        for (int i = 0; i < nb_taches; i++) {
+            if (niveaux[i] != niveau) {
+                continue;
+            }
+            while (seuils[i] < niveau_max) {
+                seuils[i]++;
+                if (!seuils_faisables(taches, nb_taches, edf, seuils)) {
+                    seuils[i]--;
+                    break;
+                }
+            }
+        }
+    }
+    
+    free(niveaux);
+    free(effectifs);
+    return faisable;
+}
+
+// Fonction pour obtenir une copie des paramètres dont les durées incluent le
+// coût des commutations de contexte : chaque instance en paie une à son
+// démarrage, et une à la reprise de chaque instance qu'elle a préemptée,
+// soit C + 2 x commutation (NULL si la mémoire manque)
+ParametresTache *parametres_avec_commutation(const ParametresTache *taches, int nb_taches, long long commutation) {
+    ParametresTache *copie = malloc((nb_taches > 0 ? nb_taches : 1) * sizeof(ParametresTache));
+    
+    if (copie == NULL) {
+        return NULL;
+    }
+    memcpy(copie, taches, nb_taches * sizeof(ParametresTache));
+    for (int i = 0; i < nb_taches; i++) {
+        copie[i].duree_execution += 2 * commutation;
+    }
+    return copie;
+}
+
+// Fonction pour obtenir le nom d'un mode de préemption (options et affichages)
+const char* nom_mode_preemption(ModePreemption mode) {
+    switch (mode) {
+        case PREEMPTION_TOTALE: return "totale";
+        case PREEMPTION_AUCUNE: return "aucune";
+        case PREEMPTION_SEUILS: return "seuils";
+        case PREEMPTION_POINTS: return "points";
+        default:                return "?";
+    }
+}
+
+// Fonction pour lire un mode de préemption à partir de son nom (false si inconnu)
+bool lire_mode_preemption(const char *nom, ModePreemption *mode) {
+    for (int m = 0; m < NB_MODES_PREEMPTION; m++) {
+        if (strcmp(nom, nom_mode_preemption((ModePreemption)m)) == 0) {
+            *mode = (ModePreemption)m;
+            return true;
+        }
+    }
+    return false;
+}
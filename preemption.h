@@ -0,0 +1,41 @@
+#ifndef PREEMPTION_H
+#define PREEMPTION_H
+
+#include <stdbool.h>
+#include "tache.h"
+
+// Préemption des instances commencées (politiques préemptives : priorités fixes et EDF)
+typedef enum {
+    PREEMPTION_TOTALE,        // Une instance plus prioritaire interrompt toujours l'instance en cours
+    PREEMPTION_AUCUNE,        // L'instance commencée garde le processeur jusqu'à sa terminaison
+    PREEMPTION_SEUILS,        // Seules les tâches de niveau supérieur au seuil de l'instance l'interrompent
+    PREEMPTION_POINTS,        // Interruption possible seulement entre deux tronçons d'exécution
+    NB_MODES_PREEMPTION
+} ModePreemption;
+
+// Réglages de la préemption d'une simulation (options des programmes)
+typedef struct {
+    ModePreemption mode;
+    temps_t points;           // Longueur des tronçons non préemptibles (PREEMPTION_POINTS)
+    temps_t commutation;      // Coût d'une commutation de contexte (0 : gratuite)
+} OptionsPreemption;
+
+// Niveau de préemption d'une tâche : nombre de tâches qu'elle précède, par
+// priorité (à priorité égale, le plus petit indice) ou par échéance relative
+int niveau_preemption(const ParametresTache *taches, int nb_taches, bool par_echeance, int i);
+
+// Analyses de la préemption limitée. Les seuils sont des niveaux de préemption
+// (seuils[i] >= niveau de i) ; points est la longueur des tronçons non préemptibles.
+long long temps_reponse_seuils(const ParametresTache *taches, int nb_taches, const int *seuils, int i);
+long long temps_reponse_points(const ParametresTache *taches, int nb_taches, long long points, int i);
+bool analyser_preemption_limitee(const ParametresTache *taches, int nb_taches, ModePreemption mode,
+                                 const int *seuils, long long points, long long *temps_reponse);
+bool analyser_demande_limitee(const ParametresTache *taches, int nb_taches, ModePreemption mode,
+                              const int *seuils, long long points, long long *intervalle_violation);
+bool calculer_seuils_preemption(const ParametresTache *taches, int nb_taches, bool edf, int *seuils);
+ParametresTache *parametres_avec_commutation(const ParametresTache *taches, int nb_taches, long long commutation);
+
+const char* nom_mode_preemption(ModePreemption mode);
+bool lire_mode_preemption(const char *nom, ModePreemption *mode);
+
+#endif
@@ -0,0 +1,323 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "analyse.h"
+#include "preemption.h"
+#include "ressources.h"
+
+#define TAILLE_LIGNE 256
+
+// Fonction de comparaison pour qsort : tâche croissante, puis début croissant
+static int comparer_sections(const void *a, const void *b) {
+    const SectionCritique *x = a;
+    const SectionCritique *y = b;
+    
+    if (x->tache != y->tache) {
+        return x->tache < y->tache ? -1 : 1;
+    }
+    return x->debut < y->debut ? -1 : x->debut > y->debut;
+}
+
+// Fonction pour trouver une ressource par son nom, ou l'ajouter (-1 si mémoire insuffisante)
+static int indice_ressource(JeuRessources *ressources, const char *nom, int *capacite) {
+    for (int r = 0; r < ressources->nb_ressources; r++) {
+        if (strcmp(ressources->noms[r], nom) == 0) {
+            return r;
+        }
+    }
+    if (ressources->nb_ressources == *capacite) {
+        int nouvelle = *capacite > 0 ? 2 * *capacite : 8;
+        char (*noms)[TAILLE_NOM_RESSOURCE] = realloc(ressources->noms, nouvelle * sizeof(*noms));
+        if (noms == NULL) {
+            return -1;
+        }
+        ressources->noms = noms;
+        *capacite = nouvelle;
+    }
+    strcpy(ressources->noms[ressources->nb_ressources], nom);
+    return ressources->nb_ressources++;
+}
+
+// Fonction pour charger les sections critiques d'un fichier texte : une ligne
+// "tache ressource debut duree" par section (tâche à partir de 1, ressource
+// désignée par son nom, debut et duree avec unité facultative ; les lignes
+// vides et celles commençant par # sont ignorées)
+bool ressources_charger(JeuRessources *ressources, const char *chemin, ProtocoleRessources protocole) {
+    FILE *fichier = fopen(chemin, "r");
+    char ligne[TAILLE_LIGNE];
+    int capacite_noms = 0;
+    int capacite_sections = 0;
+    int numero = 0;
+    
+    memset(ressources, 0, sizeof(*ressources));
+    ressources->protocole = protocole;
+    if (fichier == NULL) {
+        perror(chemin);
+        return false;
+    }
+    
+    while (fgets(ligne, sizeof(ligne), fichier) != NULL) {
+        char nom[TAILLE_NOM_RESSOURCE];
+        const char *p = ligne;
+        const char *fin;
+        int tache;
+        int position = 0;
+        SectionCritique section;
+        
+        numero++;
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+        if (sscanf(p, "%d %31s%n", &tache, nom, &position) != 2 ||
+            !isspace((unsigned char)p[position]) ||
+            !lire_temps(p + position, &section.debut, &fin) || !lire_temps(fin, &section.duree, &fin)) {
+            fprintf(stderr, "Ressources: ligne %d: \"tache ressource debut duree\" attendu\n", numero);
+            fclose(fichier);
+            ressources_liberer(ressources);
+            return false;
+        }
+        section.tache = tache - 1;
+        section.ressource = indice_ressource(ressources, nom, &capacite_noms);
+        
+        if (ressources->nb_sections == capacite_sections) {
+            int nouvelle = capacite_sections > 0 ? 2 * capacite_sections : 16;
+            SectionCritique *sections = realloc(ressources->sections, nouvelle * sizeof(SectionCritique));
+            if (sections == NULL) {
+                section.ressource = -1;
+            } else {
+                ressources->sections = sections;
+                capacite_sections = nouvelle;
+            }
+        }
+        if (section.ressource == -1) {
+            fprintf(stderr, "Ressources: memoire insuffisante\n");
+            fclose(fichier);
+            ressources_liberer(ressources);
+            return false;
+        }
+        ressources->sections[ressources->nb_sections++] = section;
+    }
+    
+    fclose(fichier);
+    qsort(ressources->sections, ressources->nb_sections, sizeof(SectionCritique), comparer_sections);
+    return true;
+}
+
+// Fonction pour vérifier les sections d'un jeu de tâches et calculer les
+// niveaux de préemption et les plafonds des ressources
+// Les niveaux sont ceux de la préemption limitée (niveau_preemption) : par
+// priorité, ou par échéance relative en EDF (SRP).
+bool ressources_preparer(JeuRessources *ressources, const ParametresTache *parametres, int nb_taches,
+                         bool niveaux_par_echeance) {
+    int taille = nb_taches > 0 ? nb_taches : 1;
+    int *premiere_section = realloc(ressources->premiere_section, (taille + 1) * sizeof(int));
+    
+    if (premiere_section != NULL) {
+        ressources->premiere_section = premiere_section;
+    }
+    int *niveau = realloc(ressources->niveau, taille * sizeof(int));
+    if (niveau != NULL) {
+        ressources->niveau = niveau;
+    }
+    int nb = ressources->nb_ressources > 0 ? ressources->nb_ressources : 1;
+    int *plafond = realloc(ressources->plafond, nb * sizeof(int));
+    if (plafond != NULL) {
+        ressources->plafond = plafond;
+    }
+    int *detenteur = realloc(ressources->detenteur, nb * sizeof(int));
+    if (detenteur != NULL) {
+        ressources->detenteur = detenteur;
+    }
+    if (premiere_section == NULL || niveau == NULL || plafond == NULL || detenteur == NULL) {
+        fprintf(stderr, "Ressources: memoire insuffisante\n");
+        return false;
+    }
+    if (ressources->protocole == PROTOCOLE_PCP && niveaux_par_echeance) {
+        fprintf(stderr, "Ressources: PCP suppose des priorites fixes (SRP avec EDF)\n");
+        return false;
+    }
+    ressources->nb_taches = nb_taches;
+    
+    // Sections : tâche existante, contenue dans C, sans chevauchement
+    for (int s = 0; s < ressources->nb_sections; s++) {
+        const SectionCritique *section = &ressources->sections[s];
+        int i = section->tache;
+        if (i < 0 || i >= nb_taches) {
+            fprintf(stderr, "Ressources: tache %d inconnue (%d taches)\n", i + 1, nb_taches);
+            return false;
+        }
+        if (section->duree <= 0 || section->debut + section->duree > parametres[i].duree_execution) {
+            fprintf(stderr, "Ressources: section de la tache %d sur %s hors de son execution (C=%lld)\n",
+                    i + 1, ressources->noms[section->ressource], parametres[i].duree_execution);
+            return false;
+        }
+        if (s > 0 && ressources->sections[s - 1].tache == i &&
+            ressources->sections[s - 1].debut + ressources->sections[s - 1].duree > section->debut) {
+            fprintf(stderr, "Ressources: sections imbriquees ou chevauchantes pour la tache %d\n", i + 1);
+            return false;
+        }
+    }
+    
+    for (int i = 0, s = 0; i <= nb_taches; i++) {
+        while (s < ressources->nb_sections && ressources->sections[s].tache < i) {
+            s++;
+        }
+        ressources->premiere_section[i] = s;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        ressources->niveau[i] = niveau_preemption(parametres, nb_taches, niveaux_par_echeance, i);
+    }
+    for (int r = 0; r < ressources->nb_ressources; r++) {
+        ressources->plafond[r] = -1;
+        ressources->detenteur[r] = -1;
+    }
+    for (int s = 0; s < ressources->nb_sections; s++) {
+        const SectionCritique *section = &ressources->sections[s];
+        if (ressources->niveau[section->tache] > ressources->plafond[section->ressource]) {
+            ressources->plafond[section->ressource] = ressources->niveau[section->tache];
+        }
+    }
+    return true;
+}
+
+// Fonction pour libérer les ressources
+void ressources_liberer(JeuRessources *ressources) {
+    free(ressources->noms);
+    free(ressources->sections);
+    free(ressources->premiere_section);
+    free(ressources->niveau);
+    free(ressources->plafond);
+    free(ressources->detenteur);
+    memset(ressources, 0, sizeof(*ressources));
+}
+
+// Fonction pour calculer les termes de blocage des priorités fixes : pire
+// durée pendant laquelle une instance de chaque tâche attend une tâche moins
+// prioritaire. Seules comptent les sections des tâches moins prioritaires sur
+// une ressource dont le plafond atteint le niveau de la tâche (blocage direct,
+// ou indirect par héritage).
+// - PCP et SRP : une seule section, la plus longue ;
+// - PIP : une section par tâche moins prioritaire et par ressource au plus,
+//   soit le minimum des deux sommes correspondantes ;
+// - sans protocole : non borné (BLOCAGE_NON_BORNE) dès qu'une telle section existe.
+// Renvoie false si un blocage n'est pas borné.
+bool ressources_blocages(const JeuRessources *ressources, int nb_taches, long long *blocages) {
+    bool bornes = true;
+    
+    for (int i = 0; i < nb_taches; i++) {
+        long long plus_longue = 0;
+        long long par_tache = 0;
+        long long par_ressource = 0;
+        
+        // Plus longue section bloquante de chaque tâche moins prioritaire
+        for (int j = 0; j < nb_taches; j++) {
+            long long plus_longue_j = 0;
+            if (ressources->niveau[j] >= ressources->niveau[i]) {
+                continue;
+            }
+            for (int s = ressources->premiere_section[j]; s < ressources->premiere_section[j + 1]; s++) {
+                const SectionCritique *section = &ressources->sections[s];
+                if (ressources->plafond[section->ressource] >= ressources->niveau[i] &&
+                    section->duree > plus_longue_j) {
+                    plus_longue_j = section->duree;
+                }
+            }
+            par_tache += plus_longue_j;
+            if (plus_longue_j > plus_longue) {
+                plus_longue = plus_longue_j;
+            }
+        }
+        
+        // Plus longue section bloquante sur chaque ressource
+        for (int r = 0; r < ressources->nb_ressources; r++) {
+            long long plus_longue_r = 0;
+            if (ressources->plafond[r] < ressources->niveau[i]) {
+                continue;
+            }
+            for (int s = 0; s < ressources->nb_sections; s++) {
+                const SectionCritique *section = &ressources->sections[s];
+                if (section->ressource == r && ressources->niveau[section->tache] < ressources->niveau[i] &&
+                    section->duree > plus_longue_r) {
+                    plus_longue_r = section->duree;
+                }
+            }
+            par_ressource += plus_longue_r;
+        }
+        
+        switch (ressources->protocole) {
+            case PROTOCOLE_PIP:
+                blocages[i] = par_ressource < par_tache ? par_ressource : par_tache;
+                break;
+            case PROTOCOLE_AUCUN:
+                blocages[i] = plus_longue > 0 ? BLOCAGE_NON_BORNE : 0;
+                bornes = bornes && plus_longue == 0;
+                break;
+            default:
+                blocages[i] = plus_longue;
+                break;
+        }
+    }
+    
+    return bornes;
+}
+
+// Fonction pour calculer le blocage B(t) de SRP sous EDF (Baker) : plus longue
+// section d'une tâche d'échéance relative supérieure à t sur une ressource
+// utilisée par une tâche d'échéance relative au plus t
+long long ressources_blocage_edf(const JeuRessources *ressources, const ParametresTache *parametres, long long t) {
+    long long blocage = 0;
+    
+    for (int s = 0; s < ressources->nb_sections; s++) {
+        const SectionCritique *section = &ressources->sections[s];
+        if (parametres[section->tache].echeance <= t || section->duree <= blocage) {
+            continue;
+        }
+        for (int k = 0; k < ressources->nb_sections; k++) {
+            const SectionCritique *autre = &ressources->sections[k];
+            if (autre->ressource == section->ressource && parametres[autre->tache].echeance <= t) {
+                blocage = section->duree;
+                break;
+            }
+        }
+    }
+    return blocage;
+}
+
+// Fonction pour adapter ressources_blocage_edf au test EDF avec blocage
+static long long blocage_srp(const void *contexte, const ParametresTache *parametres, int nb_taches, long long t) {
+    (void)nb_taches;
+    return ressources_blocage_edf(contexte, parametres, t);
+}
+
+// Fonction pour le test EDF + SRP : h(t) + B(t) <= t pour toute longueur t
+// (B(t) est nul à partir de la plus grande échéance relative)
+bool ressources_analyser_edf(const JeuRessources *ressources, const ParametresTache *parametres,
+                             int nb_taches, long long *intervalle_violation) {
+    return analyser_qpa_blocage(parametres, nb_taches, blocage_srp, ressources, intervalle_violation);
+}
+
+// Fonction pour obtenir le nom d'un protocole (options et affichages)
+const char* nom_protocole(ProtocoleRessources protocole) {
+    switch (protocole) {
+        case PROTOCOLE_AUCUN: return "aucun";
+        case PROTOCOLE_PIP:   return "pip";
+        case PROTOCOLE_PCP:   return "pcp";
+        case PROTOCOLE_SRP:   return "srp";
+        default:              return "?";
+    }
+}
+
+// Fonction pour lire un protocole à partir de son nom (false si inconnu)
+bool lire_protocole(const char *nom, ProtocoleRessources *protocole) {
+    for (int p = 0; p < NB_PROTOCOLES; p++) {
+        if (strcmp(nom, nom_protocole((ProtocoleRessources)p)) == 0) {
+            *protocole = (ProtocoleRessources)p;
+            return true;
+        }
+    }
+    return false;
+}
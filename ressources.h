@@ -0,0 +1,63 @@
+#ifndef RESSOURCES_H
+#define RESSOURCES_H
+
+#include <stdbool.h>
+#include "tache.h"
+
+// Protocoles d'accès aux ressources partagées
+typedef enum {
+    PROTOCOLE_AUCUN,          // Verrous simples : l'inversion de priorité n'est pas bornée
+    PROTOCOLE_PIP,            // Héritage de priorité : le détenteur hérite de la clé de la tâche bloquée
+    PROTOCOLE_PCP,            // Priorité plafond : verrouillage refusé sous le plafond du système (priorités fixes)
+    PROTOCOLE_SRP,            // Stack Resource Policy : démarrage refusé sous le plafond du système
+    NB_PROTOCOLES
+} ProtocoleRessources;
+
+#define TAILLE_NOM_RESSOURCE 32
+
+// Blocage d'une tâche que le protocole ne borne pas
+#define BLOCAGE_NON_BORNE (-1LL)
+
+// Section critique : l'instance détient la ressource pendant duree unités
+// d'exécution, à partir de debut unités d'exécution depuis son démarrage.
+// Les sections d'une même tâche se suivent sans s'imbriquer.
+typedef struct {
+    int tache;                // Indice de la tâche (à partir de 0)
+    int ressource;            // Indice de la ressource
+    temps_t debut;
+    temps_t duree;
+} SectionCritique;
+
+// Ressources partagées d'un jeu de tâches, dans l'unité des paramètres
+typedef struct {
+    ProtocoleRessources protocole;
+    char (*noms)[TAILLE_NOM_RESSOURCE];
+    int nb_ressources;
+    SectionCritique *sections; // Triées par tâche puis par début
+    int nb_sections;
+    
+    // Calculés par ressources_preparer pour un jeu de nb_taches tâches
+    int nb_taches;
+    int *premiere_section;    // Première section de chaque tâche (nb_taches + 1 entrées)
+    int *niveau;              // Niveau de préemption (rang de priorité, ou d'échéance en EDF)
+    int *plafond;             // Plus haut niveau des tâches utilisant la ressource (-1 : inutilisée)
+    
+    // État de la simulation
+    int *detenteur;           // Tâche détenant chaque ressource (-1 : libre)
+} JeuRessources;
+
+bool ressources_charger(JeuRessources *ressources, const char *chemin, ProtocoleRessources protocole);
+bool ressources_preparer(JeuRessources *ressources, const ParametresTache *parametres, int nb_taches,
+                         bool niveaux_par_echeance);
+void ressources_liberer(JeuRessources *ressources);
+
+// Termes de blocage des analyses (ressources préparées)
+bool ressources_blocages(const JeuRessources *ressources, int nb_taches, long long *blocages);
+long long ressources_blocage_edf(const JeuRessources *ressources, const ParametresTache *parametres, long long t);
+bool ressources_analyser_edf(const JeuRessources *ressources, const ParametresTache *parametres,
+                             int nb_taches, long long *intervalle_violation);
+
+const char* nom_protocole(ProtocoleRessources protocole);
+bool lire_protocole(const char *nom, ProtocoleRessources *protocole);
+
+#endif
@@ -0,0 +1,189 @@
+#include <string.h>
+#include "analyse.h"
+#include "sensibilite.h"
+
+// Fonction pour copier un jeu dans le tampon de travail et calculer ses priorités
+// (HPF garde les priorités données, EDF n'en utilise pas). Les priorités RM et
+// DM ne dépendent pas de C : elles restent valables pendant toute la recherche.
+static void preparer_travail(TypeOrdonnanceur algorithme, const ParametresTache *taches, int nb_taches,
+                             ParametresTache *travail) {
+    memcpy(travail, taches, nb_taches * sizeof(ParametresTache));
+    if (algorithme == RM) {
+        calculer_priorites_rm(travail, nb_taches);
+    } else if (algorithme == DM) {
+        calculer_priorites_dm(travail, nb_taches);
+    }
+}
+
+// Fonction pour le test suffisant EDF de Devi : avec U <= 1, la demande est
+// bornée par dbf(t) <= C + U(t - D) pour t >= D, et la somme de ces bornes
+// moins t ne croît qu'aux échéances. Les points testés par la dichotomie sont
+// souvent proches de U = 1, où QPA doit remonter un long intervalle : ce test
+// en O(n²) l'évite presque toujours.
+static bool borne_lineaire_edf(const ParametresTache *taches, int nb_taches) {
+    if (facteur_utilisation(taches, nb_taches) > 1.0) {
+        return false;
+    }
+    for (int k = 0; k < nb_taches; k++) {
+        double demande = 0.0;
+        for (int j = 0; j < nb_taches; j++) {
+            if (taches[j].echeance <= taches[k].echeance) {
+                demande += taches[j].duree_execution + (double)taches[j].duree_execution *
+                           (taches[k].echeance - taches[j].echeance) / taches[j].periode;
+            }
+        }
+        if (demande * (1.0 + 1e-9) > taches[k].echeance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Fonction pour appliquer le test exact de l'algorithme à un jeu préparé
+static bool test_exact(TypeOrdonnanceur algorithme, const ParametresTache *travail, int nb_taches) {
+    if (algorithme == EDF) {
+        return borne_lineaire_edf(travail, nb_taches) || analyser_qpa(travail, nb_taches, NULL);
+    }
+    return analyser_temps_reponse(travail, nb_taches, NULL);
+}
+
+// Fonction pour savoir si la tâche j passe avant la tâche i (même départage
+// que l'analyse des temps de réponse et la simulation)
+static inline bool passe_avant(const ParametresTache *taches, int j, int i) {
+    return taches[j].priorite > taches[i].priorite ||
+           (taches[j].priorite == taches[i].priorite && j < i);
+}
+
+// Fonction pour savoir si la tâche j d'un jeu en priorités fixes respecte son échéance
+static bool reponse_respectee(const ParametresTache *travail, int nb_taches, int j) {
+    long long reponse = temps_reponse_tache(travail, nb_taches, j);
+    
+    return reponse >= 0 && reponse <= travail[j].echeance;
+}
+
+// Fonction pour tester un jeu préparé dont seule la tâche i a changé
+// En priorités fixes, seules i et les tâches qu'elle précède sont touchées.
+// Une utilisation supérieure à 1 est rejetée d'emblée : la période d'activité
+// ne se termine pas et la RTA ne s'arrêterait qu'au premier dépassement.
+static bool test_tache(TypeOrdonnanceur algorithme, const ParametresTache *travail, int nb_taches, int i) {
+    if (algorithme == EDF) {
+        return test_exact(algorithme, travail, nb_taches);
+    }
+    if (facteur_utilisation(travail, nb_taches) > 1.0 + 1e-12) {
+        return false;
+    }
+    for (int j = 0; j < nb_taches; j++) {
+        if ((j == i || !passe_avant(travail, j, i)) &&
+            !reponse_respectee(travail, nb_taches, j)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Fonction pour savoir si un jeu est ordonnançable par l'algorithme (HPF, RM, DM ou EDF)
+// travail doit pouvoir contenir nb_taches tâches.
+bool sensibilite_ordonnancable(TypeOrdonnanceur algorithme, const ParametresTache *taches, int nb_taches,
+                               ParametresTache *travail) {
+    preparer_travail(algorithme, taches, nb_taches, travail);
+    return test_exact(algorithme, travail, nb_taches);
+}
+
+// Fonction pour calculer le facteur critique : le plus grand α tel que le jeu
+// dont toutes les durées sont multipliées par α reste ordonnançable (α < 1 : le
+// jeu ne l'est pas, il faut réduire les durées). Le jeu est mis à l'échelle
+// R = RESOLUTION_FACTEUR (C·k, D·R, T·R) pour tester α = k/R en entiers ; la
+// dichotomie porte sur k, borné par k·C <= D·R et k·U <= R.
+// L'utilisation limite (breakdown utilisation) est U·α.
+double facteur_critique(TypeOrdonnanceur algorithme, const ParametresTache *taches, int nb_taches,
+                        ParametresTache *travail) {
+    temps_t temps_max = 1;
+    
+    if (nb_taches == 0) {
+        return 0.0;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        temps_t temps = taches[i].echeance > taches[i].periode ? taches[i].echeance : taches[i].periode;
+        if (temps > temps_max) {
+            temps_max = temps;
+        }
+    }
+    int resolution = RESOLUTION_FACTEUR;
+    while (resolution > 1 && temps_max > TEMPS_PARAMETRE_MAX / resolution) {
+        resolution /= 10;
+    }
+    
+    long long haut = (long long)(resolution / facteur_utilisation(taches, nb_taches) * (1.0 + 1e-12));
+    for (int i = 0; i < nb_taches; i++) {
+        long long limite = (long long)taches[i].echeance * resolution / taches[i].duree_execution;
+        if (limite < haut) {
+            haut = limite;
+        }
+    }
+    
+    preparer_travail(algorithme, taches, nb_taches, travail);
+    for (int i = 0; i < nb_taches; i++) {
+        travail[i].echeance = taches[i].echeance * resolution;
+        travail[i].periode = taches[i].periode * resolution;
+    }
+    
+    // Invariant : k = bas est ordonnançable (k = 0 trivialement), k > haut ne l'est pas
+    long long bas = 0;
+    while (bas < haut) {
+        long long k = bas + (haut - bas + 1) / 2;
+        for (int i = 0; i < nb_taches; i++) {
+            travail[i].duree_execution = taches[i].duree_execution * k;
+        }
+        if (test_exact(algorithme, travail, nb_taches)) {
+            bas = k;
+        } else {
+            haut = k - 1;
+        }
+    }
+    return (double)bas / resolution;
+}
+
+// Fonction pour calculer la marge de la tâche i : la plus grande variation ΔC
+// (négative si le jeu n'est pas ordonnançable) telle que le jeu reste
+// ordonnançable lorsque seule Ci devient Ci + ΔC, avec 1 <= Ci + ΔC <= min(Di, Ti).
+// Renvoie MARGE_IMPOSSIBLE si aucune valeur de Ci ne convient (en priorités
+// fixes, par exemple, une tâche plus prioritaire manque déjà son échéance).
+temps_t marge_tache(TypeOrdonnanceur algorithme, const ParametresTache *taches, int nb_taches, int i,
+                ParametresTache *travail) {
+    temps_t duree = taches[i].duree_execution;
+    
+    preparer_travail(algorithme, taches, nb_taches, travail);
+    if (algorithme != EDF) {
+        for (int j = 0; j < nb_taches; j++) {
+            if (j != i && passe_avant(travail, j, i) &&
+                !reponse_respectee(travail, nb_taches, j)) {
+                return MARGE_IMPOSSIBLE;
+            }
+        }
+    }
+    
+    // Borne haute : Ci <= min(Di, Ti) et l'utilisation totale ne dépasse pas 1
+    double reste = (1.0 - facteur_utilisation(taches, nb_taches)) * taches[i].periode + duree;
+    temps_t bas = 1;
+    temps_t haut = taches[i].echeance < taches[i].periode ? taches[i].echeance : taches[i].periode;
+    if (reste * (1.0 + 1e-12) < haut) {
+        haut = (temps_t)(reste * (1.0 + 1e-12));
+    }
+    if (haut < bas) {
+        return MARGE_IMPOSSIBLE;
+    }
+    travail[i].duree_execution = bas;
+    if (!test_tache(algorithme, travail, nb_taches, i)) {
+        return MARGE_IMPOSSIBLE;
+    }
+    while (bas < haut) {
+        temps_t c = bas + (haut - bas + 1) / 2;
+        travail[i].duree_execution = c;
+        if (test_tache(algorithme, travail, nb_taches, i)) {
+            bas = c;
+        } else {
+            haut = c - 1;
+        }
+    }
+    return bas - duree;
+}
@@ -0,0 +1,29 @@
+#ifndef SENSIBILITE_H
+#define SENSIBILITE_H
+
+#include <stdbool.h>
+#include <limits.h>
+#include "tache.h"
+#include "moteur-simulation.h"
+
+// Analyse de sensibilité : de combien les durées d'exécution peuvent-elles
+// croître (ou doivent-elles décroître) pour que le jeu reste ordonnançable ?
+// Chaque recherche est une dichotomie sur un test analytique exact (RTA pour
+// HPF, RM et DM, QPA pour EDF), les tests étant monotones en C.
+
+// Le facteur critique est un multiple de 1/RESOLUTION_FACTEUR (moins fin si
+// les échéances ou périodes sont trop grandes pour être mises à l'échelle sans
+// dépasser TEMPS_PARAMETRE_MAX)
+#define RESOLUTION_FACTEUR 10000
+
+// Marge d'une tâche qui ne devient pas ordonnançable même réduite à C = 1
+#define MARGE_IMPOSSIBLE LLONG_MIN
+
+bool sensibilite_ordonnancable(TypeOrdonnanceur algorithme, const ParametresTache *taches, int nb_taches,
+                               ParametresTache *travail);
+double facteur_critique(TypeOrdonnanceur algorithme, const ParametresTache *taches, int nb_taches,
+                        ParametresTache *travail);
+temps_t marge_tache(TypeOrdonnanceur algorithme, const ParametresTache *taches, int nb_taches, int i,
+                ParametresTache *travail);
+
+#endif
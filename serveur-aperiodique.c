@@ -0,0 +1,271 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "tache.h"
+#include "analyse.h"
+#include "lot-taches.h"
+#include "serveurs.h"
+
+// Nombre maximal de budgets essayés par jeu
+#define BUDGETS_MAX 64
+
+// Configuration de la ligne de commande
+typedef struct {
+    const char *chemin_lot;
+    const char *chemin_arrivees;
+    const char *chemin_sortie;
+    ParametresServeur serveur;
+    temps_t budgets[BUDGETS_MAX];    // Budgets essayés (aucun : budget maximal garanti)
+    int nb_budgets;
+    GenerationFlux generation;       // Flux de Poisson si intervalle > 0
+    uint64_t graine;
+    temps_t horizon;                 // 0 : dernière arrivée + hyperpériode
+} Configuration;
+
+// Fonction pour lire une durée de la ligne de commande (unité facultative)
+static bool lire_duree(const char *texte, temps_t *duree) {
+    const char *fin;
+    
+    return lire_temps(texte, duree, &fin) && *fin == '\0' && *duree >= 0 && *duree <= TEMPS_PARAMETRE_MAX;
+}
+
+// Fonction pour lire une liste de budgets séparés par des virgules ("1ms,2ms")
+static bool lire_budgets(const char *texte, Configuration *configuration) {
+    configuration->nb_budgets = 0;
+    for (const char *c = texte; ; c++) {
+        temps_t *budget = &configuration->budgets[configuration->nb_budgets];
+        if (configuration->nb_budgets == BUDGETS_MAX || !lire_temps(c, budget, &c) ||
+            (*c != ',' && *c != '\0') || *budget <= 0 || *budget > TEMPS_PARAMETRE_MAX) {
+            return false;
+        }
+        configuration->nb_budgets++;
+        if (*c == '\0') {
+            return true;
+        }
+    }
+}
+
+// Fonction pour obtenir l'horizon de simulation d'un jeu : celui demandé, ou
+// la dernière arrivée du flux plus l'hyperpériode du jeu et du serveur (deux
+// fois la plus grande période si l'hyperpériode dépasse les paramètres)
+static temps_t horizon_jeu(const Configuration *configuration, const ParametresTache *jeu, int n,
+                           const FluxAperiodique *flux) {
+    temps_t derniere = flux->nb_requetes > 0 ? flux->requetes[flux->nb_requetes - 1].arrivee : 0;
+    temps_t periode_max = configuration->serveur.periode;
+    long long h = 1;
+    
+    if (configuration->horizon > 0) {
+        return configuration->horizon;
+    }
+    for (int i = 0; i < n; i++) {
+        periode_max = jeu[i].periode > periode_max ? jeu[i].periode : periode_max;
+    }
+    if (!hyperperiode(jeu, n, &h) || h > TEMPS_PARAMETRE_MAX) {
+        return derniere + 2 * periode_max;
+    }
+    h = h / pgcd_temps(h, configuration->serveur.periode) * configuration->serveur.periode;
+    return derniere + (h <= TEMPS_PARAMETRE_MAX ? h : 2 * periode_max);
+}
+
+// Fonction pour évaluer un jeu avec chaque budget : garantie analytique, puis
+// simulation du flux et percentiles des temps de réponse des requêtes
+static bool evaluer_jeu(FILE *sortie, const Configuration *configuration, long numero,
+                        const ParametresTache *jeu, int n, const FluxAperiodique *flux) {
+    ParametresServeur serveur = configuration->serveur;
+    temps_t budget_max = budget_maximal(jeu, n, &serveur);
+    temps_t horizon = horizon_jeu(configuration, jeu, n, flux);
+    int nb_budgets = configuration->nb_budgets > 0 ? configuration->nb_budgets : 1;
+    
+    for (int b = 0; b < nb_budgets; b++) {
+        ResultatServeur resultat;
+        
+        serveur.budget = configuration->nb_budgets > 0 ? configuration->budgets[b] : budget_max;
+        fprintf(sortie, "%ld,%d,%s,%lld,%lld,%lld,", numero, n, nom_serveur(serveur.type),
+                serveur.periode, budget_max, serveur.budget);
+        
+        // Aucun budget ne garantit les tâches : rien à simuler
+        if (serveur.budget == 0) {
+            fprintf(sortie, "non_garanti,-,-,-,-,-,-,-,-,-\n");
+            continue;
+        }
+        if (!simuler_serveur(jeu, n, &serveur, flux, horizon, &resultat)) {
+            return false;
+        }
+        
+        const Histogramme *reponse = &resultat.reponse;
+        fprintf(sortie, "%s,%lld,%lld,", serveur_garanti(jeu, n, &serveur) ? "garanti" : "non_garanti",
+                resultat.requetes, reponse->nombre);
+        if (reponse->nombre > 0) {
+            fprintf(sortie, "%.1f,%lld,%lld,%lld,%lld,", histogramme_moyenne(reponse),
+                    histogramme_quantile(reponse, 0.50), histogramme_quantile(reponse, 0.90),
+                    histogramme_quantile(reponse, 0.99), reponse->max);
+        } else {
+            fprintf(sortie, "-,-,-,-,-,");
+        }
+        fprintf(sortie, "%lld,%lld\n", resultat.requetes_en_retard, resultat.echeances_manquees);
+    }
+    return !ferror(sortie);
+}
+
+// Fonction pour afficher l'aide de la ligne de commande
+static void afficher_usage(const char *programme) {
+    printf("Usage: %s --lot FICHIER --serveur TYPE --periode DUREE [options]\n\n", programme);
+    printf("Sert un flux de requetes aperiodiques a cote de chaque jeu du lot et mesure\n");
+    printf("leurs temps de reponse ; verifie que les taches periodiques restent garanties.\n");
+    printf("Les durees acceptent une unite (ns, us, ms, s).\n\n");
+    printf("  --lot FICHIER            jeux de taches (format texte ou binaire)\n");
+    printf("  --serveur TYPE           scrutation, differe, sporadique (RM/DM), tbs, cbs (EDF)\n");
+    printf("  --algo rm|dm             priorites des serveurs a priorites fixes (defaut: rm)\n");
+    printf("  --periode DUREE          periode Ts du serveur\n");
+    printf("  --budget LISTE           budgets Qs essayes, separes par des virgules\n");
+    printf("                           (defaut: plus grand budget garanti par l'analyse)\n");
+    printf("  --arrivees FICHIER       requetes \"arrivee duree [echeance]\", une par ligne\n");
+    printf("  --poisson DUREE          arrivees de Poisson d'intervalle moyen DUREE\n");
+    printf("  --duree-moyenne DUREE    duree moyenne des requetes de Poisson (exponentielle)\n");
+    printf("  --separation DUREE       intervalle minimal entre deux arrivees (defaut: 0)\n");
+    printf("  --echeance DUREE         echeance relative des requetes de Poisson (defaut: aucune)\n");
+    printf("  --graine N               graine du generateur (defaut: 1)\n");
+    printf("  --horizon DUREE          duree simulee (obligatoire avec --poisson ; defaut:\n");
+    printf("                           derniere arrivee + hyperperiode avec le serveur)\n");
+    printf("  --sortie FICHIER         ecrire le CSV dans un fichier (defaut: sortie standard)\n\n");
+    printf("Colonnes : jeu,taches,serveur,periode,budget_max,budget,garantie,requetes,servies,\n");
+    printf("reponse_moyenne,p50,p90,p99,max,requetes_en_retard,echeances_periodiques.\n");
+}
+
+int main(int argc, char **argv) {
+    Configuration configuration = { .serveur = { NB_SERVEURS, 0, 0, false }, .graine = 1 };
+    
+    for (int i = 1; i < argc; i++) {
+        const char *valeur = i + 1 < argc ? argv[i + 1] : NULL;
+        temps_t *duree = NULL;
+        
+        if (strcmp(argv[i], "--aide") == 0 || strcmp(argv[i], "-h") == 0) {
+            afficher_usage(argv[0]);
+            return 0;
+        } else if (valeur == NULL) {
+            fprintf(stderr, "Option %s incomplete\n", argv[i]);
+            return 1;
+        } else if (strcmp(argv[i], "--lot") == 0) {
+            configuration.chemin_lot = valeur;
+        } else if (strcmp(argv[i], "--serveur") == 0) {
+            if (!lire_type_serveur(valeur, &configuration.serveur.type)) {
+                fprintf(stderr, "Serveur inconnu: %s\n", valeur);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--algo") == 0) {
+            if (strcmp(valeur, "rm") != 0 && strcmp(valeur, "dm") != 0) {
+                fprintf(stderr, "Algorithme inconnu: %s\n", valeur);
+                return 1;
+            }
+            configuration.serveur.dm = strcmp(valeur, "dm") == 0;
+        } else if (strcmp(argv[i], "--budget") == 0) {
+            if (!lire_budgets(valeur, &configuration)) {
+                fprintf(stderr, "Budgets invalides: %s\n", valeur);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--arrivees") == 0) {
+            configuration.chemin_arrivees = valeur;
+        } else if (strcmp(argv[i], "--graine") == 0) {
+            configuration.graine = strtoull(valeur, NULL, 10);
+        } else if (strcmp(argv[i], "--sortie") == 0) {
+            configuration.chemin_sortie = valeur;
+        } else if (strcmp(argv[i], "--periode") == 0) {
+            duree = &configuration.serveur.periode;
+        } else if (strcmp(argv[i], "--poisson") == 0) {
+            duree = &configuration.generation.intervalle;
+        } else if (strcmp(argv[i], "--duree-moyenne") == 0) {
+            duree = &configuration.generation.duree;
+        } else if (strcmp(argv[i], "--separation") == 0) {
+            duree = &configuration.generation.separation;
+        } else if (strcmp(argv[i], "--echeance") == 0) {
+            duree = &configuration.generation.echeance;
+        } else if (strcmp(argv[i], "--horizon") == 0) {
+            duree = &configuration.horizon;
+        } else {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            afficher_usage(argv[0]);
+            return 1;
+        }
+        if (duree != NULL && !lire_duree(valeur, duree)) {
+            fprintf(stderr, "Duree invalide: %s\n", valeur);
+            return 1;
+        }
+        i++;
+    }
+    
+    GenerationFlux *generation = &configuration.generation;
+    bool poisson = generation->intervalle > 0;
+    if (configuration.chemin_lot == NULL || configuration.serveur.type == NB_SERVEURS ||
+        configuration.serveur.periode <= 0 || poisson == (configuration.chemin_arrivees != NULL) ||
+        (poisson && (generation->duree <= 0 || configuration.horizon <= 0))) {
+        afficher_usage(argv[0]);
+        return 1;
+    }
+    for (int b = 0; b < configuration.nb_budgets; b++) {
+        if (configuration.budgets[b] > configuration.serveur.periode) {
+            fprintf(stderr, "Budget superieur a la periode du serveur: %lld\n", configuration.budgets[b]);
+            return 1;
+        }
+    }
+    
+    // Le même flux sert à tous les jeux et à tous les budgets
+    FluxAperiodique flux;
+    if (poisson) {
+        GenerateurAleatoire alea;
+        alea_initialiser(&alea, configuration.graine);
+        generation->horizon = configuration.horizon;
+        if (!flux_generer(&flux, generation, &alea)) {
+            fprintf(stderr, "Memoire insuffisante\n");
+            return 1;
+        }
+    } else if (!flux_charger(&flux, configuration.chemin_arrivees)) {
+        return 1;
+    }
+    
+    LecteurLot lecteur;
+    if (!lot_ouvrir(&lecteur, configuration.chemin_lot)) {
+        flux_liberer(&flux);
+        return 1;
+    }
+    FILE *sortie = configuration.chemin_sortie != NULL ? fopen(configuration.chemin_sortie, "w") : stdout;
+    if (sortie == NULL) {
+        perror(configuration.chemin_sortie);
+        lot_fermer(&lecteur);
+        flux_liberer(&flux);
+        return 1;
+    }
+    
+    int code = 0;
+    int lu;
+    
+    fprintf(sortie, "jeu,taches,serveur,periode,budget_max,budget,garantie,requetes,servies,"
+                    "reponse_moyenne,p50,p90,p99,max,requetes_en_retard,echeances_periodiques\n");
+    while (code == 0 && (lu = lot_lire_jeu(&lecteur)) == 1) {
+        int n = lecteur.nb_taches;
+        
+        if (!lot_parametres_valides(lecteur.parametres, n)) {
+            fprintf(sortie, "%ld,%d,%s,%lld,-,-,invalide,-,-,-,-,-,-,-,-,-\n", lecteur.numero, n,
+                    nom_serveur(configuration.serveur.type), configuration.serveur.periode);
+            continue;
+        }
+        if (!evaluer_jeu(sortie, &configuration, lecteur.numero, lecteur.parametres, n, &flux)) {
+            code = 1;
+        }
+    }
+    if (code != 0) {
+        fprintf(stderr, "Memoire insuffisante ou erreur d'ecriture\n");
+    }
+    if (lecteur.erreur) {
+        code = 1;
+    }
+    
+    if (sortie != stdout && fclose(sortie) != 0) {
+        perror(configuration.chemin_sortie);
+        code = 1;
+    }
+    lot_fermer(&lecteur);
+    flux_liberer(&flux);
+    return code;
+}
@@ -0,0 +1,602 @@
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tas.h"
+#include "analyse.h"
+#include "serveurs.h"
+
+// Taille maximale d'une ligne du fichier d'arrivées
+#define TAILLE_LIGNE 256
+
+// Tolérance sur les sommes d'utilisations (erreurs d'arrondi)
+#define EPSILON_UTILISATION 1e-9
+
+// Nombre maximal d'échéances parcourues par le test de demande des serveurs EDF
+#define POINTS_DEMANDE_MAX 1000000LL
+
+static const char *noms_serveurs[NB_SERVEURS] = { "scrutation", "differe", "sporadique", "tbs", "cbs" };
+
+// État d'une tâche périodique : ses instances en attente ont été activées à
+// premiere_activation, + T, + 2T, ... et seule la première est commencée
+typedef struct {
+    temps_t prochaine_activation;
+    temps_t premiere_activation;
+    temps_t temps_restant;    // Temps restant de la première instance en attente
+    long long en_attente;
+} EtatPeriodique;
+
+// Recharge différée d'un serveur sporadique
+typedef struct {
+    temps_t date;
+    temps_t montant;
+} Recharge;
+
+// État du serveur et de sa file de requêtes (requêtes tete à arrivees - 1)
+typedef struct {
+    const ParametresServeur *parametres;
+    long long cle_fixe;       // Priorités fixes : clé du serveur dans la file des prêts
+    temps_t budget;
+    temps_t echeance;         // EDF : échéance de la requête en tête (TBS) ou du serveur (CBS)
+    int tete;                 // Première requête non terminée
+    int arrivees;             // Requêtes arrivées
+    temps_t restant;          // Temps restant de la requête en tête
+    temps_t prochaine_recharge; // Scrutation, différé : prochaine période ; sporadique : prochaine recharge
+    
+    // Serveur sporadique : activité en cours et recharges planifiées (par date croissante)
+    bool actif;
+    bool recharge;            // Budget rechargé à l'instant courant
+    temps_t debut_activite;
+    temps_t consomme;
+    Recharge *recharges;
+    int premiere_recharge;
+    int nb_recharges;
+    int capacite_recharges;
+} EtatServeur;
+
+// Fonction pour obtenir le nom d'un serveur
+const char *nom_serveur(TypeServeur type) {
+    return type < NB_SERVEURS ? noms_serveurs[type] : "inconnu";
+}
+
+// Fonction pour lire un type de serveur depuis son nom
+bool lire_type_serveur(const char *nom, TypeServeur *type) {
+    for (int s = 0; s < NB_SERVEURS; s++) {
+        if (strcmp(nom, noms_serveurs[s]) == 0) {
+            *type = (TypeServeur)s;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Fonction pour savoir si un serveur est ordonnancé par EDF
+static bool serveur_edf(TypeServeur type) {
+    return type == SERVEUR_TBS || type == SERVEUR_CBS;
+}
+
+// Fonction pour ajouter une requête à la fin d'un flux (capacité doublée si besoin)
+static bool flux_ajouter(FluxAperiodique *flux, RequeteAperiodique requete) {
+    if (flux->nb_requetes == flux->capacite) {
+        int capacite = flux->capacite > 0 ? 2 * flux->capacite : 256;
+        RequeteAperiodique *requetes = realloc(flux->requetes, capacite * sizeof(RequeteAperiodique));
+        if (requetes == NULL) {
+            return false;
+        }
+        flux->requetes = requetes;
+        flux->capacite = capacite;
+    }
+    flux->requetes[flux->nb_requetes++] = requete;
+    return true;
+}
+
+// Fonction pour comparer deux requêtes par date d'arrivée, puis durée
+static int comparer_requetes(const void *a, const void *b) {
+    const RequeteAperiodique *ra = a;
+    const RequeteAperiodique *rb = b;
+    
+    if (ra->arrivee != rb->arrivee) {
+        return ra->arrivee < rb->arrivee ? -1 : 1;
+    }
+    return (ra->duree > rb->duree) - (ra->duree < rb->duree);
+}
+
+// Fonction pour libérer un flux
+void flux_liberer(FluxAperiodique *flux) {
+    free(flux->requetes);
+    memset(flux, 0, sizeof(*flux));
+}
+
+// Fonction pour charger un flux de requêtes : une ligne "arrivee duree [echeance]"
+// par requête (unité facultative), lignes vides et commentaires (#) ignorés.
+// Les requêtes sont triées par date d'arrivée.
+bool flux_charger(FluxAperiodique *flux, const char *chemin) {
+    FILE *fichier = fopen(chemin, "r");
+    char ligne[TAILLE_LIGNE];
+    int numero = 0;
+    
+    memset(flux, 0, sizeof(*flux));
+    if (fichier == NULL) {
+        perror(chemin);
+        return false;
+    }
+    
+    while (fgets(ligne, sizeof(ligne), fichier) != NULL) {
+        RequeteAperiodique requete = { 0, 0, 0 };
+        const char *p = ligne;
+        const char *fin;
+        
+        numero++;
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+        bool valide = lire_temps(p, &requete.arrivee, &fin) && lire_temps(fin, &requete.duree, &fin);
+        if (valide && !lire_temps(fin, &requete.echeance, &p)) {
+            requete.echeance = 0;
+            p = fin;
+        }
+        while (valide && isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (!valide || (*p != '\0' && *p != '#') || requete.arrivee > TEMPS_PARAMETRE_MAX ||
+            requete.duree <= 0 || requete.duree > TEMPS_PARAMETRE_MAX || requete.echeance > TEMPS_PARAMETRE_MAX) {
+            fprintf(stderr, "Arrivees: ligne %d: \"arrivee duree [echeance]\" attendu\n", numero);
+            fclose(fichier);
+            flux_liberer(flux);
+            return false;
+        }
+        if (!flux_ajouter(flux, requete)) {
+            fprintf(stderr, "Arrivees: memoire insuffisante\n");
+            fclose(fichier);
+            flux_liberer(flux);
+            return false;
+        }
+    }
+    
+    fclose(fichier);
+    qsort(flux->requetes, flux->nb_requetes, sizeof(RequeteAperiodique), comparer_requetes);
+    return true;
+}
+
+// Fonction pour tirer une durée exponentielle de moyenne donnée (au moins minimum)
+static temps_t tirer_exponentielle(GenerateurAleatoire *alea, temps_t moyenne, temps_t minimum) {
+    double tirage = -log(1.0 - alea_uniforme(alea)) * (double)moyenne;
+    temps_t valeur = tirage < (double)TEMPS_PARAMETRE_MAX ? (temps_t)(tirage + 0.5) : TEMPS_PARAMETRE_MAX;
+    
+    return valeur > minimum ? valeur : minimum;
+}
+
+// Fonction pour générer un flux de Poisson (reproductible pour une graine donnée)
+bool flux_generer(FluxAperiodique *flux, const GenerationFlux *generation, GenerateurAleatoire *alea) {
+    temps_t arrivee = 0;
+    
+    memset(flux, 0, sizeof(*flux));
+    for (;;) {
+        arrivee += tirer_exponentielle(alea, generation->intervalle, generation->separation);
+        if (arrivee >= generation->horizon) {
+            return true;
+        }
+        RequeteAperiodique requete = { arrivee, tirer_exponentielle(alea, generation->duree, 1),
+                                       generation->echeance };
+        if (!flux_ajouter(flux, requete)) {
+            flux_liberer(flux);
+            return false;
+        }
+    }
+}
+
+// Fonction pour construire le jeu analysé : les tâches puis le serveur, vu
+// comme une tâche (Qs, Ts, Ts) ; priorités RM ou DM pour les serveurs à
+// priorités fixes. Renvoie NULL si la mémoire manque.
+static ParametresTache *jeu_avec_serveur(const ParametresTache *taches, int nb_taches,
+                                         const ParametresServeur *serveur) {
+    ParametresTache *jeu = malloc((nb_taches + 1) * sizeof(ParametresTache));
+    
+    if (jeu == NULL) {
+        return NULL;
+    }
+    memcpy(jeu, taches, nb_taches * sizeof(ParametresTache));
+    jeu[nb_taches] = (ParametresTache){ serveur->budget, serveur->periode, serveur->periode, 0, 0 };
+    if (!serveur_edf(serveur->type) && serveur->dm) {
+        calculer_priorites_dm(jeu, nb_taches + 1);
+    } else if (!serveur_edf(serveur->type)) {
+        calculer_priorites_rm(jeu, nb_taches + 1);
+    }
+    return jeu;
+}
+
+// Fonction pour vérifier que des tâches EDF respectent leurs échéances à côté
+// d'un serveur de bande passante Us = Qs / Ts, dont la demande sur tout
+// intervalle de longueur t ne dépasse pas Us t (TBS, CBS) : h(t) <= (1 - Us) t
+// aux échéances t <= L = Σ (Ti - Di) Ui / (1 - U - Us). Si L est trop grand
+// (U + Us proche de 1), test de densité Σ Ci / min(Di, Ti) + Us <= 1 (suffisant).
+static bool bande_garantie(const ParametresTache *taches, int nb_taches, const ParametresServeur *serveur) {
+    double bande = (double)serveur->budget / serveur->periode;
+    double reste = 1.0 - bande - facteur_utilisation(taches, nb_taches);
+    double borne = 0.0;
+    double densite = bande;
+    long long points = 0;
+    
+    if (reste < -EPSILON_UTILISATION) {
+        return false;
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        const ParametresTache *t = &taches[i];
+        if (t->echeance < t->periode) {
+            borne += (double)(t->periode - t->echeance) * t->duree_execution / t->periode;
+        }
+        densite += (double)t->duree_execution / (t->echeance < t->periode ? t->echeance : t->periode);
+    }
+    // Échéances contraintes absentes : U + Us <= 1 suffit
+    if (borne == 0.0) {
+        return true;
+    }
+    borne = reste > EPSILON_UTILISATION ? borne / reste : -1.0;
+    for (int i = 0; borne >= 0.0 && i < nb_taches; i++) {
+        if (borne >= taches[i].echeance) {
+            points += (long long)((borne - taches[i].echeance) / taches[i].periode) + 1;
+        }
+        borne = points <= POINTS_DEMANDE_MAX ? borne : -1.0;
+    }
+    if (borne < 0.0) {
+        return densite <= 1.0 + EPSILON_UTILISATION;
+    }
+    
+    for (int i = 0; i < nb_taches; i++) {
+        for (temps_t d = taches[i].echeance; d <= borne; d += taches[i].periode) {
+            if ((long double)demande_processeur(taches, nb_taches, d) * serveur->periode >
+                (long double)d * (serveur->periode - serveur->budget)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Fonction pour vérifier par l'analyse que les tâches périodiques respectent
+// leurs échéances quelle que soit la charge apériodique :
+// - scrutation et sporadique : le serveur n'interfère pas plus qu'une tâche
+//   (Qs, Ts) de sa priorité, RTA exacte ;
+// - différé : un budget conservé puis rechargé peut s'exécuter deux fois de
+//   suite, soit au plus Qs de plus que la tâche (Qs, Ts) : RTA avec un
+//   blocage Qs pour les tâches moins prioritaires que le serveur (suffisant) ;
+// - TBS, CBS : demande du serveur bornée par sa bande passante (bande_garantie).
+bool serveur_garanti(const ParametresTache *taches, int nb_taches, const ParametresServeur *serveur) {
+    if (serveur_edf(serveur->type)) {
+        return bande_garantie(taches, nb_taches, serveur);
+    }
+    // Utilisation totale au-delà de 1, ou égale à 1 avec le blocage du serveur
+    // différé : une période d'activité ne se termine pas, inutile de lancer la RTA
+    double utilisation = facteur_utilisation(taches, nb_taches) + (double)serveur->budget / serveur->periode;
+    if (utilisation > 1.0 + EPSILON_UTILISATION ||
+        (serveur->type == SERVEUR_DIFFERE && utilisation > 1.0 - EPSILON_UTILISATION)) {
+        return false;
+    }
+    
+    ParametresTache *jeu = jeu_avec_serveur(taches, nb_taches, serveur);
+    long long *blocages = malloc((nb_taches + 1) * sizeof(long long));
+    long long *temps_reponse = malloc((nb_taches + 1) * sizeof(long long));
+    bool garanti = jeu != NULL && blocages != NULL && temps_reponse != NULL;
+    
+    if (garanti) {
+        for (int i = 0; i <= nb_taches; i++) {
+            blocages[i] = serveur->type == SERVEUR_DIFFERE && jeu[i].priorite < jeu[nb_taches].priorite ?
+                          serveur->budget : 0;
+        }
+        analyser_temps_reponse_blocage(jeu, nb_taches + 1, blocages, temps_reponse);
+        for (int i = 0; i < nb_taches; i++) {
+            garanti = garanti && temps_reponse[i] >= 0 && temps_reponse[i] <= jeu[i].echeance;
+        }
+    }
+    free(jeu);
+    free(blocages);
+    free(temps_reponse);
+    return garanti;
+}
+
+// Fonction pour trouver le plus grand budget (période fixée) pour lequel
+// l'analyse garantit les tâches périodiques, par dichotomie (0 : aucun)
+temps_t budget_maximal(const ParametresTache *taches, int nb_taches, const ParametresServeur *serveur) {
+    ParametresServeur essai = *serveur;
+    temps_t bas = 0;
+    temps_t haut = serveur->periode;
+    
+    // Invariant : bas est garanti (0 trivialement), au-delà de haut rien ne l'est
+    while (bas < haut) {
+        essai.budget = bas + (haut - bas + 1) / 2;
+        if (serveur_garanti(taches, nb_taches, &essai)) {
+            bas = essai.budget;
+        } else {
+            haut = essai.budget - 1;
+        }
+    }
+    return bas;
+}
+
+// Fonction pour obtenir l'échéance TBS d'une requête de durée duree arrivée à
+// arrivee, la précédente ayant l'échéance precedente : max(r, d) + C / Us
+static temps_t echeance_tbs(const ParametresServeur *serveur, temps_t arrivee, temps_t precedente, temps_t duree) {
+    long double largeur = ceill((long double)duree * serveur->periode / serveur->budget);
+    
+    return (arrivee > precedente ? arrivee : precedente) + (temps_t)largeur;
+}
+
+// Fonction pour planifier la recharge d'un serveur sporadique à la fin d'une activité
+static bool planifier_recharge(EtatServeur *serveur, temps_t date) {
+    if (serveur->premiere_recharge + serveur->nb_recharges == serveur->capacite_recharges) {
+        if (serveur->premiere_recharge > 0) {
+            memmove(serveur->recharges, serveur->recharges + serveur->premiere_recharge,
+                    serveur->nb_recharges * sizeof(Recharge));
+            serveur->premiere_recharge = 0;
+        } else {
+            int capacite = serveur->capacite_recharges > 0 ? 2 * serveur->capacite_recharges : 16;
+            Recharge *recharges = realloc(serveur->recharges, capacite * sizeof(Recharge));
+            if (recharges == NULL) {
+                return false;
+            }
+            serveur->recharges = recharges;
+            serveur->capacite_recharges = capacite;
+        }
+    }
+    serveur->recharges[serveur->premiere_recharge + serveur->nb_recharges++] =
+        (Recharge){ date, serveur->consomme };
+    if (serveur->nb_recharges == 1) {
+        serveur->prochaine_recharge = date;
+    }
+    return true;
+}
+
+// Fonction pour traiter les recharges échues du serveur à un instant donné
+static void recharger(EtatServeur *serveur, temps_t temps) {
+    const ParametresServeur *parametres = serveur->parametres;
+    
+    while (serveur->prochaine_recharge <= temps) {
+        switch (parametres->type) {
+            case SERVEUR_SCRUTATION:
+                // Budget perdu si aucune requête n'attend au début de la période
+                serveur->budget = serveur->tete < serveur->arrivees ? parametres->budget : 0;
+                serveur->prochaine_recharge += parametres->periode;
+                break;
+            case SERVEUR_DIFFERE:
+                serveur->budget = parametres->budget;
+                serveur->prochaine_recharge += parametres->periode;
+                break;
+            default:
+                serveur->budget += serveur->recharges[serveur->premiere_recharge].montant;
+                serveur->recharge = true;
+                serveur->premiere_recharge++;
+                serveur->nb_recharges--;
+                serveur->prochaine_recharge = serveur->nb_recharges > 0 ?
+                                              serveur->recharges[serveur->premiere_recharge].date : TEMPS_MAX;
+                break;
+        }
+    }
+}
+
+// Fonction pour ajouter la requête suivante du flux à la file du serveur
+static void arriver(EtatServeur *serveur, const FluxAperiodique *flux) {
+    const ParametresServeur *parametres = serveur->parametres;
+    const RequeteAperiodique *requete = &flux->requetes[serveur->arrivees];
+    bool file_vide = serveur->tete == serveur->arrivees;
+    
+    serveur->arrivees++;
+    if (!file_vide) {
+        return;
+    }
+    serveur->restant = requete->duree;
+    if (parametres->type == SERVEUR_TBS) {
+        serveur->echeance = echeance_tbs(parametres, requete->arrivee, serveur->echeance, requete->duree);
+    }
+    
+    // CBS : le budget restant ne peut être gardé que s'il ne dépasse pas la
+    // bande passante jusqu'à l'échéance courante (cs <= (ds - r) Qs / Ts)
+    if (parametres->type == SERVEUR_CBS &&
+        (long double)serveur->budget * parametres->periode >=
+        (long double)(serveur->echeance - requete->arrivee) * parametres->budget) {
+        serveur->echeance = requete->arrivee + parametres->periode;
+        serveur->budget = parametres->budget;
+    }
+}
+
+// Fonction pour savoir si le serveur a une requête à exécuter et du budget
+static bool serveur_eligible(const EtatServeur *serveur) {
+    return serveur->tete < serveur->arrivees &&
+           (serveur->parametres->type == SERVEUR_TBS || serveur->budget > 0);
+}
+
+// Fonction pour exécuter la requête en tête de temps à fin et mettre à jour
+// le budget ; une requête terminée est comptabilisée dans le résultat
+static void servir(EtatServeur *serveur, const FluxAperiodique *flux, temps_t temps, temps_t fin,
+                   ResultatServeur *resultat) {
+    const ParametresServeur *parametres = serveur->parametres;
+    temps_t duree = fin - temps;
+    
+    serveur->restant -= duree;
+    resultat->temps_service += duree;
+    if (parametres->type != SERVEUR_TBS) {
+        serveur->budget -= duree;
+    }
+    serveur->consomme += duree;
+    
+    if (serveur->restant == 0) {
+        const RequeteAperiodique *requete = &flux->requetes[serveur->tete];
+        histogramme_ajouter(&resultat->reponse, fin - requete->arrivee);
+        if (requete->echeance > 0 && fin > requete->arrivee + requete->echeance) {
+            resultat->requetes_en_retard++;
+        }
+        serveur->tete++;
+        if (serveur->tete < serveur->arrivees) {
+            requete++;
+            serveur->restant = requete->duree;
+            if (parametres->type == SERVEUR_TBS) {
+                serveur->echeance = echeance_tbs(parametres, requete->arrivee, serveur->echeance, requete->duree);
+            }
+        } else if (parametres->type == SERVEUR_SCRUTATION) {
+            serveur->budget = 0;
+        }
+    }
+    
+    // CBS : budget épuisé, il est rechargé et l'échéance repoussée d'une période
+    if (parametres->type == SERVEUR_CBS && serveur->budget == 0) {
+        serveur->budget = parametres->budget;
+        serveur->echeance += parametres->periode;
+    }
+}
+
+// Fonction pour placer le serveur dans la file des prêts (indice nb_taches)
+// s'il est éligible, et suivre l'activité d'un serveur sporadique : une
+// activité commence quand le serveur devient éligible et dure au plus Ts ; elle
+// se termine aussi sur une recharge, pour que tout ce qu'elle consomme ait été
+// disponible à son début. Sa consommation est rendue Ts après son début : le
+// serveur ne demande jamais plus que la tâche (Qs, Ts).
+static bool actualiser_serveur(EtatServeur *serveur, Tas *pret, int indice, temps_t temps) {
+    bool eligible = serveur_eligible(serveur);
+    long long cle = serveur_edf(serveur->parametres->type) ? serveur->echeance : serveur->cle_fixe;
+    temps_t fin_activite = serveur->debut_activite + serveur->parametres->periode;
+    
+    if (serveur->actif && (!eligible || serveur->recharge || temps >= fin_activite)) {
+        serveur->actif = false;
+        if (serveur->consomme > 0 && !planifier_recharge(serveur, fin_activite > temps ? fin_activite : temps)) {
+            return false;
+        }
+    }
+    if (serveur->parametres->type == SERVEUR_SPORADIQUE && eligible && !serveur->actif) {
+        serveur->actif = true;
+        serveur->debut_activite = temps;
+        serveur->consomme = 0;
+    }
+    serveur->recharge = false;
+    
+    if (!eligible && tas_contient(pret, indice)) {
+        tas_retirer(pret, indice);
+    } else if (eligible && tas_contient(pret, indice)) {
+        tas_modifier(pret, indice, cle);
+    } else if (eligible) {
+        tas_inserer(pret, indice, cle);
+    }
+    return true;
+}
+
+// Fonction pour simuler les tâches périodiques et le serveur sur [0, horizon)
+// La simulation est dirigée par les événements (activations, arrivées de
+// requêtes, recharges, terminaisons) ; les tâches périodiques sont préemptives
+// et, comme le serveur, ordonnancées par EDF (TBS, CBS) ou par les priorités
+// RM ou DM calculées avec le serveur. À clé égale, une tâche passe avant le
+// serveur. Une instance en retard termine avant les suivantes (les instances
+// dont l'échéance tombe avant l'horizon sans être terminées sont en retard).
+// Renvoie false si la mémoire manque.
+bool simuler_serveur(const ParametresTache *taches, int nb_taches, const ParametresServeur *serveur,
+                     const FluxAperiodique *flux, temps_t horizon, ResultatServeur *resultat) {
+    bool edf = serveur_edf(serveur->type);
+    ParametresTache *jeu = jeu_avec_serveur(taches, nb_taches, serveur);
+    EtatPeriodique *etats = calloc(nb_taches > 0 ? nb_taches : 1, sizeof(EtatPeriodique));
+    EtatServeur etat_serveur = { 0 };
+    Tas pret = { 0 }, activations = { 0 };
+    bool reussite = jeu != NULL && etats != NULL && tas_initialiser(&pret, nb_taches + 1) &&
+                    tas_initialiser(&activations, nb_taches > 0 ? nb_taches : 1);
+    temps_t temps = 0;
+    
+    memset(resultat, 0, sizeof(*resultat));
+    etat_serveur.parametres = serveur;
+    etat_serveur.cle_fixe = jeu != NULL ? -(long long)jeu[nb_taches].priorite : 0;
+    etat_serveur.budget = serveur->type == SERVEUR_SPORADIQUE ? serveur->budget : 0;
+    etat_serveur.prochaine_recharge = serveur->type == SERVEUR_SCRUTATION || serveur->type == SERVEUR_DIFFERE ?
+                                      0 : TEMPS_MAX;
+    for (int i = 0; reussite && i < nb_taches; i++) {
+        etats[i].prochaine_activation = taches[i].decalage;
+        tas_inserer(&activations, i, taches[i].decalage);
+    }
+    
+    while (reussite && temps < horizon) {
+        // Étape 1: Arrivées de requêtes, recharges du serveur, activations
+        while (etat_serveur.arrivees < flux->nb_requetes &&
+               flux->requetes[etat_serveur.arrivees].arrivee <= temps) {
+            arriver(&etat_serveur, flux);
+        }
+        recharger(&etat_serveur, temps);
+        while (!tas_vide(&activations) && tas_cle_sommet(&activations) == temps) {
+            int i = tas_sommet(&activations);
+            EtatPeriodique *etat = &etats[i];
+            if (etat->en_attente++ == 0) {
+                etat->premiere_activation = temps;
+                etat->temps_restant = taches[i].duree_execution;
+                tas_inserer(&pret, i, edf ? temps + taches[i].echeance : -(long long)jeu[i].priorite);
+            }
+            etat->prochaine_activation += taches[i].periode;
+            tas_modifier(&activations, i, etat->prochaine_activation);
+        }
+        reussite = actualiser_serveur(&etat_serveur, &pret, nb_taches, temps);
+        
+        // Étape 2: Élire l'instance de plus petite clé et trouver le prochain événement
+        int elue = tas_vide(&pret) ? -1 : tas_sommet(&pret);
+        temps_t fin = horizon;
+        if (!tas_vide(&activations) && tas_cle_sommet(&activations) < fin) {
+            fin = tas_cle_sommet(&activations);
+        }
+        if (etat_serveur.arrivees < flux->nb_requetes && flux->requetes[etat_serveur.arrivees].arrivee < fin) {
+            fin = flux->requetes[etat_serveur.arrivees].arrivee;
+        }
+        if (etat_serveur.prochaine_recharge < fin) {
+            fin = etat_serveur.prochaine_recharge;
+        }
+        if (etat_serveur.actif && etat_serveur.debut_activite + serveur->periode < fin) {
+            fin = etat_serveur.debut_activite + serveur->periode;
+        }
+        if (elue == nb_taches) {
+            temps_t quantum = serveur->type == SERVEUR_TBS || etat_serveur.restant < etat_serveur.budget ?
+                              etat_serveur.restant : etat_serveur.budget;
+            fin = temps + quantum < fin ? temps + quantum : fin;
+        } else if (elue != -1 && temps + etats[elue].temps_restant < fin) {
+            fin = temps + etats[elue].temps_restant;
+        }
+        
+        // Étape 3: Exécuter jusqu'au prochain événement
+        if (elue == nb_taches) {
+            servir(&etat_serveur, flux, temps, fin, resultat);
+        } else if (elue != -1) {
+            EtatPeriodique *etat = &etats[elue];
+            etat->temps_restant -= fin - temps;
+            if (etat->temps_restant == 0) {
+                if (fin > etat->premiere_activation + taches[elue].echeance) {
+                    resultat->echeances_manquees++;
+                }
+                if (--etat->en_attente > 0) {
+                    etat->premiere_activation += taches[elue].periode;
+                    etat->temps_restant = taches[elue].duree_execution;
+                    tas_modifier(&pret, elue, edf ? etat->premiere_activation + taches[elue].echeance :
+                                                    -(long long)jeu[elue].priorite);
+                } else {
+                    tas_retirer(&pret, elue);
+                }
+            }
+        }
+        temps = fin;
+    }
+    
+    // Bilan à l'horizon : instances et requêtes non terminées dont l'échéance est passée
+    for (int i = 0; reussite && i < nb_taches; i++) {
+        temps_t marge = horizon - etats[i].premiere_activation - taches[i].echeance;
+        if (etats[i].en_attente > 0 && marge >= 0) {
+            long long echues = marge / taches[i].periode + 1;
+            resultat->echeances_manquees += echues < etats[i].en_attente ? echues : etats[i].en_attente;
+        }
+    }
+    for (int k = 0; k < flux->nb_requetes && flux->requetes[k].arrivee < horizon; k++) {
+        const RequeteAperiodique *requete = &flux->requetes[k];
+        resultat->requetes++;
+        if (k >= etat_serveur.tete && requete->echeance > 0 && requete->arrivee + requete->echeance <= horizon) {
+            resultat->requetes_en_retard++;
+        }
+    }
+    
+    tas_liberer(&pret);
+    tas_liberer(&activations);
+    free(etat_serveur.recharges);
+    free(etats);
+    free(jeu);
+    return reussite;
+}
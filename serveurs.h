@@ -0,0 +1,83 @@
+#ifndef SERVEURS_H
+#define SERVEURS_H
+
+#include <stdbool.h>
+#include "tache.h"
+#include "temps.h"
+#include "metriques.h"
+#include "generateur-taches.h"
+
+// Serveurs de requêtes apériodiques : un serveur de budget Qs et de période Ts
+// exécute les requêtes dans leur ordre d'arrivée, à côté des tâches
+// périodiques, sans leur prendre plus que sa réservation.
+// - priorités fixes (RM, DM ; le serveur a la priorité d'une tâche (Qs, Ts)) :
+//   scrutation (budget rechargé à chaque période, perdu dès que la file est
+//   vide), différé (budget rechargé à chaque période, conservé en attendant
+//   une requête), sporadique (chaque consommation est rendue Ts après le
+//   début de l'activité du serveur) ;
+// - EDF : Total Bandwidth (la requête k reçoit l'échéance
+//   max(rk, dk-1) + Ck / Us, Us = Qs / Ts) et Constant Bandwidth (budget
+//   rechargé et échéance repoussée de Ts à chaque épuisement).
+typedef enum {
+    SERVEUR_SCRUTATION,       // Polling Server
+    SERVEUR_DIFFERE,          // Deferrable Server
+    SERVEUR_SPORADIQUE,       // Sporadic Server
+    SERVEUR_TBS,              // Total Bandwidth Server
+    SERVEUR_CBS,              // Constant Bandwidth Server
+    NB_SERVEURS
+} TypeServeur;
+
+typedef struct {
+    TypeServeur type;
+    temps_t budget;           // Qs
+    temps_t periode;          // Ts
+    bool dm;                  // Priorités fixes : DM (sinon RM), serveur compris
+} ParametresServeur;
+
+// Requête apériodique, ou sporadique si elle a une échéance
+typedef struct {
+    temps_t arrivee;
+    temps_t duree;
+    temps_t echeance;         // Échéance relative (0 : aucune)
+} RequeteAperiodique;
+
+// Flux de requêtes triées par date d'arrivée
+typedef struct {
+    RequeteAperiodique *requetes;
+    int nb_requetes;
+    int capacite;
+} FluxAperiodique;
+
+// Génération d'un flux : arrivées de Poisson (intervalles exponentiels de
+// moyenne intervalle, au moins separation), durées exponentielles de moyenne
+// duree (au moins 1)
+typedef struct {
+    temps_t intervalle;
+    temps_t separation;       // Intervalle minimal (flux sporadique ; 0 : aucun)
+    temps_t duree;
+    temps_t echeance;         // Échéance relative des requêtes (0 : aucune)
+    temps_t horizon;          // Arrivées dans [0, horizon)
+} GenerationFlux;
+
+// Résultat d'une simulation (durées dans l'unité des paramètres)
+typedef struct {
+    Histogramme reponse;      // Temps de réponse des requêtes terminées
+    long long requetes;       // Requêtes arrivées avant l'horizon
+    long long requetes_en_retard; // Requêtes à échéance terminées après elle, ou non terminées à temps
+    long long echeances_manquees; // Instances périodiques en retard (terminées ou non)
+    temps_t temps_service;    // Temps processeur donné aux requêtes
+} ResultatServeur;
+
+bool flux_charger(FluxAperiodique *flux, const char *chemin);
+bool flux_generer(FluxAperiodique *flux, const GenerationFlux *generation, GenerateurAleatoire *alea);
+void flux_liberer(FluxAperiodique *flux);
+
+bool serveur_garanti(const ParametresTache *taches, int nb_taches, const ParametresServeur *serveur);
+temps_t budget_maximal(const ParametresTache *taches, int nb_taches, const ParametresServeur *serveur);
+bool simuler_serveur(const ParametresTache *taches, int nb_taches, const ParametresServeur *serveur,
+                     const FluxAperiodique *flux, temps_t horizon, ResultatServeur *resultat);
+
+const char *nom_serveur(TypeServeur type);
+bool lire_type_serveur(const char *nom, TypeServeur *type);
+
+#endif
@@ -1,224 +1,224 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
-#include <limits.h>
+#include <string.h>
+#include "analyse.h"
+#include "decalages.h"
+#include "moteur-simulation.h"
+#include "executeur.h"
+#include "ligne-commande.h"
 
-// Structure pour représenter une tâche temps réel
-typedef struct {
-    int id;                    // Identifiant de la tâche
-    int duree_execution;       // Durée d'exécution (C)
-    int echeance;             // Échéance relative (D)
-    int periode;              // Période (T)
-    
-    // Variables pour la simulation EDF
-    int temps_restant;        // Temps d'exécution restant pour l'instance courante
-    int prochaine_activation; // Prochaine activation de la tâche
-    int echeance_absolue;     // Échéance absolue courante
-    int instance;             // Numéro de l'instance courante
-    bool active;              // Tâche actuellement active
-} Tache;
-
-// Structure pour stocker l'état du système
-typedef struct {
-    Tache *taches;
-    int nb_taches;
-} Systeme;
-
-// Fonction pour initialiser une tâche
-void initialiser_tache(Tache *tache, int id, int duree, int echeance, int periode) {
-    tache->id = id;
-    tache->duree_execution = duree;
-    tache->echeance = echeance;
-    tache->periode = periode;
-    tache->temps_restant = 0;
-    tache->prochaine_activation = 0;
-    tache->echeance_absolue = echeance;
-    tache->instance = 0;
-    tache->active = false;
-}
-
-// Fonction pour trouver la tâche avec l'échéance absolue la plus proche (EDF)
-int trouver_tache_echeance_plus_proche(Systeme *systeme) {
-    int tache_selectionnee = -1;
-    int echeance_min = INT_MAX;
-    
-    for (int i = 0; i < systeme->nb_taches; i++) {
-        Tache *tache = &systeme->taches[i];
-        
-        // Vérifier si la tâche est active et a du temps d'exécution restant
-        if (tache->active && tache->temps_restant > 0) {
-            if (tache->echeance_absolue < echeance_min) {
-                echeance_min = tache->echeance_absolue;
-                tache_selectionnee = i;
-            }
-        }
-    }
+// Fonction pour définir l'exemple de tâches de démonstration
+void definir_exemple_taches(Systeme *systeme) {
+    printf("\nEXEMPLE DE TACHES POUR DEMONSTRATION:\n");
+    printf("+--------+-----+---------+---------+\n");
+    printf("| Tache  |  C  |    D    |    T    |\n");
+    printf("+--------+-----+---------+---------+\n");
+    printf("|   T1   |  2  |    5    |    5    |\n");
+    printf("|   T2   |  1  |    3    |    6    |\n");
+    printf("|   T3   |  1  |    7    |    8    |\n");
+    printf("+--------+-----+---------+---------+\n");
     
-    return tache_selectionnee;
-}
-
-// Fonction pour gérer les événements d'ordonnancement à un instant donné
-bool gerer_evenements_ordonnancement(Systeme *systeme, int temps_actuel) {
-    bool evenement_ordonnancement = false;
-    bool echeance_manquee = false;
+    static ParametresTache exemple[3] = {
+        { 2, 5, 5, 0, 0 },   // Tâche 1: C=2, D=5, T=5
+        { 1, 3, 6, 0, 0 },   // Tâche 2: C=1, D=3, T=6
+        { 1, 7, 8, 0, 0 }    // Tâche 3: C=1, D=7, T=8
+    };
     
-    printf("    [Evenements d'ordonnancement a t=%d]\n", temps_actuel);
+    systeme->algorithme = EDF;
+    systeme->taches = malloc(3 * sizeof(Tache));
+    configurer_systeme(systeme, exemple, 3);
     
-    // ETAPE 1: Vérifier les fins de tâches en cours (avant les nouvelles activations)
+    printf("\nFACTEUR D'UTILISATION:\n");
+    double utilisation = 0.0;
     for (int i = 0; i < systeme->nb_taches; i++) {
-        Tache *tache = &systeme->taches[i];
-        if (tache->active && tache->temps_restant == 0) {
-            printf("    >> TERMINAISON: Tache %d (instance %d) completee\n", 
-                   tache->id, tache->instance);
-            tache->active = false;
-            evenement_ordonnancement = true;
-        }
+        double u_i = (double)systeme->parametres[i].duree_execution / systeme->parametres[i].periode;
+        printf("   U%d = %lld/%lld = %.3f\n", systeme->taches[i].id, 
+               systeme->parametres[i].duree_execution, systeme->parametres[i].periode, u_i);
+        utilisation += u_i;
     }
+    printf("   U_total = %.3f\n", utilisation);
+    printf("   Condition EDF: U <= 1.0 => %s\n", 
+           utilisation <= 1.0 ? "RESPECTEE" : "VIOLEE");
     
-    // ETAPE 2: Gérer les nouvelles activations
+    // Avec des échéances contraintes (D < T), U <= 1 n'est plus suffisant
     for (int i = 0; i < systeme->nb_taches; i++) {
-        Tache *tache = &systeme->taches[i];
-        
-        // Vérifier si c'est le moment d'activer la tâche
-        if (temps_actuel == tache->prochaine_activation) {
-            // Vérifier si l'instance précédente n'est pas terminée (échéance manquée)
-            if (tache->active && tache->temps_restant > 0) {
-                printf("    >> ECHEC: Tache %d (instance %d, temps restant: %d) - echeance manquee\n", 
-                       tache->id, tache->instance, tache->temps_restant);
-                echeance_manquee = true;
-            }
-            
-            // Lancement d'une nouvelle tâche
-            tache->instance++;
-            tache->temps_restant = tache->duree_execution;
-            tache->active = true;
-            tache->echeance_absolue = temps_actuel + tache->echeance;
-            
-            printf("    >> ACTIVATION: Tache %d (instance %d) - echeance absolue: %d\n", 
-                   tache->id, tache->instance, tache->echeance_absolue);
-            
-            // Programmer la prochaine activation
-            tache->prochaine_activation += tache->periode;
-            evenement_ordonnancement = true;
+        if (systeme->taches[i].echeance < systeme->taches[i].periode) {
+            printf("   (condition necessaire seulement : D < T pour la tache %d)\n", 
+                   systeme->taches[i].id);
+            break;
         }
     }
-    
-    if (!evenement_ordonnancement) {
-        printf("    (Aucun evenement d'ordonnancement)\n");
+}
+
+// Fonction pour afficher les sections critiques et le protocole d'accès
+void afficher_ressources(const JeuRessources *ressources) {
+    printf("\nRESSOURCES PARTAGEES (protocole %s):\n", nom_protocole(ressources->protocole));
+    for (int s = 0; s < ressources->nb_sections; s++) {
+        const SectionCritique *section = &ressources->sections[s];
+        printf("   T%d: %s de %lld a %lld unites d'execution\n", section->tache + 1,
+               ressources->noms[section->ressource], section->debut, section->debut + section->duree);
     }
-    
-    return !echeance_manquee;
 }
 
-// Fonction principale de simulation EDF avec traçage détaillé
-bool simuler_edf_avec_tracage(Systeme *systeme, int duree_simulation) {
-    printf("\n");
-    printf("==========================================\n");
-    printf("          SIMULATION EDF                  \n");
-    printf("     (Earliest Deadline First)           \n");
-    printf("==========================================\n");
-    
-    printf("\nPRINCIPE EDF:\n");
-    printf("A chaque evenement d'ordonnancement, selectionner la tache\n");
-    printf("avec l'echeance absolue la plus proche.\n\n");
-    
-    int temps = 0;
-    bool simulation_reussie = true;
-    int tache_precedente = -1;
-    
-    while (temps < duree_simulation) {
-        printf("\n--- TEMPS t = %d ---\n", temps);
-        
-        // Étape 1: Gérer les événements d'ordonnancement
-        if (!gerer_evenements_ordonnancement(systeme, temps)) {
-            simulation_reussie = false;
-        }
-        
-        // Étape 2: Appliquer l'algorithme EDF
-        int tache_courante = trouver_tache_echeance_plus_proche(systeme);
-        
-        // Détection de préemption
-        if (tache_precedente != -1 && tache_courante != tache_precedente && tache_courante != -1) {
-            printf("    >> PREEMPTION: Tache %d interrompue par Tache %d\n", 
-                   systeme->taches[tache_precedente].id, systeme->taches[tache_courante].id);
-        }
-        
-        if (tache_courante != -1) {
-            Tache *tache = &systeme->taches[tache_courante];
-            tache->temps_restant--;
-            
-            printf("    >> EXECUTION: Tache %d (instance %d)\n", tache->id, tache->instance);
-            printf("       - Echeance absolue: %d\n", tache->echeance_absolue);
-            printf("       - Temps restant: %d\n", tache->temps_restant);
-            
-            if (tache->temps_restant == 0) {
-                printf("       - TERMINEE!\n");
-            }
-        } else {
-            printf("    >> PROCESSEUR INACTIF\n");
-        }
-        
-        // Affichage de l'état de la file d'attente
-        printf("    >> ETAT DE LA FILE D'ATTENTE:\n");
-        bool file_vide = true;
+// Fonction pour afficher le mode de préemption, le coût des commutations et,
+// avec des seuils, le niveau et le seuil attribué à chaque tâche
+void afficher_preemption(const Systeme *systeme, bool seuils_faisables) {
+    printf("\nPREEMPTION %s (commutation de contexte: %lld):\n", nom_mode_preemption(systeme->preemption),
+           systeme->commutation);
+    if (systeme->preemption == PREEMPTION_POINTS) {
+        printf("   Troncons non preemptibles de %lld unites d'execution\n", systeme->points);
+    }
+    if (systeme->preemption == PREEMPTION_SEUILS) {
         for (int i = 0; i < systeme->nb_taches; i++) {
-            if (systeme->taches[i].active && systeme->taches[i].temps_restant > 0) {
-                printf("       - Tache %d: echeance=%d, restant=%d\n", 
-                       systeme->taches[i].id, systeme->taches[i].echeance_absolue, 
-                       systeme->taches[i].temps_restant);
-                file_vide = false;
-            }
-        }
-        if (file_vide) {
-            printf("       - (File vide)\n");
+            printf("   T%d: niveau %d, seuil %d\n", systeme->taches[i].id, systeme->taches[i].niveau,
+                   systeme->taches[i].seuil);
         }
-        
-        tache_precedente = tache_courante;
-        temps++;
+        printf("   => %s\n", seuils_faisables ? "seuils minimisant les preemptions" :
+               "jeu non ordonnancable, seuils = niveaux");
     }
+}
+
+// Fonction pour afficher le résultat du test EDF avec ressources partagées
+// Le terme de blocage B(t) de Baker n'est défini que pour SRP ; les durées
+// incluent deux commutations de contexte par instance.
+void afficher_analyse_blocages(Systeme *systeme) {
+    long long intervalle;
     
-    printf("\n--- FIN DE SIMULATION a t=%d ---\n", duree_simulation);
-    return simulation_reussie;
+    printf("\nTEST EDF AVEC BLOCAGES (demande processeur et blocage B(t)):\n");
+    if (systeme->ressources->protocole != PROTOCOLE_SRP) {
+        printf("   Terme B(t) defini pour srp uniquement (protocole %s) => analyse non disponible\n",
+               nom_protocole(systeme->ressources->protocole));
+        return;
+    }
+    ParametresTache *parametres = parametres_avec_commutation(systeme->parametres, systeme->nb_taches,
+                                                              systeme->commutation);
+    if (parametres == NULL) {
+        fprintf(stderr, "Memoire insuffisante pour l'analyse des blocages\n");
+        return;
+    }
+    if (ressources_analyser_edf(systeme->ressources, parametres, systeme->nb_taches, &intervalle)) {
+        printf("   h(t) + B(t) <= t pour toute longueur d'intervalle => ORDONNANCABLE\n");
+    } else {
+        printf("   Premier intervalle en defaut: [0, %lld], h(%lld) + B(%lld) = %lld + %lld > %lld\n",
+               intervalle, intervalle, intervalle,
+               demande_processeur(parametres, systeme->nb_taches, intervalle),
+               ressources_blocage_edf(systeme->ressources, parametres, intervalle), intervalle);
+        printf("   => NON ORDONNANCABLE\n");
+    }
+    free(parametres);
 }
 
-// Fonction pour définir l'exemple de tâches de démonstration
-void definir_exemple_taches(Systeme *systeme) {
-    printf("\nEXEMPLE DE TACHES POUR DEMONSTRATION:\n");
-    printf("+--------+-----+---------+---------+\n");
-    printf("| Tache  |  C  |    D    |    T    |\n");
-    printf("+--------+-----+---------+---------+\n");
-    printf("|   T1   |  2  |    5    |    5    |\n");
-    printf("|   T2   |  1  |    3    |    6    |\n");
-    printf("|   T3   |  1  |    7    |    8    |\n");
-    printf("+--------+-----+---------+---------+\n");
+// Fonction pour afficher le résultat du test EDF en préemption limitée ou avec
+// des commutations payantes (deux par instance) : h(t) + B(t) <= t, B(t) étant
+// la plus longue région non préemptible d'une tâche d'échéance plus lointaine
+void afficher_analyse_preemption(Systeme *systeme) {
+    long long intervalle;
+    ParametresTache *parametres = parametres_avec_commutation(systeme->parametres, systeme->nb_taches,
+                                                              systeme->commutation);
+    int *seuils = malloc((systeme->nb_taches > 0 ? systeme->nb_taches : 1) * sizeof(int));
     
-    systeme->nb_taches = 3;
-    systeme->taches = malloc(3 * sizeof(Tache));
+    if (parametres == NULL || seuils == NULL) {
+        fprintf(stderr, "Memoire insuffisante pour l'analyse en preemption limitee\n");
+        free(parametres);
+        free(seuils);
+        return;
+    }
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        seuils[i] = systeme->taches[i].seuil;
+    }
+    printf("\nTEST EDF EN PREEMPTION LIMITEE (demande processeur et blocage B(t)):\n");
+    if (analyser_demande_limitee(parametres, systeme->nb_taches, systeme->preemption, seuils, systeme->points,
+                                 &intervalle)) {
+        printf("   h(t) + B(t) <= t pour toute longueur d'intervalle => ORDONNANCABLE\n");
+    } else {
+        printf("   Premier intervalle en defaut: [0, %lld], h(%lld) = %lld, h(t) + B(t) > t\n",
+               intervalle, intervalle, demande_processeur(parametres, systeme->nb_taches, intervalle));
+        printf("   => NON ORDONNANCABLE\n");
+    }
+    free(parametres);
+    free(seuils);
+}
+
+// Fonction pour afficher le résultat du test exact EDF
+void afficher_analyse_qpa(Systeme *systeme) {
+    long long intervalle;
     
-    // Tâche 1: C=2, D=5, T=5
-    initialiser_tache(&systeme->taches[0], 1, 2, 5, 5);
+    if (systeme->ressources != NULL) {
+        afficher_analyse_blocages(systeme);
+        return;
+    }
+    if (systeme->preemption != PREEMPTION_TOTALE || systeme->commutation > 0) {
+        afficher_analyse_preemption(systeme);
+        return;
+    }
+    bool faisable = analyser_qpa(systeme->parametres, systeme->nb_taches, &intervalle);
     
-    // Tâche 2: C=1, D=3, T=6  
-    initialiser_tache(&systeme->taches[1], 2, 1, 3, 6);
+    printf("\nTEST EXACT EDF (analyse de la demande processeur, QPA):\n");
+    if (faisable) {
+        printf("   h(t) <= t pour toute echeance de la periode d'activite => ORDONNANCABLE\n");
+    } else {
+        printf("   Premier intervalle en defaut: [0, %lld], h(%lld) = %lld > %lld\n", 
+               intervalle, intervalle, 
+               demande_processeur(systeme->parametres, systeme->nb_taches, intervalle), intervalle);
+        printf("   => NON ORDONNANCABLE\n");
+    }
+}
+
+// Fonction pour afficher les décalages de la première activation des tâches
+void afficher_decalages(const Systeme *systeme) {
+    printf("\nDECALAGES D'ACTIVATION:\n");
+    for (int i = 0; i < systeme->nb_taches; i++) {
+        printf("   T%d: premiere activation a %lld\n", systeme->taches[i].id, systeme->parametres[i].decalage);
+    }
+    printf("   => test de la demande suffisant seulement (instant critique synchrone)\n");
+}
+
+// Fonction pour rechercher le pire décalage d'activation et afficher, pour
+// chaque tâche, le pire temps de réponse simulé et les décalages qui l'atteignent
+void afficher_pire_decalage(const Systeme *systeme, const OptionsDecalages *options) {
+    RechercheDecalages recherche;
+    EtatRecherche etat = lancer_recherche_decalages(&recherche, systeme, options);
     
-    // Tâche 3: C=1, D=7, T=8
-    initialiser_tache(&systeme->taches[2], 3, 1, 7, 8);
+    if (etat == RECHERCHE_IMPOSSIBLE) {
+        return;
+    }
+    printf("\nRECHERCHE DU PIRE DECALAGE (premiere tache a 0, decalages multiples de %lld):\n", recherche.pas);
+    if (etat == RECHERCHE_TROP_LONGUE) {
+        printf("   Combinaisons trop nombreuses (plus de %lld, voir --pire-decalage)\n", options->recherche_max);
+        decalages_liberer(&recherche);
+        return;
+    }
+    if (etat == RECHERCHE_HORIZON) {
+        printf("   Hyperperiode trop grande => recherche non disponible\n");
+        decalages_liberer(&recherche);
+        return;
+    }
     
-    printf("\nFACTEUR D'UTILISATION:\n");
-    double utilisation = 0.0;
+    printf("   %lld combinaison(s) simulee(s)\n", recherche.combinaisons);
     for (int i = 0; i < systeme->nb_taches; i++) {
-        double u_i = (double)systeme->taches[i].duree_execution / systeme->taches[i].periode;
-        printf("   U%d = %d/%d = %.3f\n", systeme->taches[i].id, 
-               systeme->taches[i].duree_execution, systeme->taches[i].periode, u_i);
-        utilisation += u_i;
+        if (recherche.reponse_max[i] < 0) {
+            printf("   T%d: aucune instance terminee\n", systeme->taches[i].id);
+            continue;
+        }
+        printf("   T%d: pire temps de reponse %lld (D = %lld) avec les decalages ", systeme->taches[i].id,
+               recherche.reponse_max[i], systeme->parametres[i].echeance);
+        ecrire_combinaison(&recherche, recherche.combinaison_max[i], stdout);
+        printf("\n");
     }
-    printf("   U_total = %.3f\n", utilisation);
-    printf("   Condition EDF: U <= 1.0 => %s\n", 
-           utilisation <= 1.0 ? "RESPECTEE" : "VIOLEE");
+    if (recherche.echecs == 0) {
+        printf("   => ORDONNANCABLE pour tous les decalages\n");
+    } else {
+        printf("   %lld combinaison(s) en echec, la premiere: ", recherche.echecs);
+        ecrire_combinaison(&recherche, recherche.premier_echec, stdout);
+        printf("\n   => NON ORDONNANCABLE pour certains decalages\n");
+    }
+    decalages_liberer(&recherche);
 }
 
-// Fonction pour afficher le résultat final
-void afficher_resultat_final(bool simulation_reussie) {
+// Fonction pour afficher le résultat final (non_conclu : simulation non
+// effectuée, horizon non calculable)
+void afficher_resultat_final(bool simulation_reussie, bool non_conclu) {
     printf("\n");
     printf("==========================================\n");
     printf("           RESULTAT FINAL                 \n");
@@ -229,6 +229,11 @@ void afficher_resultat_final(bool simulation_reussie) {
         printf("Toutes les echeances ont ete respectees.\n");
         printf("L'ordonnancement EDF a permis de satisfaire\n");
         printf("toutes les contraintes temporelles.\n");
+    } else if (non_conclu) {
+        printf("STATUT: SIMULATION NON CONCLUANTE\n");
+        printf("Hyperperiode trop grande : l'horizon de\n");
+        printf("simulation n'est pas calculable, aucune\n");
+        printf("simulation n'a ete effectuee.\n");
     } else {
         printf("STATUT: SIMULATION ECHOUEE\n");
         printf("Au moins une echeance n'a pas ete respectee.\n");
@@ -239,37 +244,153 @@ void afficher_resultat_final(bool simulation_reussie) {
     printf("==========================================\n");
 }
 
-int main() {
+// Fonction pour le mode interactif
+// La simulation enregistre ses événements dans une trace binaire (en mémoire,
+// ou dans chemin_trace si fourni) qui est mise en forme une fois terminée.
+// Si chemin_metriques est fourni, les métriques de chaque instance y sont
+// agrégées par tâche (histogrammes des temps de réponse et de démarrage).
+// politique_echec (NULL : défaut) fixe le sort des instances en retard.
+// Si execution est fourni, le plan simulé est ensuite exécuté réellement.
+// Si ressources est fourni, les tâches partagent ces ressources selon son protocole.
+// Si preemption est fourni, il limite la préemption et fixe le coût des commutations
+// (les seuils de préemption sont alors calculés pour minimiser les préemptions).
+// Si decalages est fourni, il décale la première activation des tâches et/ou
+// demande la recherche du pire décalage après la simulation.
+int main_interactif(const char *chemin_trace, NiveauTrace niveau, const char *chemin_metriques,
+                    const PolitiqueEchec *politique_echec, const OptionsExecution *execution,
+                    JeuRessources *ressources, const OptionsPreemption *preemption,
+                    const OptionsDecalages *decalages) {
     printf("==========================================\n");
     printf("          EXERCICE 2 - EDF                \n");
     printf("      Simulateur d'Ordonnancement         \n");
     printf("      Earliest Deadline First             \n");
     printf("==========================================\n");
     
-    Systeme systeme;
+    Systeme systeme = { 0 };
+    Trace trace;
+    Metriques metriques;
+    
+    systeme.politique_echec = politique_echec != NULL ? *politique_echec : ECHEC_CONTINUER;
+    systeme.ressources = ressources;
+    if (preemption != NULL) {
+        systeme.preemption = preemption->mode;
+        systeme.points = preemption->points;
+        systeme.commutation = preemption->commutation;
+    }
     
     // 1) Développer un simulateur proposant EDF comme ordonnanceur
     printf("\nOBJECTIF: Developper un simulateur EDF\n");
     
-    // Définir l'exemple de tâches
+    // Définir l'exemple de tâches (niveaux de préemption SRP par échéance)
     definir_exemple_taches(&systeme);
+    if (decalages != NULL && decalages->decalages != NULL) {
+        if (decalages->nb_decalages != systeme.nb_taches || !appliquer_decalages(&systeme, decalages->decalages)) {
+            fprintf(stderr, "Decalages: %d valeur(s) pour %d tache(s)\n", decalages->nb_decalages,
+                    systeme.nb_taches);
+            free(systeme.taches);
+            return 1;
+        }
+        afficher_decalages(&systeme);
+    }
+    if (ressources != NULL) {
+        if (!ressources_preparer(ressources, systeme.parametres, systeme.nb_taches, true)) {
+            free(systeme.taches);
+            return 1;
+        }
+        afficher_ressources(ressources);
+    }
+    if (preemption != NULL) {
+        afficher_preemption(&systeme, systeme.preemption == PREEMPTION_SEUILS && attribuer_seuils(&systeme));
+    }
+    afficher_analyse_qpa(&systeme);
     
     // 2) Vérifier l'application en traçant l'exécution
     printf("\nVERIFICATION: Tracage de l'execution\n");
     
     // Demander la durée de simulation
-    int duree_simulation;
-    printf("\nDuree de simulation souhaitee (recommande: 24) : ");
-    scanf("%d", &duree_simulation);
+    temps_t duree_simulation = 0;
+    if (systeme.horizon >= 0) {
+        printf("\nDuree de simulation souhaitee (0 = horizon de %lld unites, %s) : ", systeme.horizon,
+               systeme.horizon == systeme.hyperperiode ? "hyperperiode" : "2 x hyperperiode");
+    } else {
+        printf("\nDuree de simulation souhaitee (0 = horizon non calculable, hyperperiode trop grande) : ");
+    }
+    lire_temps_fichier(stdin, &duree_simulation);
     
     // Lancer la simulation avec traçage complet
-    bool resultat = simuler_edf_avec_tracage(&systeme, duree_simulation);
+    bool trace_creee = chemin_trace != NULL ?
+        trace_creer_fichier(&trace, niveau, TAILLE_TRACE, chemin_trace, systeme.parametres, systeme.nb_taches) :
+        trace_creer_anneau(&trace, niveau, TAILLE_TRACE);
+    systeme.trace = trace_creee ? &trace : NULL;
+    bool metriques_creees = chemin_metriques != NULL && metriques_creer(&metriques, systeme.nb_taches);
+    systeme.metriques = metriques_creees ? &metriques : NULL;
+    
+    printf("\n");
+    printf("==========================================\n");
+    printf("          SIMULATION EDF                  \n");
+    printf("     (Earliest Deadline First)           \n");
+    printf("==========================================\n");
+    
+    printf("\nPRINCIPE EDF:\n");
+    printf("A chaque evenement d'ordonnancement, selectionner la tache\n");
+    printf("avec l'echeance absolue la plus proche.\n");
+    
+    bool resultat = simuler_edf(&systeme, duree_simulation);
+    
+    if (trace_creee) {
+        afficher_trace(&trace, chemin_trace, systeme.parametres, systeme.nb_taches);
+    }
+    if (metriques_creees) {
+        if (metriques_enregistrer(&metriques, systeme.parametres, chemin_metriques)) {
+            printf("\n>> Metriques par tache enregistrees dans %s\n", chemin_metriques);
+        }
+        metriques_liberer(&metriques);
+    }
     
     // Afficher le résultat final
-    afficher_resultat_final(resultat);
+    afficher_resultat_final(resultat, systeme.non_conclu);
+    
+    // Recherche du pire décalage d'activation (toutes les combinaisons distinctes)
+    if (decalages != NULL && decalages->recherche_max > 0) {
+        afficher_pire_decalage(&systeme, decalages);
+    }
+    
+    // Exécution réelle du plan simulé (table de répartition d'une hyperpériode)
+    if (execution != NULL) {
+        executer_plan(&systeme, execution);
+    }
     
     // Libération de la mémoire
     free(systeme.taches);
+    liberer_files(&systeme);
     
     return 0;
 }
+
+// Fonction pour le test analytique du mode lot : test exact de la demande processeur
+static bool tester_qpa(const Systeme *systeme, long long *intervalle_violation) {
+    return analyser_qpa(systeme->parametres, systeme->nb_taches, intervalle_violation);
+}
+
+// Une seule politique en mode lot : EDF
+static const PolitiqueLot POLITIQUES[] = {
+    { "edf", EDF, true, true }
+};
+
+static const ProgrammeLigneCommande PROGRAMME = {
+    .politiques = POLITIQUES,
+    .nb_politiques = 1,
+    .analyse = "qpa",
+    .tester = tester_qpa,
+    .avec_intervalle = true,
+    .avec_duree = true,
+    .aide_echec = "(defaut: continuer)",
+    .aide_protocole = "aucun|pip|srp\n"
+                      "                         acces aux ressources : verrous simples, heritage de priorite ou\n"
+                      "                         Stack Resource Policy (defaut: aucun ; analyse avec srp uniquement)",
+    .interactif = main_interactif
+};
+
+int main(int argc, char **argv) {
+    return main_ligne_commande(&PROGRAMME, argc, argv);
+}
@@ -0,0 +1,357 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "table-taches.h"
+
+// Les noyaux vectoriels sont compilés avec l'attribut target : le reste du
+// programme n'exige pas AVX2, le choix est fait à l'exécution.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NOYAUX_X86 1
+#include <immintrin.h>
+#endif
+
+#define ALIGNEMENT 32
+
+// Fonction pour allouer un tableau d'entiers aligné pour les chargements vectoriels
+static int *allouer_aligne(int capacite) {
+    size_t taille = (size_t)capacite * sizeof(int);
+    taille = (taille + ALIGNEMENT - 1) / ALIGNEMENT * ALIGNEMENT;
+    return aligned_alloc(ALIGNEMENT, taille > 0 ? taille : ALIGNEMENT);
+}
+
+// Fonction pour allouer une table de capacite tâches (vide)
+bool table_initialiser(TableTaches *table, int capacite) {
+    memset(table, 0, sizeof(*table));
+    table->priorite = allouer_aligne(capacite);
+    table->echeance_absolue = allouer_aligne(capacite);
+    table->prochaine_activation = allouer_aligne(capacite);
+    table->temps_restant = allouer_aligne(capacite);
+    if (table->priorite == NULL || table->echeance_absolue == NULL ||
+        table->prochaine_activation == NULL || table->temps_restant == NULL) {
+        table_liberer(table);
+        return false;
+    }
+    table->capacite = capacite;
+    return true;
+}
+
+// Fonction pour libérer la mémoire d'une table
+void table_liberer(TableTaches *table) {
+    free(table->priorite);
+    free(table->echeance_absolue);
+    free(table->prochaine_activation);
+    free(table->temps_restant);
+    memset(table, 0, sizeof(*table));
+}
+
+// Fonction pour trouver la première tâche prête dont la clé vaut valeur
+// (seconde passe commune aux noyaux, quelle que soit la largeur des vecteurs)
+static int premiere_tache(const TableTaches *table, const int *cles, int debut, int valeur) {
+    for (int i = debut; i < table->nb_taches; i++) {
+        if (table->temps_restant[i] > 0 && cles[i] == valeur) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// ---- Noyaux scalaires (toutes plateformes) ----
+
+static int echeance_min_scalaire(const TableTaches *table) {
+    int meilleure = -1;
+    
+    for (int i = 0; i < table->nb_taches; i++) {
+        if (table->temps_restant[i] > 0 &&
+            (meilleure == -1 || table->echeance_absolue[i] < table->echeance_absolue[meilleure])) {
+            meilleure = i;
+        }
+    }
+    return meilleure;
+}
+
+static int priorite_max_scalaire(const TableTaches *table) {
+    int meilleure = -1;
+    
+    for (int i = 0; i < table->nb_taches; i++) {
+        if (table->temps_restant[i] > 0 &&
+            (meilleure == -1 || table->priorite[i] > table->priorite[meilleure])) {
+            meilleure = i;
+        }
+    }
+    return meilleure;
+}
+
+static int activations_scalaire(const TableTaches *table, int temps, int *indices) {
+    int nb = 0;
+    
+    for (int i = 0; i < table->nb_taches; i++) {
+        if (table->prochaine_activation[i] == temps) {
+            indices[nb++] = i;
+        }
+    }
+    return nb;
+}
+
+static const NoyauxSelection noyaux_scalaires = {
+    echeance_min_scalaire, priorite_max_scalaire, activations_scalaire
+};
+
+#ifdef NOYAUX_X86
+
+// ---- Noyaux SSE4.1 (4 tâches par instruction) ----
+
+__attribute__((target("sse4.1")))
+static int echeance_min_sse41(const TableTaches *table) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i sentinelle = _mm_set1_epi32(INT_MAX);
+    __m128i minimum = sentinelle;
+    int n = table->nb_taches;
+    int i = 0;
+    
+    // Les tâches non prêtes sont remplacées par la sentinelle
+    for (; i + 4 <= n; i += 4) {
+        __m128i restant = _mm_load_si128((const __m128i *)(table->temps_restant + i));
+        __m128i echeance = _mm_load_si128((const __m128i *)(table->echeance_absolue + i));
+        __m128i pret = _mm_cmpgt_epi32(restant, zero);
+        minimum = _mm_min_epi32(minimum, _mm_blendv_epi8(sentinelle, echeance, pret));
+    }
+    minimum = _mm_min_epi32(minimum, _mm_shuffle_epi32(minimum, _MM_SHUFFLE(1, 0, 3, 2)));
+    minimum = _mm_min_epi32(minimum, _mm_shuffle_epi32(minimum, _MM_SHUFFLE(2, 3, 0, 1)));
+    int valeur = _mm_cvtsi128_si32(minimum);
+    for (int j = i; j < n; j++) {
+        if (table->temps_restant[j] > 0 && table->echeance_absolue[j] < valeur) {
+            valeur = table->echeance_absolue[j];
+        }
+    }
+    
+    // Seconde passe : première tâche prête atteignant le minimum
+    const __m128i cible = _mm_set1_epi32(valeur);
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128i restant = _mm_load_si128((const __m128i *)(table->temps_restant + i));
+        __m128i echeance = _mm_load_si128((const __m128i *)(table->echeance_absolue + i));
+        __m128i egal = _mm_and_si128(_mm_cmpgt_epi32(restant, zero), _mm_cmpeq_epi32(echeance, cible));
+        int masque = _mm_movemask_ps(_mm_castsi128_ps(egal));
+        if (masque != 0) {
+            return i + __builtin_ctz(masque);
+        }
+    }
+    return premiere_tache(table, table->echeance_absolue, i, valeur);
+}
+
+__attribute__((target("sse4.1")))
+static int priorite_max_sse41(const TableTaches *table) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i sentinelle = _mm_set1_epi32(INT_MIN);
+    __m128i maximum = sentinelle;
+    int n = table->nb_taches;
+    int i = 0;
+    
+    for (; i + 4 <= n; i += 4) {
+        __m128i restant = _mm_load_si128((const __m128i *)(table->temps_restant + i));
+        __m128i priorite = _mm_load_si128((const __m128i *)(table->priorite + i));
+        __m128i pret = _mm_cmpgt_epi32(restant, zero);
+        maximum = _mm_max_epi32(maximum, _mm_blendv_epi8(sentinelle, priorite, pret));
+    }
+    maximum = _mm_max_epi32(maximum, _mm_shuffle_epi32(maximum, _MM_SHUFFLE(1, 0, 3, 2)));
+    maximum = _mm_max_epi32(maximum, _mm_shuffle_epi32(maximum, _MM_SHUFFLE(2, 3, 0, 1)));
+    int valeur = _mm_cvtsi128_si32(maximum);
+    for (int j = i; j < n; j++) {
+        if (table->temps_restant[j] > 0 && table->priorite[j] > valeur) {
+            valeur = table->priorite[j];
+        }
+    }
+    
+    const __m128i cible = _mm_set1_epi32(valeur);
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128i restant = _mm_load_si128((const __m128i *)(table->temps_restant + i));
+        __m128i priorite = _mm_load_si128((const __m128i *)(table->priorite + i));
+        __m128i egal = _mm_and_si128(_mm_cmpgt_epi32(restant, zero), _mm_cmpeq_epi32(priorite, cible));
+        int masque = _mm_movemask_ps(_mm_castsi128_ps(egal));
+        if (masque != 0) {
+            return i + __builtin_ctz(masque);
+        }
+    }
+    return premiere_tache(table, table->priorite, i, valeur);
+}
+
+__attribute__((target("sse4.1")))
+static int activations_sse41(const TableTaches *table, int temps, int *indices) {
+    const __m128i cible = _mm_set1_epi32(temps);
+    int n = table->nb_taches;
+    int nb = 0;
+    int i = 0;
+    
+    for (; i + 4 <= n; i += 4) {
+        __m128i activation = _mm_load_si128((const __m128i *)(table->prochaine_activation + i));
+        int masque = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(activation, cible)));
+        while (masque != 0) {
+            indices[nb++] = i + __builtin_ctz(masque);
+            masque &= masque - 1;
+        }
+    }
+    for (; i < n; i++) {
+        if (table->prochaine_activation[i] == temps) {
+            indices[nb++] = i;
+        }
+    }
+    return nb;
+}
+
+static const NoyauxSelection noyaux_sse41 = {
+    echeance_min_sse41, priorite_max_sse41, activations_sse41
+};
+
+// ---- Noyaux AVX2 (8 tâches par instruction) ----
+
+__attribute__((target("avx2")))
+static int echeance_min_avx2(const TableTaches *table) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i sentinelle = _mm256_set1_epi32(INT_MAX);
+    __m256i minimum = sentinelle;
+    int n = table->nb_taches;
+    int i = 0;
+    
+    for (; i + 8 <= n; i += 8) {
+        __m256i restant = _mm256_load_si256((const __m256i *)(table->temps_restant + i));
+        __m256i echeance = _mm256_load_si256((const __m256i *)(table->echeance_absolue + i));
+        __m256i pret = _mm256_cmpgt_epi32(restant, zero);
+        minimum = _mm256_min_epi32(minimum, _mm256_blendv_epi8(sentinelle, echeance, pret));
+    }
+    __m128i moitie = _mm_min_epi32(_mm256_castsi256_si128(minimum), _mm256_extracti128_si256(minimum, 1));
+    moitie = _mm_min_epi32(moitie, _mm_shuffle_epi32(moitie, _MM_SHUFFLE(1, 0, 3, 2)));
+    moitie = _mm_min_epi32(moitie, _mm_shuffle_epi32(moitie, _MM_SHUFFLE(2, 3, 0, 1)));
+    int valeur = _mm_cvtsi128_si32(moitie);
+    for (int j = i; j < n; j++) {
+        if (table->temps_restant[j] > 0 && table->echeance_absolue[j] < valeur) {
+            valeur = table->echeance_absolue[j];
+        }
+    }
+    
+    const __m256i cible = _mm256_set1_epi32(valeur);
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i restant = _mm256_load_si256((const __m256i *)(table->temps_restant + i));
+        __m256i echeance = _mm256_load_si256((const __m256i *)(table->echeance_absolue + i));
+        __m256i egal = _mm256_and_si256(_mm256_cmpgt_epi32(restant, zero), _mm256_cmpeq_epi32(echeance, cible));
+        int masque = _mm256_movemask_ps(_mm256_castsi256_ps(egal));
+        if (masque != 0) {
+            return i + __builtin_ctz(masque);
+        }
+    }
+    return premiere_tache(table, table->echeance_absolue, i, valeur);
+}
+
+__attribute__((target("avx2")))
+static int priorite_max_avx2(const TableTaches *table) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i sentinelle = _mm256_set1_epi32(INT_MIN);
+    __m256i maximum = sentinelle;
+    int n = table->nb_taches;
+    int i = 0;
+    
+    for (; i + 8 <= n; i += 8) {
+        __m256i restant = _mm256_load_si256((const __m256i *)(table->temps_restant + i));
+        __m256i priorite = _mm256_load_si256((const __m256i *)(table->priorite + i));
+        __m256i pret = _mm256_cmpgt_epi32(restant, zero);
+        maximum = _mm256_max_epi32(maximum, _mm256_blendv_epi8(sentinelle, priorite, pret));
+    }
+    __m128i moitie = _mm_max_epi32(_mm256_castsi256_si128(maximum), _mm256_extracti128_si256(maximum, 1));
+    moitie = _mm_max_epi32(moitie, _mm_shuffle_epi32(moitie, _MM_SHUFFLE(1, 0, 3, 2)));
+    moitie = _mm_max_epi32(moitie, _mm_shuffle_epi32(moitie, _MM_SHUFFLE(2, 3, 0, 1)));
+    int valeur = _mm_cvtsi128_si32(moitie);
+    for (int j = i; j < n; j++) {
+        if (table->temps_restant[j] > 0 && table->priorite[j] > valeur) {
+            valeur = table->priorite[j];
+        }
+    }
+    
+    const __m256i cible = _mm256_set1_epi32(valeur);
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i restant = _mm256_load_si256((const __m256i *)(table->temps_restant + i));
+        __m256i priorite = _mm256_load_si256((const __m256i *)(table->priorite + i));
+        __m256i egal = _mm256_and_si256(_mm256_cmpgt_epi32(restant, zero), _mm256_cmpeq_epi32(priorite, cible));
+        int masque = _mm256_movemask_ps(_mm256_castsi256_ps(egal));
+        if (masque != 0) {
+            return i + __builtin_ctz(masque);
+        }
+    }
+    return premiere_tache(table, table->priorite, i, valeur);
+}
+
+__attribute__((target("avx2")))
+static int activations_avx2(const TableTaches *table, int temps, int *indices) {
+    const __m256i cible = _mm256_set1_epi32(temps);
+    int n = table->nb_taches;
+    int nb = 0;
+    int i = 0;
+    
+    for (; i + 8 <= n; i += 8) {
+        __m256i activation = _mm256_load_si256((const __m256i *)(table->prochaine_activation + i));
+        int masque = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(activation, cible)));
+        while (masque != 0) {
+            indices[nb++] = i + __builtin_ctz(masque);
+            masque &= masque - 1;
+        }
+    }
+    for (; i < n; i++) {
+        if (table->prochaine_activation[i] == temps) {
+            indices[nb++] = i;
+        }
+    }
+    return nb;
+}
+
+static const NoyauxSelection noyaux_avx2 = {
+    echeance_min_avx2, priorite_max_avx2, activations_avx2
+};
+
+#endif
+
+// Fonction pour savoir si un jeu de noyaux est utilisable sur ce processeur
+bool noyau_disponible(TypeNoyau type) {
+    switch (type) {
+        case NOYAU_SCALAIRE:
+            return true;
+#ifdef NOYAUX_X86
+        case NOYAU_SSE41:
+            return __builtin_cpu_supports("sse4.1");
+        case NOYAU_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+// Fonction pour obtenir un jeu de noyaux (NULL s'il est indisponible)
+const NoyauxSelection *noyaux_obtenir(TypeNoyau type) {
+    if (!noyau_disponible(type)) {
+        return NULL;
+    }
+    switch (type) {
+#ifdef NOYAUX_X86
+        case NOYAU_SSE41: return &noyaux_sse41;
+        case NOYAU_AVX2:  return &noyaux_avx2;
+#endif
+        default:          return &noyaux_scalaires;
+    }
+}
+
+// Fonction pour obtenir les noyaux les plus larges disponibles
+const NoyauxSelection *noyaux_meilleurs(void) {
+    for (int type = NB_NOYAUX - 1; type > NOYAU_SCALAIRE; type--) {
+        if (noyau_disponible((TypeNoyau)type)) {
+            return noyaux_obtenir((TypeNoyau)type);
+        }
+    }
+    return &noyaux_scalaires;
+}
+
+// Fonction pour obtenir le nom d'un jeu de noyaux
+const char *nom_noyau(TypeNoyau type) {
+    switch (type) {
+        case NOYAU_SCALAIRE: return "scalaire";
+        case NOYAU_SSE41:    return "sse4.1";
+        case NOYAU_AVX2:     return "avx2";
+        default:             return "inconnu";
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef TABLE_TACHES_H
+#define TABLE_TACHES_H
+
+#include <stdbool.h>
+
+// Table des tâches en structure de tableaux (SoA) : chaque champ de l'état de
+// simulation est rangé dans un tableau contigu (aligné sur 32 octets), de sorte
+// qu'un parcours ne charge que les champs qu'il utilise.
+typedef struct {
+    int *priorite;            // Priorité (plus grand = haute priorité)
+    int *echeance_absolue;    // Échéance absolue de l'instance courante
+    int *prochaine_activation; // Prochaine activation
+    int *temps_restant;       // Temps restant (> 0 : instance prête)
+    int nb_taches;
+    int capacite;
+} TableTaches;
+
+// Implémentations des noyaux de sélection
+typedef enum {
+    NOYAU_SCALAIRE,
+    NOYAU_SSE41,
+    NOYAU_AVX2,
+    NB_NOYAUX
+} TypeNoyau;
+
+// Noyaux de sélection sur les tâches prêtes (à égalité, le plus petit indice
+// l'emporte, comme dans les tas de la simulation ; -1 si aucune tâche prête)
+typedef struct {
+    int (*echeance_min)(const TableTaches *table);
+    int (*priorite_max)(const TableTaches *table);
+    // Indices des tâches activées à la date temps, rangés dans indices (renvoie leur nombre)
+    int (*activations)(const TableTaches *table, int temps, int *indices);
+} NoyauxSelection;
+
+bool table_initialiser(TableTaches *table, int capacite);
+void table_liberer(TableTaches *table);
+
+bool noyau_disponible(TypeNoyau type);
+const NoyauxSelection *noyaux_obtenir(TypeNoyau type);
+const NoyauxSelection *noyaux_meilleurs(void);
+const char *nom_noyau(TypeNoyau type);
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef TACHE_H
+#define TACHE_H
+
+#include "temps.h"
+
+// Paramètres statiques d'une tâche périodique, communs aux simulateurs,
+// aux analyses, au générateur et aux fichiers de lot
+typedef struct {
+    temps_t duree_execution;  // Durée d'exécution (C)
+    temps_t echeance;         // Échéance relative (D)
+    temps_t periode;          // Période (T)
+    int priorite;             // Priorité (P, plus grand = haute priorité), 0 si non renseignée
+    temps_t decalage;         // Date de la première activation (O), 0 : activation synchrone
+} ParametresTache;
+
+#endif
@@ -0,0 +1,150 @@
+#include <stdlib.h>
+#include "tas.h"
+
+// Fonction pour comparer deux entrées (clé puis indice croissants)
+static inline bool precede(const EntreeTas *a, const EntreeTas *b) {
+    return a->cle < b->cle || (a->cle == b->cle && a->indice < b->indice);
+}
+
+// Fonction pour placer une entrée à une position et mettre à jour son index
+static inline void placer(Tas *tas, int pos, EntreeTas entree) {
+    tas->entrees[pos] = entree;
+    tas->position[entree.indice] = pos;
+}
+
+// Fonction pour faire remonter une entrée vers la racine
+static void remonter(Tas *tas, int pos) {
+    EntreeTas entree = tas->entrees[pos];
+    
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!precede(&entree, &tas->entrees[parent])) {
+            break;
+        }
+        placer(tas, pos, tas->entrees[parent]);
+        pos = parent;
+    }
+    placer(tas, pos, entree);
+}
+
+// Fonction pour faire descendre une entrée vers les feuilles
+static void descendre(Tas *tas, int pos) {
+    EntreeTas entree = tas->entrees[pos];
+    
+    for (;;) {
+        int enfant = 2 * pos + 1;
+        if (enfant >= tas->taille) {
+            break;
+        }
+        if (enfant + 1 < tas->taille && precede(&tas->entrees[enfant + 1], &tas->entrees[enfant])) {
+            enfant++;
+        }
+        if (!precede(&tas->entrees[enfant], &entree)) {
+            break;
+        }
+        placer(tas, pos, tas->entrees[enfant]);
+        pos = enfant;
+    }
+    placer(tas, pos, entree);
+}
+
+// Fonction pour initialiser un tas pouvant contenir les tâches 0..capacite-1
+bool tas_initialiser(Tas *tas, int capacite) {
+    tas->entrees = NULL;
+    tas->position = NULL;
+    tas->taille = 0;
+    tas->capacite = 0;
+    return tas_preparer(tas, capacite);
+}
+
+// Fonction pour vider un tas déjà initialisé et l'agrandir si nécessaire
+// (permet de réutiliser la mémoire d'une simulation à la suivante)
+bool tas_preparer(Tas *tas, int capacite) {
+    // Les tâches encore présentes redeviennent absentes
+    for (int k = 0; k < tas->taille; k++) {
+        tas->position[tas->entrees[k].indice] = -1;
+    }
+    tas->taille = 0;
+    
+    if (capacite > tas->capacite || tas->entrees == NULL) {
+        int nouvelle = capacite > 0 ? capacite : 1;
+        EntreeTas *entrees = realloc(tas->entrees, nouvelle * sizeof(EntreeTas));
+        if (entrees != NULL) {
+            tas->entrees = entrees;
+        }
+        int *position = realloc(tas->position, nouvelle * sizeof(int));
+        if (position != NULL) {
+            tas->position = position;
+        }
+        if (entrees == NULL || position == NULL) {
+            return false;
+        }
+        for (int i = tas->capacite; i < nouvelle; i++) {
+            tas->position[i] = -1;
+        }
+        tas->capacite = nouvelle;
+    }
+    return true;
+}
+
+// Fonction pour libérer la mémoire d'un tas
+void tas_liberer(Tas *tas) {
+    free(tas->entrees);
+    free(tas->position);
+    tas->entrees = NULL;
+    tas->position = NULL;
+    tas->taille = 0;
+    tas->capacite = 0;
+}
+
+// Fonction pour insérer une tâche absente du tas
+void tas_inserer(Tas *tas, int indice, long long cle) {
+    EntreeTas entree = { cle, indice };
+    
+    placer(tas, tas->taille, entree);
+    tas->taille++;
+    remonter(tas, tas->taille - 1);
+}
+
+// Fonction pour changer la clé d'une tâche présente dans le tas
+void tas_modifier(Tas *tas, int indice, long long cle) {
+    int pos = tas->position[indice];
+    long long ancienne = tas->entrees[pos].cle;
+    
+    tas->entrees[pos].cle = cle;
+    if (cle < ancienne) {
+        remonter(tas, pos);
+    } else {
+        descendre(tas, pos);
+    }
+}
+
+// Fonction pour retirer une tâche présente dans le tas
+void tas_retirer(Tas *tas, int indice) {
+    int pos = tas->position[indice];
+    EntreeTas derniere = tas->entrees[tas->taille - 1];
+    
+    tas->position[indice] = -1;
+    tas->taille--;
+    if (pos == tas->taille) {
+        return;
+    }
+    
+    // La dernière entrée comble le trou puis rejoint sa place
+    placer(tas, pos, derniere);
+    if (pos > 0 && precede(&derniere, &tas->entrees[(pos - 1) / 2])) {
+        remonter(tas, pos);
+    } else {
+        descendre(tas, pos);
+    }
+}
+
+// Fonction pour retirer et renvoyer la tâche au sommet (-1 si le tas est vide)
+int tas_extraire(Tas *tas) {
+    int indice = tas_sommet(tas);
+    
+    if (indice != -1) {
+        tas_retirer(tas, indice);
+    }
+    return indice;
+}
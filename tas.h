@@ -0,0 +1,51 @@
+#ifndef TAS_H
+#define TAS_H
+
+#include <stdbool.h>
+
+// Entrée d'un tas : une clé de tri et l'indice de la tâche associée
+typedef struct {
+    long long cle;            // Clé de tri (plus petite = sommet du tas)
+    int indice;               // Indice de la tâche dans le tableau du système
+} EntreeTas;
+
+// Tas binaire minimum indexé : chaque tâche y figure au plus une fois, ce qui
+// permet de modifier ou retirer une tâche en O(log n). À clé égale, le plus
+// petit indice est au sommet (même départage que les parcours linéaires).
+typedef struct {
+    EntreeTas *entrees;       // Entrées organisées en tas
+    int *position;            // Position de chaque tâche dans le tas (-1 si absente)
+    int taille;               // Nombre d'entrées présentes
+    int capacite;             // Nombre maximal de tâches
+} Tas;
+
+bool tas_initialiser(Tas *tas, int capacite);
+bool tas_preparer(Tas *tas, int capacite);
+void tas_liberer(Tas *tas);
+
+void tas_inserer(Tas *tas, int indice, long long cle);
+void tas_modifier(Tas *tas, int indice, long long cle);
+void tas_retirer(Tas *tas, int indice);
+int tas_extraire(Tas *tas);
+
+// Fonction pour savoir si le tas est vide
+static inline bool tas_vide(const Tas *tas) {
+    return tas->taille == 0;
+}
+
+// Fonction pour savoir si une tâche est présente dans le tas
+static inline bool tas_contient(const Tas *tas, int indice) {
+    return tas->position[indice] != -1;
+}
+
+// Fonction pour obtenir l'indice de la tâche au sommet (-1 si le tas est vide)
+static inline int tas_sommet(const Tas *tas) {
+    return tas->taille > 0 ? tas->entrees[0].indice : -1;
+}
+
+// Fonction pour obtenir la clé du sommet (le tas ne doit pas être vide)
+static inline long long tas_cle_sommet(const Tas *tas) {
+    return tas->entrees[0].cle;
+}
+
+#endif
@@ -0,0 +1,112 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include "temps.h"
+
+// Unités reconnues après une valeur, en nanosecondes
+typedef struct {
+    const char *suffixe;
+    temps_t nanosecondes;
+} UniteTemps;
+
+static const UniteTemps unites[] = {
+    { "ns", 1LL },
+    { "us", 1000LL },
+    { "\xC2\xB5s", 1000LL },  // µs
+    { "ms", 1000000LL },
+    { "s", 1000000000LL },
+};
+
+#define NB_UNITES ((int)(sizeof(unites) / sizeof(unites[0])))
+
+// Fonction pour lire une durée positive ou nulle : un entier, éventuellement
+// suivi d'une unité ("250us", "1.5ms", "2 s"). Une partie décimale n'est
+// acceptée qu'avec une unité, et doit tomber sur un nombre entier de ns.
+// Les espaces de tête sont ignorés ; fin (si non NULL) reçoit la position
+// suivant la valeur. Renvoie false si le texte n'est pas une durée ou si
+// la valeur convertie dépasse TEMPS_MAX (au lieu de déborder).
+bool lire_temps(const char *texte, temps_t *valeur, const char **fin) {
+    const char *p = texte;
+    temps_t entier = 0;
+    temps_t fraction = 0;
+    temps_t diviseur = 1;
+    bool chiffres = false;
+    
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    for (; isdigit((unsigned char)*p); p++, chiffres = true) {
+        if (__builtin_mul_overflow(entier, 10, &entier) ||
+            __builtin_add_overflow(entier, *p - '0', &entier)) {
+            return false;
+        }
+    }
+    if (*p == '.') {
+        for (p++; isdigit((unsigned char)*p); p++, chiffres = true) {
+            if (diviseur == 1000000000LL) {
+                return false;     // Au-delà de la nanoseconde
+            }
+            fraction = fraction * 10 + (*p - '0');
+            diviseur *= 10;
+        }
+    }
+    if (!chiffres) {
+        return false;
+    }
+    
+    // Unité éventuelle, séparée ou non de la valeur par des espaces
+    const char *q = p;
+    while (*q == ' ' || *q == '\t') {
+        q++;
+    }
+    temps_t multiplicateur = 1;
+    bool unite = false;
+    for (int u = 0; u < NB_UNITES; u++) {
+        size_t longueur = strlen(unites[u].suffixe);
+        if (strncmp(q, unites[u].suffixe, longueur) == 0 && !isalnum((unsigned char)q[longueur])) {
+            multiplicateur = unites[u].nanosecondes;
+            p = q + longueur;
+            unite = true;
+            break;
+        }
+    }
+    if (isalpha((unsigned char)*p) || (diviseur > 1 && !unite)) {
+        return false;
+    }
+    if (diviseur > 1 && (fraction * multiplicateur) % diviseur != 0) {
+        return false;
+    }
+    
+    temps_t resultat;
+    if (__builtin_mul_overflow(entier, multiplicateur, &resultat) ||
+        __builtin_add_overflow(resultat, fraction * multiplicateur / diviseur, &resultat)) {
+        return false;
+    }
+    *valeur = resultat;
+    if (fin != NULL) {
+        *fin = p;
+    }
+    return true;
+}
+
+// Fonction pour lire une durée saisie dans un fichier (un mot, l'unité étant
+// alors accolée à la valeur : "250us") ; false si le mot n'est pas une durée
+bool lire_temps_fichier(FILE *fichier, temps_t *valeur) {
+    char mot[64];
+    const char *fin;
+    
+    if (fscanf(fichier, "%63s", mot) != 1) {
+        return false;
+    }
+    return lire_temps(mot, valeur, &fin) && *fin == '\0';
+}
+
+// Fonction pour calculer le PGCD de deux entiers positifs
+temps_t pgcd_temps(temps_t a, temps_t b) {
+    while (b != 0) {
+        temps_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
@@ -0,0 +1,24 @@
+#ifndef TEMPS_H
+#define TEMPS_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <limits.h>
+
+// Base de temps des paramètres et de la simulation : entier 64 bits.
+// Sans unité, une valeur est un nombre de ticks abstraits ; avec une unité
+// (ns, us, ms, s), elle est convertie en nanosecondes, un tick valant alors 1 ns.
+typedef long long temps_t;
+
+#define TEMPS_MAX LLONG_MAX
+
+// Plus grande valeur d'un paramètre C, D ou T (2^40 ticks, soit environ
+// 18 minutes en nanosecondes) : les sommes et produits des analyses et de la
+// simulation restent ainsi loin de TEMPS_MAX
+#define TEMPS_PARAMETRE_MAX (1LL << 40)
+
+bool lire_temps(const char *texte, temps_t *valeur, const char **fin);
+bool lire_temps_fichier(FILE *fichier, temps_t *valeur);
+temps_t pgcd_temps(temps_t a, temps_t b);
+
+#endif
@@ -0,0 +1,250 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "tache.h"
+#include "analyse.h"
+#include "serveurs.h"
+#include "lot-taches.h"
+#include "generateur-taches.h"
+#include "moteur-simulation.h"
+
+// Tests de non-régression : chaque cas reproduit un défaut corrigé.
+// Un cas qui ne se termine plus fait échouer `make test` par dépassement de délai.
+
+static int echecs = 0;
+
+// Fonction pour vérifier une condition et signaler le cas en échec
+static void verifier(bool condition, const char *cas) {
+    printf("%-60s %s\n", cas, condition ? "ok" : "ECHEC");
+    if (!condition) {
+        echecs++;
+    }
+}
+
+// RTA avec blocage : utilisation de niveau 1 et D > T, la période d'activité
+// ne se termine jamais (la récurrence bouclait sans fin)
+static void test_rta_blocage_utilisation_pleine(void) {
+    ParametresTache taches[] = { { 1, 2, 2, 0, 0 }, { 1, 10, 2, 0, 0 }, { 1, 200, 100, 0, 0 } };
+    long long blocages[] = { 0, 1, 0 };
+    long long temps_reponse[3];
+    
+    calculer_priorites_rm(taches, 3);
+    verifier(temps_reponse_tache_blocage(taches, 3, 1, 1) == -1, "rta: blocage et utilisation de niveau 1");
+    verifier(!analyser_temps_reponse_blocage(taches, 3, blocages, temps_reponse) && temps_reponse[0] == 1 &&
+             temps_reponse[1] == -1 && temps_reponse[2] == -1, "rta: verdict du jeu a utilisation pleine");
+    verifier(temps_reponse_tache_blocage(taches, 2, 1, 0) == 2, "rta: utilisation de niveau 1 sans blocage");
+}
+
+// Dimensionnement d'un serveur différé en DM : la dichotomie essaie un budget
+// qui porte l'utilisation de niveau à 1 avec le blocage Qs (le programme bouclait)
+static void test_budget_maximal_serveur_differe(void) {
+    ParametresTache taches[] = { { 1, 8, 6, 3, 0 }, { 7, 41, 30, 7, 0 }, { 1, 7, 5, 2, 0 } };
+    ParametresServeur serveur = { SERVEUR_DIFFERE, 1, 5, true };
+    
+    verifier(budget_maximal(taches, 3, &serveur) == 1, "serveurs: budget maximal du serveur differe");
+    verifier(serveur_garanti(taches, 3, &serveur), "serveurs: budget 1 garanti");
+    serveur.budget = 2;
+    verifier(!serveur_garanti(taches, 3, &serveur), "serveurs: budget 2 (utilisation 1) non garanti");
+}
+
+// Fonction pour simuler un jeu en mode verdict seul (comme le mode lot) ;
+// non_conclu reçoit systeme.non_conclu
+static bool simuler_jeu(ParametresTache *taches, int nb_taches, TypeOrdonnanceur algorithme, bool *non_conclu) {
+    Systeme systeme = { 0 };
+    
+    systeme.algorithme = algorithme;
+    systeme.verdict_seul = true;
+    systeme.taches = malloc(nb_taches * sizeof(Tache));
+    if (systeme.taches == NULL) {
+        *non_conclu = false;
+        return false;
+    }
+    configurer_systeme(&systeme, taches, nb_taches);
+    bool faisable = simuler_ordonnancement(&systeme, 0);
+    *non_conclu = systeme.non_conclu;
+    free(systeme.taches);
+    liberer_files(&systeme);
+    return faisable;
+}
+
+// Jeu dont l'hyperpériode (produit de quatre périodes premières) dépasse la
+// capacité des dates
+static const ParametresTache PERIODES_PREMIERES[4] = {
+    { 1, 1000003, 1000003, 0, 0 }, { 1, 1000033, 1000033, 0, 0 },
+    { 1, 1000037, 1000037, 0, 0 }, { 1, 1000039, 1000039, 0, 0 }
+};
+
+// Hyperpériode hors capacité : l'horizon était borné à HORIZON_MAX (2^61 ticks)
+// et la simulation ne se terminait pas sans l'arrêt sur la période d'activité
+static void test_horizon_non_calculable(void) {
+    ParametresTache taches[4];
+    bool non_conclu;
+    
+    memcpy(taches, PERIODES_PREMIERES, sizeof(taches));
+    verifier(simuler_jeu(taches, 4, RM, &non_conclu) && !non_conclu,
+             "simulation: RM conclut sur la periode d'activite");
+    taches[0].duree_execution = 1000003;
+    verifier(!simuler_jeu(taches, 4, EDF, &non_conclu) && !non_conclu, "simulation: U > 1 non faisable");
+}
+
+// FIFO (non préemptif) sans hyperpériode : pas d'arrêt sur la période
+// d'activité, la simulation avançait vers HORIZON_MAX (--algo fifo)
+static void test_fifo_horizon_non_calculable(void) {
+    ParametresTache taches[4];
+    bool non_conclu;
+    
+    memcpy(taches, PERIODES_PREMIERES, sizeof(taches));
+    verifier(!simuler_jeu(taches, 4, FIFO, &non_conclu) && non_conclu, "simulation: FIFO non conclu sans horizon");
+}
+
+// Fonction pour créer un fichier temporaire ouvert en écriture
+// (chemin : tampon d'au moins 32 caractères)
+static FILE *creer_temporaire(char *chemin) {
+    snprintf(chemin, 32, "/tmp/regression-XXXXXX");
+    int descripteur = mkstemp(chemin);
+    
+    return descripteur >= 0 ? fdopen(descripteur, "wb") : NULL;
+}
+
+// Fonction pour lire le premier jeu (au plus 4 tâches) d'un fichier de lot, puis le supprimer
+static bool lire_premier_jeu(const char *chemin, ParametresTache *taches, int *nb_taches) {
+    LecteurLot lecteur;
+    bool lu = lot_ouvrir(&lecteur, chemin) && lot_lire_jeu(&lecteur) == 1 && lecteur.nb_taches <= 4;
+    
+    for (int i = 0; lu && i < lecteur.nb_taches; i++) {
+        taches[i] = lecteur.parametres[i];
+    }
+    *nb_taches = lu ? lecteur.nb_taches : 0;
+    if (lecteur.fichier != NULL) {
+        lot_fermer(&lecteur);
+    }
+    remove(chemin);
+    return lu;
+}
+
+// Décalages dans les lots : colonne O du format texte, enregistrements
+// binaires de version 2 (les lecteurs mettaient toujours le décalage à 0)
+static void test_lot_decalages(void) {
+    const char *texte = "# C D T [P [O]]\n3\n1 4 4 0 3\n1ms 6ms 6ms 2 500us\n2 8 8\n";
+    const uint32_t version1[] = { 1, 1, 2, 2, 3 }; // n = 1, puis C D T P
+    ParametresTache taches[4], relues[4];
+    char chemin[32];
+    int n = 0;
+    
+    FILE *fichier = creer_temporaire(chemin);
+    bool ecrit = fichier != NULL && fputs(texte, fichier) >= 0;
+    if (fichier != NULL) {
+        fclose(fichier);
+    }
+    bool lu = ecrit && lire_premier_jeu(chemin, taches, &n);
+    verifier(lu && n == 3 && taches[0].decalage == 3 && taches[0].priorite == 0 &&
+             taches[1].decalage == 500000 && taches[1].priorite == 2 && taches[2].decalage == 0,
+             "lot: colonne de decalage du format texte");
+    
+    // Aller-retour par le format binaire
+    fichier = creer_temporaire(chemin);
+    ecrit = fichier != NULL && lot_ecrire_entete_binaire(fichier) && lot_ecrire_jeu_binaire(fichier, taches, 3);
+    if (fichier != NULL) {
+        fclose(fichier);
+    }
+    lu = ecrit && lire_premier_jeu(chemin, relues, &n);
+    verifier(lu && n == 3 && relues[0].decalage == 3 && relues[1].decalage == 500000 && relues[2].decalage == 0,
+             "lot: decalages du format binaire");
+    
+    // Version 1 : enregistrements de 4 int32, décalage nul
+    uint32_t version = 1;
+    fichier = creer_temporaire(chemin);
+    ecrit = fichier != NULL && fwrite("ORDB", 1, 4, fichier) == 4 &&
+            fwrite(&version, sizeof(version), 1, fichier) == 1 && fwrite(version1, sizeof(version1), 1, fichier) == 1;
+    if (fichier != NULL) {
+        fclose(fichier);
+    }
+    lu = ecrit && lire_premier_jeu(chemin, taches, &n);
+    verifier(lu && n == 1 && taches[0].duree_execution == 1 && taches[0].periode == 2 &&
+             taches[0].priorite == 3 && taches[0].decalage == 0, "lot: format binaire de version 1");
+    
+    taches[0].decalage = -1;
+    verifier(!lot_parametres_valides(taches, 1), "lot: decalage negatif invalide");
+}
+
+// Lot à activations décalées sans hyperpériode : l'arrêt sur la période
+// d'activité ne s'applique pas aux jeux asynchrones, simulation-EDF --lot et
+// faisabilite-ordonnanceur --lot --algo hpf ne se terminaient pas
+static void test_lot_decale_horizon_non_calculable(void) {
+    const char *texte = "4\n1 1000003 1000003\n1 1000033 1000033\n1 1000037 1000037 0 5\n1 1000039 1000039\n";
+    ParametresTache taches[4];
+    char chemin[32];
+    bool non_conclu_hpf = false, non_conclu_edf = false;
+    int n = 0;
+    
+    FILE *fichier = creer_temporaire(chemin);
+    bool ecrit = fichier != NULL && fputs(texte, fichier) >= 0;
+    if (fichier != NULL) {
+        fclose(fichier);
+    }
+    bool lu = ecrit && lire_premier_jeu(chemin, taches, &n) && n == 4 && taches[2].decalage == 5;
+    verifier(lu && !simuler_jeu(taches, 4, HPF, &non_conclu_hpf) && non_conclu_hpf &&
+             !simuler_jeu(taches, 4, EDF, &non_conclu_edf) && non_conclu_edf,
+             "lot: jeu decale sans horizon non conclu (HPF, EDF)");
+}
+
+// Générateur : périodes au-delà de 2^31 (périodes, durées et échéances
+// étaient tronquées en int)
+static void test_generateur_grandes_periodes(void) {
+    ParametresGeneration generation = { 8, 0.9, 1LL << 32, 1LL << 36, 1.0, 1.0 };
+    ParametresTache taches[8];
+    double utilisations[8];
+    GenerateurAleatoire alea;
+    bool valides = true;
+    
+    alea_initialiser(&alea, 1);
+    verifier(generer_jeu(&alea, &generation, taches, utilisations), "generateur: tirage du jeu");
+    for (int i = 0; i < 8; i++) {
+        valides = valides && taches[i].periode >= generation.periode_min &&
+                  taches[i].periode <= generation.periode_max && taches[i].duree_execution >= 1 &&
+                  taches[i].echeance == taches[i].periode && taches[i].duree_execution <= taches[i].echeance;
+    }
+    verifier(valides && lot_parametres_valides(taches, 8), "generateur: periodes au-dela de 2^31");
+}
+
+// Format texte : P et O facultatifs, mais un champ présent et illisible
+// rejette la ligne ("1 4 4 abc" était lu comme une tâche sans priorité)
+static void test_lot_champs_invalides(void) {
+    const char *textes[] = { "1\n1 4 4 abc\n", "1\n1 4 4 2x\n", "1\n1 4 4 99999999999\n",
+                             "1\n1 4 4 2 0 abc\n", "1\n1 4 4 2 1ms 3\n", "1\n1 4 4 # C D T\n" };
+    ParametresTache taches[4];
+    char chemin[32];
+    int n = 0;
+    bool rejetes = true;
+    bool lu = false;
+    
+    for (int k = 0; k < 6; k++) {
+        FILE *fichier = creer_temporaire(chemin);
+        bool ecrit = fichier != NULL && fputs(textes[k], fichier) >= 0;
+        if (fichier != NULL) {
+            fclose(fichier);
+        }
+        lu = ecrit && lire_premier_jeu(chemin, taches, &n);
+        if (k < 5) {
+            rejetes = rejetes && ecrit && !lu;
+        }
+    }
+    verifier(rejetes, "lot: champ P ou O illisible ou en trop rejete");
+    verifier(lu && n == 1 && taches[0].priorite == 0, "lot: commentaire apres T accepte");
+}
+
+int main(void) {
+    test_rta_blocage_utilisation_pleine();
+    test_budget_maximal_serveur_differe();
+    test_lot_decalages();
+    test_lot_champs_invalides();
+    test_horizon_non_calculable();
+    test_fifo_horizon_non_calculable();
+    test_lot_decale_horizon_non_calculable();
+    test_generateur_grandes_periodes();
+    
+    printf("%d echec(s)\n", echecs);
+    return echecs == 0 ? 0 : 1;
+}
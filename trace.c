@@ -0,0 +1,500 @@
+#include <stdlib.h>
+#include <string.h>
+#include "trace.h"
+
+#define MAGIC_TRACE "ORDT"
+#define VERSION_TRACE 3u
+#define CAPACITE_MINIMALE 64
+
+// En-tête d'un fichier de trace, suivi des paramètres des tâches puis des
+// enregistrements bruts jusqu'à la fin du fichier
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t niveau;
+    uint32_t nb_taches;
+} EnteteTrace;
+
+// Fonction pour créer une trace en mémoire (tampon circulaire)
+bool trace_creer_anneau(Trace *trace, NiveauTrace niveau, size_t capacite) {
+    memset(trace, 0, sizeof(*trace));
+    if (capacite < CAPACITE_MINIMALE) {
+        capacite = CAPACITE_MINIMALE;
+    }
+    trace->tampon = malloc(capacite * sizeof(EvenementTrace));
+    if (trace->tampon == NULL) {
+        return false;
+    }
+    trace->capacite = capacite;
+    trace->niveau = niveau;
+    return true;
+}
+
+// Fonction pour créer une trace vidée au fil de l'eau dans un fichier binaire
+bool trace_creer_fichier(Trace *trace, NiveauTrace niveau, size_t capacite, const char *chemin,
+                         const ParametresTache *parametres, int nb_taches) {
+    if (!trace_creer_anneau(trace, niveau, capacite)) {
+        return false;
+    }
+    
+    trace->fichier = fopen(chemin, "wb");
+    if (trace->fichier == NULL) {
+        perror(chemin);
+        free(trace->tampon);
+        trace->tampon = NULL;
+        return false;
+    }
+    
+    EnteteTrace entete = { { 0 }, VERSION_TRACE, (uint32_t)niveau, (uint32_t)nb_taches };
+    memcpy(entete.magic, MAGIC_TRACE, 4);
+    if (fwrite(&entete, sizeof(entete), 1, trace->fichier) != 1 ||
+        fwrite(parametres, sizeof(ParametresTache), nb_taches, trace->fichier) != (size_t)nb_taches) {
+        trace->erreur = true;
+    }
+    return true;
+}
+
+// Fonction pour vider la trace avant une nouvelle simulation (mode anneau)
+void trace_reinitialiser(Trace *trace) {
+    trace->debut = 0;
+    trace->nb = 0;
+    trace->perdus = 0;
+}
+
+// Fonction appelée lorsque le tampon est plein : vidage dans le fichier, ou
+// abandon du plus ancien événement en mode anneau
+void trace_tampon_plein(Trace *trace) {
+    if (trace->fichier != NULL) {
+        if (fwrite(trace->tampon, sizeof(EvenementTrace), trace->nb, trace->fichier) != trace->nb) {
+            trace->erreur = true;
+        }
+        trace->ecrits += trace->nb;
+        trace->nb = 0;
+        return;
+    }
+    
+    trace->debut = trace->debut + 1 == trace->capacite ? 0 : trace->debut + 1;
+    trace->nb--;
+    trace->perdus++;
+}
+
+// Fonction pour terminer la trace : vidage du tampon, fermeture et libération
+// Renvoie false si une écriture a échoué
+bool trace_fermer(Trace *trace) {
+    if (trace->fichier != NULL) {
+        if (trace->nb > 0) {
+            trace_tampon_plein(trace);
+        }
+        if (fclose(trace->fichier) != 0) {
+            trace->erreur = true;
+        }
+    }
+    free(trace->tampon);
+    
+    bool reussi = !trace->erreur;
+    memset(trace, 0, sizeof(*trace));
+    return reussi;
+}
+
+// Fonction pour charger en mémoire un fichier de trace binaire
+// Les paramètres des tâches sont alloués et doivent être libérés par l'appelant.
+bool trace_charger(Trace *trace, const char *chemin, ParametresTache **parametres, int *nb_taches) {
+    EnteteTrace entete;
+    
+    memset(trace, 0, sizeof(*trace));
+    *parametres = NULL;
+    *nb_taches = 0;
+    
+    FILE *fichier = fopen(chemin, "rb");
+    if (fichier == NULL) {
+        perror(chemin);
+        return false;
+    }
+    if (fread(&entete, sizeof(entete), 1, fichier) != 1 || memcmp(entete.magic, MAGIC_TRACE, 4) != 0) {
+        fprintf(stderr, "%s: fichier de trace invalide\n", chemin);
+        fclose(fichier);
+        return false;
+    }
+    if (entete.version != VERSION_TRACE) {
+        fprintf(stderr, "%s: version de trace non supportee\n", chemin);
+        fclose(fichier);
+        return false;
+    }
+    
+    int n = (int)entete.nb_taches;
+    ParametresTache *taches = malloc((n > 0 ? n : 1) * sizeof(ParametresTache));
+    if (taches == NULL || fread(taches, sizeof(ParametresTache), n, fichier) != (size_t)n ||
+        !trace_creer_anneau(trace, (NiveauTrace)entete.niveau, CAPACITE_MINIMALE)) {
+        fprintf(stderr, "%s: en-tete de trace incomplet\n", chemin);
+        free(taches);
+        fclose(fichier);
+        return false;
+    }
+    
+    // Lecture des enregistrements par blocs, le tampon doublant au besoin
+    size_t lus;
+    while ((lus = fread(trace->tampon + trace->nb, sizeof(EvenementTrace),
+                        trace->capacite - trace->nb, fichier)) > 0) {
+        trace->nb += lus;
+        if (trace->nb == trace->capacite) {
+            EvenementTrace *tampon = realloc(trace->tampon, 2 * trace->capacite * sizeof(EvenementTrace));
+            if (tampon == NULL) {
+                fprintf(stderr, "%s: memoire insuffisante\n", chemin);
+                trace_fermer(trace);
+                free(taches);
+                fclose(fichier);
+                return false;
+            }
+            trace->tampon = tampon;
+            trace->capacite *= 2;
+        }
+    }
+    
+    fclose(fichier);
+    *parametres = taches;
+    *nb_taches = n;
+    return true;
+}
+
+// Instance en attente, reconstituée à partir des événements (export texte)
+typedef struct {
+    int tache;
+    int numero;
+    long long echeance;
+    long long restant;
+} InstanceAttente;
+
+// Instances en attente triées par tâche puis par numéro (une tâche peut en
+// avoir plusieurs lorsque D > T ou après un retard)
+typedef struct {
+    InstanceAttente *instances;
+    size_t nb;
+    size_t capacite;
+} FileAttente;
+
+// Fonction pour trouver la position de l'instance (tache, numero), ou celle où l'insérer
+static size_t position_attente(const FileAttente *file, int tache, int numero) {
+    size_t debut = 0;
+    size_t fin = file->nb;
+    
+    while (debut < fin) {
+        size_t milieu = debut + (fin - debut) / 2;
+        const InstanceAttente *instance = &file->instances[milieu];
+        if (instance->tache < tache || (instance->tache == tache && instance->numero < numero)) {
+            debut = milieu + 1;
+        } else {
+            fin = milieu;
+        }
+    }
+    return debut;
+}
+
+// Fonction pour obtenir une instance en attente (NULL si elle précède la trace)
+static InstanceAttente *chercher_attente(FileAttente *file, int tache, int numero) {
+    size_t position = position_attente(file, tache, numero);
+    
+    if (position < file->nb && file->instances[position].tache == tache &&
+        file->instances[position].numero == numero) {
+        return &file->instances[position];
+    }
+    return NULL;
+}
+
+// Fonction pour ajouter une instance activée (false si mémoire insuffisante)
+static bool ajouter_attente(FileAttente *file, int tache, int numero, long long echeance, long long restant) {
+    if (file->nb == file->capacite) {
+        size_t capacite = file->capacite > 0 ? 2 * file->capacite : 16;
+        InstanceAttente *instances = realloc(file->instances, capacite * sizeof(InstanceAttente));
+        if (instances == NULL) {
+            return false;
+        }
+        file->instances = instances;
+        file->capacite = capacite;
+    }
+    size_t position = position_attente(file, tache, numero);
+    memmove(&file->instances[position + 1], &file->instances[position],
+            (file->nb - position) * sizeof(InstanceAttente));
+    file->instances[position] = (InstanceAttente){ tache, numero, echeance, restant };
+    file->nb++;
+    return true;
+}
+
+// Fonction pour retirer une instance terminée ou abandonnée
+static void retirer_attente(FileAttente *file, int tache, int numero) {
+    InstanceAttente *instance = chercher_attente(file, tache, numero);
+    
+    if (instance != NULL) {
+        size_t position = instance - file->instances;
+        file->nb--;
+        memmove(instance, instance + 1, (file->nb - position) * sizeof(InstanceAttente));
+    }
+}
+
+// Fonction pour afficher les instances en attente d'exécution
+static void afficher_file(FILE *sortie, const FileAttente *file) {
+    bool file_vide = true;
+    
+    fprintf(sortie, "    >> ETAT DE LA FILE D'ATTENTE:\n");
+    for (size_t k = 0; k < file->nb; k++) {
+        const InstanceAttente *instance = &file->instances[k];
+        if (instance->restant > 0) {
+            fprintf(sortie, "       - Tache %d: echeance=%lld, restant=%lld\n", instance->tache + 1,
+                    instance->echeance, instance->restant);
+            file_vide = false;
+        }
+    }
+    if (file_vide) {
+        fprintf(sortie, "       - (File vide)\n");
+    }
+}
+
+// Blocages subis par une tâche, reconstitués à partir des événements
+typedef struct {
+    long long inversions;
+    long long total;
+    long long max;
+    int instance;             // Instance dont le blocage est en cours de cumul
+    long long courant;
+} BilanBlocage;
+
+// Fonction pour cumuler un segment de blocage dans le bilan d'une tâche
+static void comptabiliser_bilan(BilanBlocage *bilan, int instance, long long duree) {
+    if (bilan->courant == 0 || bilan->instance != instance) {
+        bilan->instance = instance;
+        bilan->courant = 0;
+    }
+    bilan->courant += duree;
+    bilan->total += duree;
+    if (bilan->courant > bilan->max) {
+        bilan->max = bilan->courant;
+    }
+}
+
+// Fonction pour exporter la trace au format texte lisible
+// L'état de la file d'attente est reconstitué à partir des événements.
+void trace_exporter_texte(const Trace *trace, const ParametresTache *parametres, int nb_taches, FILE *sortie) {
+    FileAttente file = { NULL, 0, 0 };
+    long long temps_courant = -1;
+    BilanBlocage *bilans = calloc(nb_taches > 0 ? nb_taches : 1, sizeof(BilanBlocage));
+    bool ressources = false;
+    
+    if (bilans == NULL) {
+        fprintf(stderr, "Memoire insuffisante pour l'export de la trace\n");
+        return;
+    }
+    if (trace->perdus > 0) {
+        fprintf(sortie, "\n(%llu evenements anterieurs ecrases dans le tampon de trace)\n", trace->perdus);
+    }
+    
+    for (size_t k = 0; k < trace->nb; k++) {
+        const EvenementTrace *evenement = trace_lire(trace, k);
+        long long temps = evenement->temps;
+        int i = evenement->tache;
+        InstanceAttente *instance;
+        
+        // Événement portant sur une tâche inconnue (fichier corrompu)
+        if (evenement->type != EVT_INACTIF && evenement->type != EVT_FIN &&
+            (i < 0 || i >= nb_taches)) {
+            continue;
+        }
+        if (evenement->type != EVT_FIN && temps != temps_courant) {
+            temps_courant = temps;
+            fprintf(sortie, "\n--- TEMPS t = %lld ---\n", temps_courant);
+        }
+        
+        switch ((TypeEvenement)evenement->type) {
+            case EVT_ACTIVATION:
+                if (parametres[i].duree_execution > 0 &&
+                    !ajouter_attente(&file, i, evenement->instance, temps + evenement->valeur,
+                                     parametres[i].duree_execution)) {
+                    fprintf(stderr, "Memoire insuffisante pour l'export de la trace\n");
+                    free(file.instances);
+                    free(bilans);
+                    return;
+                }
+                fprintf(sortie, "    >> ACTIVATION: Tache %d (instance %d) - echeance absolue: %lld\n",
+                        i + 1, evenement->instance, temps + evenement->valeur);
+                break;
+            case EVT_EXECUTION:
+                fprintf(sortie, "    >> EXECUTION: Tache %d (instance %d) de t=%lld a t=%lld\n",
+                        i + 1, evenement->instance, temps, temps + evenement->valeur);
+                instance = chercher_attente(&file, i, evenement->instance);
+                if (instance != NULL) {
+                    instance->restant -= evenement->valeur;
+                    fprintf(sortie, "       - Echeance absolue: %lld\n", instance->echeance);
+                    fprintf(sortie, "       - Temps restant: %lld\n", instance->restant);
+                }
+                afficher_file(sortie, &file);
+                break;
+            case EVT_PREEMPTION:
+                fprintf(sortie, "    >> PREEMPTION: Tache %d interrompue par Tache %d\n",
+                        i + 1, (int)evenement->valeur + 1);
+                break;
+            case EVT_TERMINAISON:
+                retirer_attente(&file, i, evenement->instance);
+                fprintf(sortie, "    >> TERMINAISON: Tache %d (instance %d) completee\n",
+                        i + 1, evenement->instance);
+                break;
+            case EVT_ECHEANCE_MANQUEE:
+                fprintf(sortie, "    >> ECHEC: Tache %d (instance %d, temps restant: %lld) - echeance manquee\n",
+                        i + 1, evenement->instance, (long long)evenement->valeur);
+                break;
+            case EVT_ABANDON:
+                if (evenement->valeur < 0) {
+                    fprintf(sortie, "    >> SAUT: Tache %d (instance %d) non activee, instance precedente en retard\n",
+                            i + 1, evenement->instance);
+                } else {
+                    retirer_attente(&file, i, evenement->instance);
+                    fprintf(sortie, "    >> ABANDON: Tache %d (instance %d, temps restant: %lld)\n",
+                            i + 1, evenement->instance, (long long)evenement->valeur);
+                }
+                break;
+            case EVT_COMMUTATION:
+                fprintf(sortie, "    >> COMMUTATION: Tache %d (instance %d) de t=%lld a t=%lld\n",
+                        i + 1, evenement->instance, temps, temps + evenement->valeur);
+                break;
+            case EVT_INACTIF:
+                fprintf(sortie, "    >> PROCESSEUR INACTIF jusqu'a t=%lld\n", temps + evenement->valeur);
+                afficher_file(sortie, &file);
+                break;
+            case EVT_VERROUILLAGE:
+                ressources = true;
+                fprintf(sortie, "    >> VERROUILLAGE: Tache %d (instance %d) prend la ressource R%d\n",
+                        i + 1, evenement->instance, (int)evenement->valeur + 1);
+                break;
+            case EVT_LIBERATION:
+                ressources = true;
+                fprintf(sortie, "    >> LIBERATION: Tache %d (instance %d) rend la ressource R%d\n",
+                        i + 1, evenement->instance, (int)evenement->valeur + 1);
+                break;
+            case EVT_INVERSION:
+                ressources = true;
+                bilans[i].inversions++;
+                fprintf(sortie, "    >> INVERSION: Tache %d (instance %d) bloquee, Tache %d s'execute\n",
+                        i + 1, evenement->instance, (int)evenement->valeur + 1);
+                break;
+            case EVT_BLOCAGE:
+                ressources = true;
+                comptabiliser_bilan(&bilans[i], evenement->instance, evenement->valeur);
+                fprintf(sortie, "    >> BLOCAGE: Tache %d (instance %d) de t=%lld a t=%lld\n",
+                        i + 1, evenement->instance, temps, temps + evenement->valeur);
+                break;
+            case EVT_FIN:
+                switch ((MotifFin)evenement->valeur) {
+                    case FIN_HORIZON:
+                        fprintf(sortie, "\n--- FIN DE SIMULATION a t=%lld ---\n", temps);
+                        break;
+                    case FIN_ECHEC:
+                        fprintf(sortie, "\n--- SIMULATION ARRETEE a t=%lld: echeance manquee ---\n", temps);
+                        break;
+                    case FIN_TERMINEE:
+                        fprintf(sortie, "\n--- SUCCES a t=%lld: periode d'activite terminee sans echeance manquee ---\n", temps);
+                        break;
+                    case FIN_MEMOIRE:
+                        fprintf(sortie, "\n--- SIMULATION ARRETEE: memoire insuffisante ---\n");
+                        break;
+                    case FIN_CYCLE:
+                        fprintf(sortie, "\n--- CYCLE a t=%lld: etat identique une hyperperiode plus tot ---\n", temps);
+                        break;
+                    case FIN_NON_CONCLU:
+                        fprintf(sortie, "\n--- SIMULATION NON EFFECTUEE: horizon non calculable ---\n");
+                        break;
+                }
+                break;
+        }
+    }
+    
+    // Bilan des blocages par tâche (les durées ne sont tracées qu'au niveau complet)
+    if (ressources) {
+        fprintf(sortie, "\n--- BLOCAGES PAR TACHE ---\n");
+        for (int i = 0; i < nb_taches; i++) {
+            fprintf(sortie, "Tache %d: %lld inversion(s), blocage total %lld, max par instance %lld\n",
+                    i + 1, bilans[i].inversions, bilans[i].total, bilans[i].max);
+        }
+    }
+    
+    free(file.instances);
+    free(bilans);
+}
+
+// Fonction pour exporter la trace au format JSON de Chrome (chrome://tracing, Perfetto)
+// Une unité de temps de la simulation correspond à une microseconde ; chaque
+// tâche occupe sa propre ligne (tid), le processeur inactif la ligne 0.
+void trace_exporter_chrome(const Trace *trace, const ParametresTache *parametres, int nb_taches, FILE *sortie) {
+    fprintf(sortie, "{\"traceEvents\":[\n");
+    fprintf(sortie, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Ordonnanceur\"}},\n");
+    fprintf(sortie, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Inactif\"}}");
+    for (int i = 0; i < nb_taches; i++) {
+        fprintf(sortie, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                "\"args\":{\"name\":\"Tache %d (C=%lld, D=%lld, T=%lld)\"}}",
+                i + 1, i + 1, parametres[i].duree_execution, parametres[i].echeance, parametres[i].periode);
+    }
+    
+    for (size_t k = 0; k < trace->nb; k++) {
+        const EvenementTrace *evenement = trace_lire(trace, k);
+        long long temps = evenement->temps;
+        int tid = evenement->tache + 1;
+        
+        switch ((TypeEvenement)evenement->type) {
+            case EVT_EXECUTION:
+                fprintf(sortie, ",\n{\"name\":\"T%d #%d\",\"cat\":\"execution\",\"ph\":\"X\",\"ts\":%lld,"
+                        "\"dur\":%lld,\"pid\":1,\"tid\":%d}",
+                        tid, evenement->instance, temps, (long long)evenement->valeur, tid);
+                break;
+            case EVT_INACTIF:
+                fprintf(sortie, ",\n{\"name\":\"inactif\",\"cat\":\"inactif\",\"ph\":\"X\",\"ts\":%lld,"
+                        "\"dur\":%lld,\"pid\":1,\"tid\":0}", temps, (long long)evenement->valeur);
+                break;
+            case EVT_ACTIVATION:
+                fprintf(sortie, ",\n{\"name\":\"activation\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,"
+                        "\"tid\":%d,\"args\":{\"instance\":%d,\"echeance\":%lld}}",
+                        temps, tid, evenement->instance, temps + evenement->valeur);
+                break;
+            case EVT_PREEMPTION:
+                fprintf(sortie, ",\n{\"name\":\"preemption\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,"
+                        "\"tid\":%d,\"args\":{\"par\":%d}}", temps, tid, (int)evenement->valeur + 1);
+                break;
+            case EVT_TERMINAISON:
+                fprintf(sortie, ",\n{\"name\":\"terminaison\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,"
+                        "\"tid\":%d,\"args\":{\"instance\":%d}}", temps, tid, evenement->instance);
+                break;
+            case EVT_ECHEANCE_MANQUEE:
+                fprintf(sortie, ",\n{\"name\":\"echeance manquee\",\"ph\":\"i\",\"s\":\"p\",\"ts\":%lld,\"pid\":1,"
+                        "\"tid\":%d,\"args\":{\"instance\":%d,\"restant\":%lld}}",
+                        temps, tid, evenement->instance, (long long)evenement->valeur);
+                break;
+            case EVT_ABANDON:
+                fprintf(sortie, ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,"
+                        "\"tid\":%d,\"args\":{\"instance\":%d}}", evenement->valeur < 0 ? "saut" : "abandon",
+                        temps, tid, evenement->instance);
+                break;
+            case EVT_BLOCAGE:
+                fprintf(sortie, ",\n{\"name\":\"T%d #%d bloquee\",\"cat\":\"blocage\",\"ph\":\"X\",\"ts\":%lld,"
+                        "\"dur\":%lld,\"pid\":1,\"tid\":%d}",
+                        tid, evenement->instance, temps, (long long)evenement->valeur, tid);
+                break;
+            case EVT_COMMUTATION:
+                fprintf(sortie, ",\n{\"name\":\"T%d #%d commutation\",\"cat\":\"commutation\",\"ph\":\"X\","
+                        "\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%d}",
+                        tid, evenement->instance, temps, (long long)evenement->valeur, tid);
+                break;
+            case EVT_VERROUILLAGE:
+            case EVT_LIBERATION:
+                fprintf(sortie, ",\n{\"name\":\"%s R%d\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,"
+                        "\"tid\":%d,\"args\":{\"instance\":%d}}",
+                        evenement->type == EVT_VERROUILLAGE ? "verrouillage" : "liberation",
+                        (int)evenement->valeur + 1, temps, tid, evenement->instance);
+                break;
+            case EVT_INVERSION:
+                fprintf(sortie, ",\n{\"name\":\"inversion\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,"
+                        "\"tid\":%d,\"args\":{\"instance\":%d,\"bloquante\":%d}}",
+                        temps, tid, evenement->instance, (int)evenement->valeur + 1);
+                break;
+            case EVT_FIN:
+                fprintf(sortie, ",\n{\"name\":\"fin\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%lld,\"pid\":1,"
+                        "\"tid\":0,\"args\":{\"motif\":%d}}", temps, (int)evenement->valeur);
+                break;
+        }
+    }
+    fprintf(sortie, "\n],\"displayTimeUnit\":\"ms\"}\n");
+}
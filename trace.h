@@ -0,0 +1,136 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "tache.h"
+
+// Niveaux de détail de la trace (chaque niveau inclut les précédents)
+typedef enum {
+    TRACE_AUCUN,              // Aucun enregistrement
+    TRACE_ECHECS,             // Échéances manquées et fin de simulation
+    TRACE_EVENEMENTS,         // + activations, terminaisons, préemptions, sections critiques et inversions
+    TRACE_COMPLET             // + segments d'exécution, de blocage, de commutation et inactivité du processeur
+} NiveauTrace;
+
+// Types d'événements enregistrés
+typedef enum {
+    EVT_ACTIVATION,           // valeur = échéance relative de l'instance
+    EVT_EXECUTION,            // temps = début du segment, valeur = durée du segment
+    EVT_PREEMPTION,           // tache = tâche interrompue, valeur = tâche élue
+    EVT_TERMINAISON,          // Instance complétée
+    EVT_ECHEANCE_MANQUEE,     // valeur = temps d'exécution restant
+    EVT_INACTIF,              // valeur = durée de la période d'inactivité
+    EVT_FIN,                  // valeur = motif de fin (MotifFin)
+    EVT_ABANDON,              // Politique d'échec : valeur = temps restant de l'instance
+                              // abandonnée, -1 si son activation est sautée
+    EVT_VERROUILLAGE,         // Entrée en section critique : valeur = ressource
+    EVT_LIBERATION,           // Sortie de section critique : valeur = ressource
+    EVT_INVERSION,            // Début d'une inversion de priorité : valeur = tâche moins
+                              // prioritaire qui s'exécute à la place de l'instance
+    EVT_BLOCAGE,              // temps = début du segment, valeur = durée passée bloquée
+    EVT_COMMUTATION           // temps = début du segment, valeur = durée de la commutation de contexte
+} TypeEvenement;
+
+// Motifs de fin de simulation (valeur de EVT_FIN)
+typedef enum {
+    FIN_HORIZON,              // Horizon de simulation atteint
+    FIN_ECHEC,                // Arrêt sur échéance manquée
+    FIN_TERMINEE,             // Première période d'activité close sans échéance manquée
+    FIN_MEMOIRE,              // Mémoire insuffisante
+    FIN_CYCLE,                // État identique à celui d'une hyperpériode plus tôt
+    FIN_NON_CONCLU            // Horizon non calculable : simulation non effectuée
+} MotifFin;
+
+// Enregistrement binaire de taille fixe (32 octets)
+typedef struct {
+    int64_t temps;            // Date de l'événement
+    int64_t valeur;           // Donnée dépendant du type
+    int32_t type;             // TypeEvenement
+    int32_t tache;            // Indice de la tâche (-1 si aucune)
+    int32_t instance;         // Numéro de l'instance (à partir de 1)
+    int32_t reserve;          // Alignement (toujours 0)
+} EvenementTrace;
+
+// Tampon d'événements préalloué : aucune allocation ni mise en forme pendant
+// la simulation. En mode anneau, les plus anciens événements sont écrasés
+// lorsque le tampon est plein ; en mode fichier, le tampon est vidé dans le
+// fichier binaire.
+typedef struct {
+    NiveauTrace niveau;
+    EvenementTrace *tampon;
+    size_t capacite;
+    size_t debut;             // Plus ancien événement (mode anneau)
+    size_t nb;                // Événements présents dans le tampon
+    unsigned long long perdus; // Événements écrasés (mode anneau)
+    unsigned long long ecrits; // Événements vidés dans le fichier
+    FILE *fichier;            // NULL en mode anneau
+    bool erreur;              // Erreur d'écriture rencontrée
+} Trace;
+
+bool trace_creer_anneau(Trace *trace, NiveauTrace niveau, size_t capacite);
+bool trace_creer_fichier(Trace *trace, NiveauTrace niveau, size_t capacite, const char *chemin,
+                         const ParametresTache *parametres, int nb_taches);
+void trace_reinitialiser(Trace *trace);
+void trace_tampon_plein(Trace *trace);
+bool trace_fermer(Trace *trace);
+
+bool trace_charger(Trace *trace, const char *chemin, ParametresTache **parametres, int *nb_taches);
+void trace_exporter_texte(const Trace *trace, const ParametresTache *parametres, int nb_taches, FILE *sortie);
+void trace_exporter_chrome(const Trace *trace, const ParametresTache *parametres, int nb_taches, FILE *sortie);
+
+// Fonction pour obtenir le niveau à partir duquel un type d'événement est enregistré
+static inline NiveauTrace trace_niveau_evenement(TypeEvenement type) {
+    switch (type) {
+        case EVT_ECHEANCE_MANQUEE:
+        case EVT_ABANDON:
+        case EVT_FIN:
+            return TRACE_ECHECS;
+        case EVT_EXECUTION:
+        case EVT_INACTIF:
+        case EVT_BLOCAGE:
+        case EVT_COMMUTATION:
+            return TRACE_COMPLET;
+        default:
+            return TRACE_EVENEMENTS;
+    }
+}
+
+// Fonction pour enregistrer un événement (sans effet si la trace est absente ou
+// si le niveau est insuffisant ; le type étant constant à l'appel, le test se
+// réduit à une comparaison)
+static inline void trace_evenement(Trace *trace, TypeEvenement type, temps_t temps,
+                                   int tache, int instance, temps_t valeur) {
+    if (trace == NULL || trace->niveau < trace_niveau_evenement(type)) {
+        return;
+    }
+    if (trace->nb == trace->capacite) {
+        trace_tampon_plein(trace);
+    }
+    
+    size_t position = trace->debut + trace->nb;
+    if (position >= trace->capacite) {
+        position -= trace->capacite;
+    }
+    EvenementTrace *evenement = &trace->tampon[position];
+    evenement->temps = temps;
+    evenement->type = type;
+    evenement->tache = tache;
+    evenement->instance = instance;
+    evenement->valeur = valeur;
+    evenement->reserve = 0;
+    trace->nb++;
+}
+
+// Fonction pour obtenir le k-ième événement présent dans le tampon
+static inline const EvenementTrace *trace_lire(const Trace *trace, size_t k) {
+    size_t position = trace->debut + k;
+    if (position >= trace->capacite) {
+        position -= trace->capacite;
+    }
+    return &trace->tampon[position];
+}
+
+#endif